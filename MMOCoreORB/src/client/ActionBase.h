@@ -13,7 +13,7 @@
 #include "engine/util/JSONSerializationType.h"
 
 // Forward declaration
-class ClientCore;
+class ClientSession;
 
 /**
  * Base interface for all client actions
@@ -155,7 +155,7 @@ public:
 	/**
 	 * Execute the action
 	 *
-	 * @param core ClientCore reference for accessing sessions, options, etc.
+	 * @param session Session of the account the action runs for (login, zone, selected context and vars)
 	 *
 	 * Actions should:
 	 * - Validate prerequisites (check loginSession, zone, etc.)
@@ -163,7 +163,7 @@ public:
 	 * - Store results in internal result object
 	 * - NOT throw exceptions (catch and store in result)
 	 */
-	virtual void run(ClientCore& core) = 0;
+	virtual void run(ClientSession& session) = 0;
 
 	// ===== Results =====
 
@@ -13,6 +13,7 @@
 #include "client/login/LoginSession.h"
 #include "client/ActionBase.h"
 #include "client/ActionManager.h"
+#include "client/swarm/SwarmManager.h"
 #include "server/zone/packets/charcreation/ClientCreateCharacter.h"
 
 int exit_result = 1;
@@ -36,6 +37,24 @@ ClientCoreOptions::ClientCoreOptions(int argc, char** argv) {
 		{"saveState", ""},
 		{"loginOnly", false},
 		{"waitAfterZone", 0},
+		{"swarm", {
+			{"count", 0},
+			{"firstIndex", 1},
+			{"rampPerSecond", 10},
+			{"loginThreads", 8},
+			{"threads", 8},
+			{"durationSeconds", 300},
+			{"pattern", "random"},
+			{"tickMs", 1000},
+			{"chatIntervalSeconds", 30},
+			{"combatIntervalSeconds", 0},
+			{"combatCommand", "attack"},
+			{"combatRange", 5.0},
+			{"responseTimeoutMs", 10000},
+			{"reportIntervalSeconds", 10},
+			{"speed", 5.0},
+			{"walkRadius", 64.0}
+		}},
 		{"actions", JSONSerializationType::array()}
 	};
 
@@ -93,7 +112,18 @@ ClientCoreOptions::ClientCoreOptions(int argc, char** argv) {
 		("options-json", po::value<std::string>(), "Load options from JSON file")
 		("generate-options-json", po::value<std::string>(), "Generate options JSON to file and exit")
 		("env", po::value<std::string>(), "Environment file to load")
-		("wait-after-zone", po::value<int>(), "Seconds to stay connected to zone before shutdown");
+		("wait-after-zone", po::value<int>(), "Seconds to stay connected to zone before shutdown")
+		("swarm", po::value<int>(), "Run N simulated clients on accounts <username><index> (or {index} in --username)")
+		("swarm-first", po::value<int>(), "Index of the first swarm account")
+		("swarm-ramp", po::value<double>(), "Swarm logins started per second")
+		("swarm-login-threads", po::value<int>(), "Swarm logins running at once")
+		("swarm-threads", po::value<int>(), "Task manager worker threads driving the swarm")
+		("swarm-duration", po::value<int>(), "Seconds to run the swarm after the ramp up")
+		("swarm-pattern", po::value<std::string>(), "Swarm movement: random, crowd or travel")
+		("swarm-tick", po::value<int>(), "Milliseconds between movement updates of a bot")
+		("swarm-chat-interval", po::value<int>(), "Seconds between spatial chats of a bot (0 disables)")
+		("swarm-combat-interval", po::value<int>(), "Seconds between combat commands of a bot (0 disables)")
+		("swarm-report-interval", po::value<int>(), "Seconds between swarm reports");
 
 	po::variables_map vm;
 	auto parsed = po::command_line_parser(argc, argv).options(desc).allow_unregistered().run();
@@ -171,6 +201,17 @@ ClientCoreOptions::ClientCoreOptions(int argc, char** argv) {
 	if (vm.count("save-state")) config["saveState"] = vm["save-state"].as<std::string>();
 	if (vm.count("login-only")) config["loginOnly"] = true;
 	if (vm.count("wait-after-zone")) config["waitAfterZone"] = vm["wait-after-zone"].as<int>();
+	if (vm.count("swarm")) config["swarm"]["count"] = vm["swarm"].as<int>();
+	if (vm.count("swarm-first")) config["swarm"]["firstIndex"] = vm["swarm-first"].as<int>();
+	if (vm.count("swarm-ramp")) config["swarm"]["rampPerSecond"] = vm["swarm-ramp"].as<double>();
+	if (vm.count("swarm-login-threads")) config["swarm"]["loginThreads"] = vm["swarm-login-threads"].as<int>();
+	if (vm.count("swarm-threads")) config["swarm"]["threads"] = vm["swarm-threads"].as<int>();
+	if (vm.count("swarm-duration")) config["swarm"]["durationSeconds"] = vm["swarm-duration"].as<int>();
+	if (vm.count("swarm-pattern")) config["swarm"]["pattern"] = vm["swarm-pattern"].as<std::string>();
+	if (vm.count("swarm-tick")) config["swarm"]["tickMs"] = vm["swarm-tick"].as<int>();
+	if (vm.count("swarm-chat-interval")) config["swarm"]["chatIntervalSeconds"] = vm["swarm-chat-interval"].as<int>();
+	if (vm.count("swarm-combat-interval")) config["swarm"]["combatIntervalSeconds"] = vm["swarm-combat-interval"].as<int>();
+	if (vm.count("swarm-report-interval")) config["swarm"]["reportIntervalSeconds"] = vm["swarm-report-interval"].as<int>();
 
 	// Store generate filename for later (need to resolve actions first)
 	std::string generateFile = vm.count("generate-options-json") ? vm["generate-options-json"].as<std::string>() : "";
@@ -229,12 +270,9 @@ ClientCoreOptions::ClientCoreOptions(int argc, char** argv) {
 
 ClientCore::ClientCore(const ClientCoreOptions& opts) : Core("log/core3client.log", "client3"), Logger("CoreClient") {
 	options = opts;
-	zone = nullptr;
-	selectedCharacterOid = 0;
-	targetCharacterOid = 0;
-	targetGalaxyId = 0;
 
-	vars = JSONSerializationType::object();  // Initialize as empty JSON object
+	username = String(options.config["username"].get<std::string>().c_str());
+	password = String(options.config["password"].get<std::string>().c_str());
 
 	overallStartTime.updateToCurrentTime();
 
@@ -330,6 +368,26 @@ void ClientCoreOptions::resolveDependencies() {
 		}
 	}
 
+	// Swarm bots need a character in the scene to simulate
+	if (get<int>("/swarm/count", 0) > 0) {
+		bool zonesIn = false;
+
+		for (int i = 0; i < actions.size(); i++) {
+			const char* name = actions.get(i)->getName();
+
+			if (strcmp(name, "zoneInCharacter") == 0 || strcmp(name, "createCharacter") == 0) {
+				zonesIn = true;
+			}
+		}
+
+		if (!zonesIn) {
+			ActionBase* zoneIn = ActionManager::createAction("zoneInCharacter");
+			if (zoneIn != nullptr) {
+				actions.add(zoneIn);
+			}
+		}
+	}
+
 	// Walk actions and auto-insert required dependencies
 	Vector<ActionBase*> final;
 	bool hasLoginAccount = false;
@@ -436,6 +494,17 @@ void ClientCore::run() {
 		return;
 	}
 
+	if (options.get<int>("/swarm/count", 0) > 0) {
+		SwarmManager swarm(options);
+		exit_result = swarm.run();
+
+		for (int i = 0; i < options.actions.size(); i++) {
+			delete options.actions.get(i);
+		}
+
+		return;
+	}
+
 	executeActions();
 
 	if (exit_result == 1) {
@@ -684,6 +753,11 @@ int main(int argc, char* argv[]) {
 		Core::setProperty("TaskManager.defaultWorkerQueues", "1");
 		Core::setProperty("TaskManager.defaultWorkerThreadsPerQueue", "2");
 
+		// Swarm bots and their zone packets all run on the workers
+		if (opts.get<int>("/swarm/count", 0) > 0) {
+			Core::setProperty("TaskManager.defaultWorkerThreadsPerQueue", String::valueOf(opts.get<int>("/swarm/threads", 8)));
+		}
+
 		ClientCore core(opts);
 		core.start();
 		System::out << "core.start() returned" << endl;
@@ -7,6 +7,7 @@
 
 #include "system/lang.h"
 #include "server/login/objects/GalaxyList.h"
+#include "ClientSession.h"
 
 class Zone;
 class ActionBase;
@@ -49,15 +50,9 @@ private:
 	void resolveDependencies();
 };
 
-class ClientCore : public Core, public Logger {
+class ClientCore : public Core, public Logger, public ClientSession {
 public:
 	ClientCoreOptions options;
-	Reference<class LoginSession*> loginSession;
-	Zone* zone;
-	JSONSerializationType vars;  // Unified storage for dynamic data (async responses, user vars, etc.)
-	uint64 selectedCharacterOid;  // Which character we're playing as (set by zoneInCharacter, confirmed by server)
-	uint64 targetCharacterOid;    // Target character for operations (set by selectContext)
-	uint32 targetGalaxyId;        // Target galaxy (set by selectContext)
 
 private:
 	Time overallStartTime;
@@ -132,75 +127,6 @@ public:
 
 	void executeActions();
 
-	// ===== Variable Storage (JSON-backed) =====
-
-	template<typename T>
-	void setVar(const String& path, T value) {
-		String jsonPath = "/" + path;
-		vars[JSONSerializationType::json_pointer(jsonPath.toCharArray())] = value;
-	}
-
-	// String specialization (convert to std::string for JSON)
-	void setVar(const String& path, const String& value) {
-		String jsonPath = "/" + path;
-		vars[JSONSerializationType::json_pointer(jsonPath.toCharArray())] = value.toCharArray();
-	}
-
-	template<typename T>
-	T getVar(const String& path, T defaultVal = T()) const {
-		try {
-			String jsonPath = "/" + path;
-			return vars.at(JSONSerializationType::json_pointer(jsonPath.toCharArray())).get<T>();
-		} catch (...) {
-			return defaultVal;
-		}
-	}
-
-	// String specialization (JSON uses std::string)
-	String getVar(const String& path, const String& defaultVal) const {
-		try {
-			String jsonPath = "/" + path;
-			std::string val = vars.at(JSONSerializationType::json_pointer(jsonPath.toCharArray())).get<std::string>();
-			return String(val.c_str());
-		} catch (...) {
-			return defaultVal;
-		}
-	}
-
-	bool hasVar(const String& path) const {
-		try {
-			String jsonPath = "/" + path;
-			vars.at(JSONSerializationType::json_pointer(jsonPath.toCharArray()));
-			return true;
-		} catch (...) {
-			return false;
-		}
-	}
-
-	String substituteVars(const String& input) const {
-		String result = input;
-
-		// Iterate over JSON object keys
-		if (vars.is_object()) {
-			for (auto it = vars.begin(); it != vars.end(); ++it) {
-				String key(it.key().c_str());
-				String value;
-
-				// Convert value to string for substitution
-				if (it.value().is_string()) {
-					value = String(it.value().get<std::string>().c_str());
-				} else {
-					value = String(it.value().dump().c_str());
-				}
-
-				String pattern = "{" + key + "}";
-				result = result.replaceAll(pattern, value);
-			}
-		}
-
-		return result;
-	}
-
 private:
 	void saveStateToFile(const String& filename, class LoginSession* loginSession);
 };
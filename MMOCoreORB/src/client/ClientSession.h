@@ -0,0 +1,124 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef CLIENTSESSION_H_
+#define CLIENTSESSION_H_
+
+#include "system/lang.h"
+#include "engine/util/JSONSerializationType.h"
+
+class Zone;
+
+/**
+ * State of one account played by the client: the login and zone connections,
+ * the selected context and the responses stored by the packet handlers.
+ *
+ * ClientCore is the session of a single scripted run, the swarm mode owns one
+ * per simulated client so the same actions drive all of them.
+ */
+class ClientSession {
+public:
+	String username;
+	String password;
+	Reference<class LoginSession*> loginSession;
+	Zone* zone;
+	JSONSerializationType vars;  // Unified storage for dynamic data (async responses, user vars, etc.)
+	uint64 selectedCharacterOid;  // Which character we're playing as (set by zoneInCharacter, confirmed by server)
+	uint64 targetCharacterOid;    // Target character for operations (set by selectContext)
+	uint32 targetGalaxyId;        // Target galaxy (set by selectContext)
+
+public:
+	ClientSession() : zone(nullptr), selectedCharacterOid(0), targetCharacterOid(0), targetGalaxyId(0) {
+		vars = JSONSerializationType::object();  // Initialize as empty JSON object
+	}
+
+	virtual ~ClientSession() {
+	}
+
+	// ===== Zone Notifications =====
+
+	/**
+	 * Called by the zone packet handler when the server removes a command the
+	 * session enqueued from its command queue.
+	 */
+	virtual void commandQueueRemoved(uint32 actionCount, float timer, uint32 errorType, uint32 errorAction) {
+	}
+
+	/**
+	 * Called by the zone packet handler for every spatial chat message heard by the character.
+	 */
+	virtual void spatialChatReceived(uint64 senderID, const UnicodeString& message) {
+	}
+
+	// ===== Variable Storage (JSON-backed) =====
+
+	template<typename T>
+	void setVar(const String& path, T value) {
+		String jsonPath = "/" + path;
+		vars[JSONSerializationType::json_pointer(jsonPath.toCharArray())] = value;
+	}
+
+	// String specialization (convert to std::string for JSON)
+	void setVar(const String& path, const String& value) {
+		String jsonPath = "/" + path;
+		vars[JSONSerializationType::json_pointer(jsonPath.toCharArray())] = value.toCharArray();
+	}
+
+	template<typename T>
+	T getVar(const String& path, T defaultVal = T()) const {
+		try {
+			String jsonPath = "/" + path;
+			return vars.at(JSONSerializationType::json_pointer(jsonPath.toCharArray())).get<T>();
+		} catch (...) {
+			return defaultVal;
+		}
+	}
+
+	// String specialization (JSON uses std::string)
+	String getVar(const String& path, const String& defaultVal) const {
+		try {
+			String jsonPath = "/" + path;
+			std::string val = vars.at(JSONSerializationType::json_pointer(jsonPath.toCharArray())).get<std::string>();
+			return String(val.c_str());
+		} catch (...) {
+			return defaultVal;
+		}
+	}
+
+	bool hasVar(const String& path) const {
+		try {
+			String jsonPath = "/" + path;
+			vars.at(JSONSerializationType::json_pointer(jsonPath.toCharArray()));
+			return true;
+		} catch (...) {
+			return false;
+		}
+	}
+
+	String substituteVars(const String& input) const {
+		String result = input;
+
+		// Iterate over JSON object keys
+		if (vars.is_object()) {
+			for (auto it = vars.begin(); it != vars.end(); ++it) {
+				String key(it.key().c_str());
+				String value;
+
+				// Convert value to string for substitution
+				if (it.value().is_string()) {
+					value = String(it.value().get<std::string>().c_str());
+				} else {
+					value = String(it.value().dump().c_str());
+				}
+
+				String pattern = "{" + key + "}";
+				result = result.replaceAll(pattern, value);
+			}
+		}
+
+		return result;
+	}
+};
+
+#endif /* CLIENTSESSION_H_ */
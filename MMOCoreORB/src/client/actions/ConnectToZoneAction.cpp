@@ -49,21 +49,21 @@ public:
 		return false;  // Target is optional - falls back to first galaxy
 	}
 
-	void run(ClientCore& core) override {
+	void run(ClientSession& session) override {
 		// Validate prerequisites
-		if (core.loginSession == nullptr || !core.loginSession->isLoggedIn()) {
+		if (session.loginSession == nullptr || !session.loginSession->isLoggedIn()) {
 			result.setError("No active login session", 1);
 			return;
 		}
 
 		// Cleanup login connection
-		if (core.loginSession->isConnected()) {
+		if (session.loginSession->isConnected()) {
 			info() << "Cleaning up login connection...";
-			core.loginSession->cleanup();
+			session.loginSession->cleanup();
 		}
 
 		// Get target galaxy (from selectContext or default to first)
-		auto& galaxyMap = core.loginSession->getGalaxies();
+		auto& galaxyMap = session.loginSession->getGalaxies();
 		if (galaxyMap.size() == 0) {
 			result.setError("No galaxies available", 2);
 			return;
@@ -73,13 +73,13 @@ public:
 		Galaxy galaxy;
 		bool found = false;
 
-		if (core.targetGalaxyId != 0) {
-			galaxy = core.loginSession->getGalaxy(core.targetGalaxyId);
+		if (session.targetGalaxyId != 0) {
+			galaxy = session.loginSession->getGalaxy(session.targetGalaxyId);
 			if (!galaxy.getAddress().isEmpty()) {
 				found = true;
-				info() << "Using target galaxy: " << galaxy.getName() << " (ID: " << core.targetGalaxyId << ")";
+				info() << "Using target galaxy: " << galaxy.getName() << " (ID: " << session.targetGalaxyId << ")";
 			} else {
-				warning() << "Target galaxy " << core.targetGalaxyId << " not found, using first galaxy";
+				warning() << "Target galaxy " << session.targetGalaxyId << " not found, using first galaxy";
 			}
 		}
 
@@ -98,16 +98,16 @@ public:
 
 		// Create and start zone connection (just socket, no packets)
 		// SelectCharacterAction or CreateCharacterAction will handle character selection
-		uint32 accountId = core.loginSession->getAccountID();
-		const String& sessionId = core.loginSession->getSessionID();
+		uint32 accountId = session.loginSession->getAccountID();
+		const String& sessionId = session.loginSession->getSessionID();
 
-		core.zone = new Zone(&core, accountId, sessionId, galaxy.getAddress(), galaxy.getPort());
-		core.zone->start();
+		session.zone = new Zone(&session, accountId, sessionId, galaxy.getAddress(), galaxy.getPort());
+		session.zone->start();
 
 		// Wait briefly for connection to establish
 		Thread::sleep(100);
 
-		if (!core.zone->isConnected()) {
+		if (!session.zone->isConnected()) {
 			result.setError("Zone connection failed", 4);
 			return;
 		}
@@ -160,14 +160,14 @@ public:
 		return true;  // Needs targetGalaxyId to know where to create
 	}
 
-	void run(ClientCore& core) override {
+	void run(ClientSession& session) override {
 		// Warn if targetCharacterOid is set (we're creating new, not using existing)
-		if (core.targetCharacterOid != 0) {
-			warning() << "Ignoring selected character OID " << core.targetCharacterOid
+		if (session.targetCharacterOid != 0) {
+			warning() << "Ignoring selected character OID " << session.targetCharacterOid
 			          << " (createCharacter creates new character)";
 		}
 		// Validate prerequisites
-		if (core.zone == nullptr || !core.zone->isConnected()) {
+		if (session.zone == nullptr || !session.zone->isConnected()) {
 			result.setError("No active zone connection", 1);
 			return;
 		}
@@ -194,15 +194,15 @@ public:
 			info() << "No character name specified, requesting random name from server...";
 
 			BaseMessage* randomNameReq = new ClientRandomNameRequestPacket(charRace);
-			core.zone->getZoneClient()->sendMessage(randomNameReq);
+			session.zone->getZoneClient()->sendMessage(randomNameReq);
 
-			if (!core.zone->waitFor(STRING_HASHCODE("ClientRandomNameResponse"), 5000)) {
+			if (!session.zone->waitFor(STRING_HASHCODE("ClientRandomNameResponse"), 5000)) {
 				result.setError("Timeout waiting for random name from server", 5);
 				return;
 			}
 
 			String defaultName("");
-			charName = core.getVar("ClientRandomNameResponse/name", defaultName);
+			charName = session.getVar("ClientRandomNameResponse/name", defaultName);
 
 			if (charName.isEmpty()) {
 				result.setError("Server did not provide a valid name", 6);
@@ -246,7 +246,7 @@ public:
 			!skipTutorial  // Note: inverted
 		);
 
-		core.zone->getZoneClient()->sendMessage(createPacket);
+		session.zone->getZoneClient()->sendMessage(createPacket);
 
 		// Wait for one of three possible responses
 		uint32 responses[] = {
@@ -255,38 +255,38 @@ public:
 			STRING_HASHCODE("ErrorMessage")
 		};
 
-		if (!core.zone->waitForAny(responses, 3, 30000)) {
+		if (!session.zone->waitForAny(responses, 3, 30000)) {
 			result.setError("Character creation timeout", 5);
 			return;
 		}
 
 		// Check which response we got
-		if (core.hasVar("ClientCreateCharacterSuccess/oid")) {
+		if (session.hasVar("ClientCreateCharacterSuccess/oid")) {
 			// Success!
-			uint64 createdOid = core.getVar<uint64>("ClientCreateCharacterSuccess/oid", 0);
+			uint64 createdOid = session.getVar<uint64>("ClientCreateCharacterSuccess/oid", 0);
 			result.setSuccess();
 			result.setCreatedCharacter(createdOid, charName);
 
 			// Set selected character OID so scene handler knows what character we're becoming
-			core.selectedCharacterOid = createdOid;
+			session.selectedCharacterOid = createdOid;
 
 			// Store for other actions
-			core.setVar("createdOid", createdOid);
-			core.setVar("createdCharacterName", charName);
+			session.setVar("createdOid", createdOid);
+			session.setVar("createdCharacterName", charName);
 
 			info() << "Character created successfully - OID: " << createdOid;
 			return;
 		}
 
-		if (core.hasVar("ClientCreateCharacterFailed/errorCode")) {
+		if (session.hasVar("ClientCreateCharacterFailed/errorCode")) {
 			String defaultError("unknown");
-			String errorCode = core.getVar("ClientCreateCharacterFailed/errorCode", defaultError);
+			String errorCode = session.getVar("ClientCreateCharacterFailed/errorCode", defaultError);
 			result.setError("Character creation failed: " + errorCode, 3);
 			return;
 		}
 
-		if (!core.zone->getLastError().isEmpty()) {
-			result.setError("Character creation error: " + core.zone->getLastError(), 4);
+		if (!session.zone->getLastError().isEmpty()) {
+			result.setError("Character creation error: " + session.zone->getLastError(), 4);
 			return;
 		}
 
@@ -42,24 +42,21 @@ public:
 		return new LoginAccountAction();
 	}
 
-	void run(ClientCore& core) override {
-		String username = String(core.options.config["username"].get<std::string>().c_str());
-		String password = String(core.options.config["password"].get<std::string>().c_str());
-
-		info() << "Authenticating account: " << username;
+	void run(ClientSession& session) override {
+		info() << "Authenticating account: " << session.username;
 
 		// Create and run login session
-		core.loginSession = new LoginSession(username, password);
-		core.loginSession->run();
+		session.loginSession = new LoginSession(session.username, session.password, &session);
+		session.loginSession->run();
 
 		// Check if authentication succeeded
-		if (!core.loginSession->isLoggedIn()) {
+		if (!session.loginSession->isLoggedIn()) {
 			result.setError(
-				core.loginSession->getLastError().isEmpty()
+				session.loginSession->getLastError().isEmpty()
 					? "Login failed - no account ID received"
-					: core.loginSession->getLastError(),
-				core.loginSession->getLastErrorCode() != 0
-					? core.loginSession->getLastErrorCode()
+					: session.loginSession->getLastError(),
+				session.loginSession->getLastErrorCode() != 0
+					? session.loginSession->getLastErrorCode()
 					: 2
 			);
 			return;
@@ -68,9 +65,9 @@ public:
 		// Success - store account info in result
 		result.setSuccess();
 		result.setAccountInfo(
-			core.loginSession->getAccountID(),
-			core.loginSession->getSessionID(),
-			core.loginSession->getCharacterListSize()
+			session.loginSession->getAccountID(),
+			session.loginSession->getSessionID(),
+			session.loginSession->getCharacterListSize()
 		);
 
 		info() << "Authentication successful - Account ID: " << result.getAccountId()
@@ -48,8 +48,8 @@ public:
 		return true;  // Must be zoned in as a character
 	}
 
-	void run(ClientCore& core) override {
-		if (core.zone == nullptr || !core.zone->isStarted()) {
+	void run(ClientSession& session) override {
+		if (session.zone == nullptr || !session.zone->isStarted()) {
 			// No zone connection, nothing to logout from
 			result.setSuccess();
 			return;
@@ -58,7 +58,7 @@ public:
 		info() << "Logging out from zone...";
 
 		// Disconnect from zone to stop receiving new packets
-		core.zone->disconnect();
+		session.zone->disconnect();
 
 		// Wait for already-queued tasks to complete processing
 		auto taskManager = Core::getTaskManager();
@@ -76,7 +76,7 @@ public:
 			Thread::sleep(50);
 		}
 
-		info() << "Processed " << core.zone->getZoneClient()->getPacketCount() << " total zone packets";
+		info() << "Processed " << session.zone->getZoneClient()->getPacketCount() << " total zone packets";
 
 		result.setSuccess();
 		info() << "Logout complete";
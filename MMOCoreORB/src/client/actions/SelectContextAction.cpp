@@ -2,7 +2,7 @@
  * SelectContextAction.cpp
  *
  * Selects the target context (character + galaxy) for subsequent operations
- * Stores selection in core.targetCharacterOid and core.targetGalaxyId
+ * Stores selection in session.targetCharacterOid and session.targetGalaxyId
  */
 
 #include "client/ActionBase.h"
@@ -112,8 +112,8 @@ public:
 		return false;  // Login-phase metadata selection
 	}
 
-	void run(ClientCore& core) override {
-		if (core.loginSession == nullptr || !core.loginSession->isLoggedIn()) {
+	void run(ClientSession& session) override {
+		if (session.loginSession == nullptr || !session.loginSession->isLoggedIn()) {
 			result.setError("No active login session", 1);
 			return;
 		}
@@ -126,7 +126,7 @@ public:
 			resolvedGalaxyId = galaxyId;
 		} else if (!galaxyName.isEmpty()) {
 			// Galaxy by name
-			auto& galaxies = core.loginSession->getGalaxies();
+			auto& galaxies = session.loginSession->getGalaxies();
 			bool found = false;
 			for (int i = 0; i < galaxies.size(); i++) {
 				if (galaxies.get(i).getName() == galaxyName) {
@@ -146,7 +146,7 @@ public:
 
 		if (characterOid != 0) {
 			// Explicit character OID
-			auto character = core.loginSession->selectCharacterByOID(characterOid);
+			auto character = session.loginSession->selectCharacterByOID(characterOid);
 			if (!character) {
 				result.setError("Character OID not found", 3);
 				return;
@@ -166,7 +166,7 @@ public:
 
 		} else if (!characterFirstname.isEmpty()) {
 			// Character by firstname
-			auto character = core.loginSession->selectCharacterByFirstname(characterFirstname);
+			auto character = session.loginSession->selectCharacterByFirstname(characterFirstname);
 			if (!character) {
 				result.setError("Character firstname not found: " + characterFirstname, 5);
 				return;
@@ -186,9 +186,9 @@ public:
 
 		} else {
 			// Default: pick first/random character (if any exist)
-			auto numCharacters = core.loginSession->getCharacterListSize();
+			auto numCharacters = session.loginSession->getCharacterListSize();
 			if (numCharacters > 0) {
-				auto character = core.loginSession->selectRandomCharacter();
+				auto character = session.loginSession->selectRandomCharacter();
 				if (character) {
 					resolvedCharacterOid = character->getObjectID();
 					uint32 charGalaxyId = character->getGalaxyID();
@@ -205,7 +205,7 @@ public:
 
 		// If still no galaxy, pick first available
 		if (resolvedGalaxyId == 0) {
-			auto& galaxies = core.loginSession->getGalaxies();
+			auto& galaxies = session.loginSession->getGalaxies();
 			if (galaxies.size() > 0) {
 				resolvedGalaxyId = galaxies.get(0).getID();
 				info() << "Auto-selected galaxy: " << galaxies.get(0).getName() << " (ID: " << resolvedGalaxyId << ")";
@@ -217,23 +217,23 @@ public:
 
 		// Store resolved context (merge with any previous selectContext calls)
 		if (resolvedGalaxyId != 0) {
-			if (core.targetGalaxyId != 0 && core.targetGalaxyId != resolvedGalaxyId) {
-				warning() << "Changing target galaxy from " << core.targetGalaxyId << " to " << resolvedGalaxyId;
+			if (session.targetGalaxyId != 0 && session.targetGalaxyId != resolvedGalaxyId) {
+				warning() << "Changing target galaxy from " << session.targetGalaxyId << " to " << resolvedGalaxyId;
 			}
-			core.targetGalaxyId = resolvedGalaxyId;
+			session.targetGalaxyId = resolvedGalaxyId;
 			galaxyId = resolvedGalaxyId;  // Store in action for toJSON()
 		}
 
 		if (resolvedCharacterOid != 0) {
-			if (core.targetCharacterOid != 0 && core.targetCharacterOid != resolvedCharacterOid) {
-				warning() << "Changing target character from " << core.targetCharacterOid << " to " << resolvedCharacterOid;
+			if (session.targetCharacterOid != 0 && session.targetCharacterOid != resolvedCharacterOid) {
+				warning() << "Changing target character from " << session.targetCharacterOid << " to " << resolvedCharacterOid;
 			}
-			core.targetCharacterOid = resolvedCharacterOid;
+			session.targetCharacterOid = resolvedCharacterOid;
 			characterOid = resolvedCharacterOid;  // Store in action for toJSON()
 		}
 
 		result.setSuccess();
-		info() << "Context selected - Galaxy: " << core.targetGalaxyId << ", Character: " << core.targetCharacterOid;
+		info() << "Context selected - Galaxy: " << session.targetGalaxyId << ", Character: " << session.targetCharacterOid;
 	}
 
 	bool isOK() const override {
@@ -2,7 +2,7 @@
  * ZoneInCharacterAction.cpp
  *
  * Zones in as the target character (sends SelectCharacter packet, waits for scene)
- * Uses core.targetCharacterOid from selectContext
+ * Uses session.targetCharacterOid from selectContext
  * Requires active zone connection
  */
 
@@ -43,7 +43,7 @@ public:
 	}
 
 	static ActionBase* fromJSON(const JSONSerializationType& config) {
-		// ZoneInCharacter has no configuration - uses core.targetCharacterOid
+		// ZoneInCharacter has no configuration - uses session.targetCharacterOid
 		return new ZoneInCharacterAction();
 	}
 
@@ -51,30 +51,30 @@ public:
 		return true;  // Requires targetCharacterOid from selectContext
 	}
 
-	void run(ClientCore& core) override {
+	void run(ClientSession& session) override {
 		// Validate prerequisites
-		if (core.zone == nullptr || !core.zone->isConnected()) {
+		if (session.zone == nullptr || !session.zone->isConnected()) {
 			result.setError("No zone connection", 1);
 			return;
 		}
 
-		if (core.targetCharacterOid == 0) {
+		if (session.targetCharacterOid == 0) {
 			result.setError("No target character selected (need selectContext first)", 2);
 			return;
 		}
 
 		// Use target from selectContext
-		uint64 oid = core.targetCharacterOid;
-		core.selectedCharacterOid = oid;  // Track which character we're playing as
+		uint64 oid = session.targetCharacterOid;
+		session.selectedCharacterOid = oid;  // Track which character we're playing as
 
 		// Send SelectCharacter packet
 		info() << "Zoning in as character OID: " << oid;
 		BaseMessage* selectMsg = new SelectCharacter(oid);
-		core.zone->getZoneClient()->sendMessage(selectMsg);
+		session.zone->getZoneClient()->sendMessage(selectMsg);
 
 		// Wait for scene to be ready
 		int zoneTimeout = ClientCore::getZoneTimeout() * 1000;
-		if (!core.zone->waitForSceneReady(zoneTimeout)) {
+		if (!session.zone->waitForSceneReady(zoneTimeout)) {
 			result.setError("Zone scene timeout", 3);
 			return;
 		}
@@ -31,7 +31,7 @@ LoginClient::~LoginClient() {
 }
 
 void LoginClient::initialize() {
-	loginPacketHandler = new LoginPacketHandler(loginSession, ClientCore::getCoreInstance());
+	loginPacketHandler = new LoginPacketHandler(loginSession, loginSession->getClientSession());
 
 	client->setHandler(this);
 	client->initialize();
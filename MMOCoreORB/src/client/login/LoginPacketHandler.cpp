@@ -85,9 +85,9 @@ void LoginPacketHandler::handleErrorMessage(Message* pack) {
 	error() << "Login ERROR: " << errorType << " - " << errorMessage ;
 
 	// Store in vars
-	core->setVar("ErrorMessage/type", errorType);
-	core->setVar("ErrorMessage/message", errorMessage);
-	core->setVar("ErrorMessage/source", "LoginPacketHandler");
+	session->setVar("ErrorMessage/type", errorType);
+	session->setVar("ErrorMessage/message", errorMessage);
+	session->setVar("ErrorMessage/source", "LoginPacketHandler");
 
 	loginSession->signalCompletion();
 }
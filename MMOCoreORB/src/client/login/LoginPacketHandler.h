@@ -14,14 +14,14 @@
 
 class LoginPacketHandler : public Mutex, public Logger {
 	Reference<LoginSession*> loginSession;
-	class ClientCore* core;
+	class ClientSession* session;
 	uint8_t pending_packets;
 
 public:
-	LoginPacketHandler(LoginSession* session, class ClientCore* clientCore) : Logger("LoginPacketHandler") {
+	LoginPacketHandler(LoginSession* login, class ClientSession* clientSession) : Logger("LoginPacketHandler") {
 		pending_packets = 0xF;
-		loginSession = session;
-		core = clientCore;
+		loginSession = login;
+		session = clientSession;
 		setLogLevel(static_cast<Logger::LogLevel>(ClientCore::getLogLevel()));
 	}
 
@@ -14,9 +14,10 @@
 
 #include "ClientCore.h"
 
-LoginSession::LoginSession(const String& username, const String& password) : Logger("LoginSession") {
+LoginSession::LoginSession(const String& username, const String& password, ClientSession* clientSession) : Logger("LoginSession") {
 	LoginSession::username = username;
 	LoginSession::password = password;
+	LoginSession::clientSession = clientSession;
 
 	loginThread = nullptr;
 
@@ -41,9 +42,7 @@ LoginSession::~LoginSession() {
 }
 
 void LoginSession::run() {
-	// Load config properties
-	Core::initializeProperties("Client3");
-
+	// Config properties are loaded once by ClientCore, swarm bots log in concurrently
 	String loginHost = ClientCore::getLoginHost();
 	int loginPort = ClientCore::getLoginPort();
 
@@ -16,6 +16,7 @@
 #include "server/login/objects/CharacterListEntry.h"
 
 class LoginClient;
+class ClientSession;
 
 class LoginSession : public Mutex, public Runnable, public Logger, public Object {
 	Condition sessionFinalized;
@@ -25,6 +26,8 @@ class LoginSession : public Mutex, public Runnable, public Logger, public Object
 	String username;
 	String password;
 
+	ClientSession* clientSession;
+
 	Vector<CharacterListEntry> characters;
 
 	class LoginClientThread* loginThread;
@@ -42,7 +45,7 @@ class LoginSession : public Mutex, public Runnable, public Logger, public Object
 	VectorMap<uint32, Condition*> waitConditions;
 
 public:
-	LoginSession(const String& username, const String& password);
+	LoginSession(const String& username, const String& password, ClientSession* clientSession);
 
 	~LoginSession();
 
@@ -66,6 +69,10 @@ public:
 		this->sessionID = sessionID;
 	}
 
+	ClientSession* getClientSession() {
+		return clientSession;
+	}
+
 	uint32 getAccountID() {
 		return accountID;
 	}
@@ -0,0 +1,121 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include <cstdint>
+
+#include "LatencyHistogram.h"
+
+LatencyHistogram::LatencyHistogram() {
+	reset();
+}
+
+void LatencyHistogram::reset() {
+	for (int i = 0; i < BUCKETS; ++i) {
+		counts[i].store(0, std::memory_order_relaxed);
+	}
+
+	total.store(0, std::memory_order_relaxed);
+	sum.store(0, std::memory_order_relaxed);
+	minimum.store(UINT64_MAX, std::memory_order_relaxed);
+	maximum.store(0, std::memory_order_relaxed);
+}
+
+int LatencyHistogram::getBucket(uint64 value) {
+	if (value < (uint64) SUB_BUCKETS)
+		return (int) value;
+
+	int exponent = 63 - __builtin_clzll(value);
+
+	if (exponent > MAX_EXPONENT)
+		return BUCKETS - 1;
+
+	int subBucket = (int) (value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+
+	return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + subBucket;
+}
+
+uint64 LatencyHistogram::getBucketLowerBound(int bucket) {
+	if (bucket < SUB_BUCKETS)
+		return bucket;
+
+	int exponent = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+	int subBucket = bucket % SUB_BUCKETS;
+
+	return (uint64) (SUB_BUCKETS + subBucket) << (exponent - SUB_BUCKET_BITS);
+}
+
+uint64 LatencyHistogram::getBucketUpperBound(int bucket) {
+	if (bucket < SUB_BUCKETS)
+		return bucket;
+
+	int exponent = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+
+	return getBucketLowerBound(bucket) + (1ULL << (exponent - SUB_BUCKET_BITS)) - 1;
+}
+
+void LatencyHistogram::record(uint64 microseconds) {
+	counts[getBucket(microseconds)].fetch_add(1, std::memory_order_relaxed);
+
+	total.fetch_add(1, std::memory_order_relaxed);
+	sum.fetch_add(microseconds, std::memory_order_relaxed);
+
+	uint64 current = minimum.load(std::memory_order_relaxed);
+
+	while (microseconds < current && !minimum.compare_exchange_weak(current, microseconds, std::memory_order_relaxed))
+		;
+
+	current = maximum.load(std::memory_order_relaxed);
+
+	while (microseconds > current && !maximum.compare_exchange_weak(current, microseconds, std::memory_order_relaxed))
+		;
+}
+
+uint64 LatencyHistogram::getMin() const {
+	uint64 value = minimum.load(std::memory_order_relaxed);
+
+	return value == UINT64_MAX ? 0 : value;
+}
+
+double LatencyHistogram::getMean() const {
+	uint64 count = getCount();
+
+	if (count == 0)
+		return 0;
+
+	return (double) sum.load(std::memory_order_relaxed) / count;
+}
+
+uint64 LatencyHistogram::getPercentile(double percentile) const {
+	uint64 count = getCount();
+
+	if (count == 0)
+		return 0;
+
+	uint64 rank = Math::max((uint64) 1, (uint64) ceil(count * percentile / 100.0));
+	uint64 seen = 0;
+
+	for (int i = 0; i < BUCKETS; ++i) {
+		seen += counts[i].load(std::memory_order_relaxed);
+
+		if (seen >= rank)
+			return Math::min(getBucketUpperBound(i), getMax());
+	}
+
+	return getMax();
+}
+
+JSONSerializationType LatencyHistogram::toJSON() const {
+	JSONSerializationType json;
+
+	json["count"] = getCount();
+	json["minMs"] = getMin() / 1000.0;
+	json["meanMs"] = getMean() / 1000.0;
+	json["p50Ms"] = getPercentile(50) / 1000.0;
+	json["p90Ms"] = getPercentile(90) / 1000.0;
+	json["p99Ms"] = getPercentile(99) / 1000.0;
+	json["p999Ms"] = getPercentile(99.9) / 1000.0;
+	json["maxMs"] = getMax() / 1000.0;
+
+	return json;
+}
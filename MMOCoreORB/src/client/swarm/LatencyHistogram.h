@@ -0,0 +1,71 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef LATENCYHISTOGRAM_H_
+#define LATENCYHISTOGRAM_H_
+
+#include <atomic>
+
+#include "system/lang.h"
+#include "engine/util/JSONSerializationType.h"
+
+/**
+ * Lock free histogram of durations in microseconds, recorded from the packet
+ * handler tasks of every bot of the swarm at once.
+ *
+ * Buckets are log-linear: exact below 8us, then 8 buckets per power of two so
+ * any percentile is reported within 12.5% of the recorded value.
+ */
+class LatencyHistogram {
+public:
+	static const int SUB_BUCKET_BITS = 3;
+	static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+	static const int MAX_EXPONENT = 36; // ~19 hours
+	static const int BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+private:
+	std::atomic<uint64> counts[BUCKETS];
+
+	std::atomic<uint64> total;
+	std::atomic<uint64> sum;
+	std::atomic<uint64> minimum;
+	std::atomic<uint64> maximum;
+
+	static int getBucket(uint64 value);
+
+	static uint64 getBucketLowerBound(int bucket);
+	static uint64 getBucketUpperBound(int bucket);
+
+public:
+	LatencyHistogram();
+
+	void record(uint64 microseconds);
+
+	void reset();
+
+	uint64 getCount() const {
+		return total.load(std::memory_order_relaxed);
+	}
+
+	uint64 getMin() const;
+
+	uint64 getMax() const {
+		return maximum.load(std::memory_order_relaxed);
+	}
+
+	double getMean() const;
+
+	/**
+	 * @param percentile 0 to 100
+	 * @return upper bound of the bucket holding the percentile, 0 if nothing was recorded
+	 */
+	uint64 getPercentile(double percentile) const;
+
+	/**
+	 * Count, min, mean, max and the usual percentiles in milliseconds.
+	 */
+	JSONSerializationType toJSON() const;
+};
+
+#endif /* LATENCYHISTOGRAM_H_ */
@@ -0,0 +1,352 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "SwarmBot.h"
+#include "SwarmManager.h"
+
+#include "client/ClientCore.h"
+#include "client/ActionBase.h"
+#include "client/zone/Zone.h"
+#include "client/login/LoginSession.h"
+#include "client/zone/packets/ClientDataTransformPacket.h"
+#include "client/zone/packets/ClientCommandQueueEnqueuePacket.h"
+
+SwarmBot::SwarmBot(SwarmManager* manager, int index, const String& username, const String& password) : Task(), ClientSession(), Logger("SwarmBot") {
+	this->manager = manager;
+	this->index = index;
+	this->username = username;
+	this->password = password;
+
+	actions = manager->createActions();
+	shutdownAction = actions.size();
+
+	for (int i = 0; i < actions.size(); ++i) {
+		if (strcmp(actions.get(i)->getName(), "logoutCharacter") == 0) {
+			shutdownAction = i;
+			break;
+		}
+	}
+
+	cityIndex = -1;
+	moveCount = 0;
+	actionCount = 0;
+
+	zoneInTime = 0;
+	lastTickTime = 0;
+	nextChatTime = 0;
+	nextCombatTime = 0;
+
+	active.store(false);
+
+	setLoggingName("SwarmBot " + username);
+	setLogLevel(static_cast<Logger::LogLevel>(ClientCore::getLogLevel()));
+}
+
+SwarmBot::~SwarmBot() {
+	for (int i = 0; i < actions.size(); ++i) {
+		delete actions.get(i);
+	}
+}
+
+bool SwarmBot::connect() {
+	SwarmStats& stats = manager->getStats();
+
+	stats.increment(SwarmStats::LOGINS_STARTED);
+
+	uint64 zoneStart = 0;
+
+	for (int i = 0; i < shutdownAction; ++i) {
+		ActionBase* action = actions.get(i);
+		const char* name = action->getName();
+
+		uint64 start = System::getMikroTime();
+
+		if (strcmp(name, "connectToZone") == 0)
+			zoneStart = start;
+
+		action->run(*this);
+
+		if (!action->isOK()) {
+			error() << name << " failed: " << action->getError();
+
+			for (int j = i + 1; j < shutdownAction; ++j) {
+				actions.get(j)->setSkipped();
+			}
+
+			stats.increment(SwarmStats::LOGINS_FAILED);
+
+			return false;
+		}
+
+		uint64 end = System::getMikroTime();
+
+		if (strcmp(name, "loginAccount") == 0)
+			stats.recordLatency(SwarmStats::LOGIN, end - start);
+		else if (strcmp(name, "zoneInCharacter") == 0 && zoneStart != 0)
+			stats.recordLatency(SwarmStats::ZONE_IN, end - zoneStart);
+	}
+
+	if (zone == nullptr || !zone->isSceneReady()) {
+		warning() << "action chain did not zone in, nothing to simulate";
+		return true;
+	}
+
+	terrain = getVar("CmdStartScene/terrain", String());
+	home = Vector3(getVar<float>("CmdStartScene/x", 0.f), getVar<float>("CmdStartScene/y", 0.f), getVar<float>("CmdStartScene/z", 0.f));
+	position = home;
+
+	stats.increment(SwarmStats::ZONED_IN);
+
+	manager->characterZonedIn(terrain, selectedCharacterOid, home.getX(), home.getY());
+
+	uint64 now = System::getMikroTime();
+
+	zoneInTime = now;
+	lastTickTime = now;
+
+	// Spread the first commands of the bots over their interval
+	nextChatTime = now + System::random(manager->getChatIntervalMs()) * 1000ULL;
+	nextCombatTime = now + System::random(manager->getCombatIntervalMs()) * 1000ULL;
+
+	pickDestination();
+
+	active.store(true);
+
+	schedule(System::random(manager->getTickMs()));
+
+	return true;
+}
+
+void SwarmBot::disconnect() {
+	if (active.exchange(false)) {
+		cancel();
+
+		manager->characterLeft(terrain, selectedCharacterOid);
+	}
+
+	for (int i = shutdownAction; i < actions.size(); ++i) {
+		actions.get(i)->run(*this);
+	}
+
+	if (loginSession != nullptr && loginSession->isConnected()) {
+		loginSession->cleanup();
+	}
+}
+
+void SwarmBot::run() {
+	if (!active.load())
+		return;
+
+	if (zone == nullptr || !zone->isConnected()) {
+		if (active.exchange(false)) {
+			warning() << "lost zone connection";
+
+			manager->getStats().increment(SwarmStats::DISCONNECTS);
+			manager->characterLeft(terrain, selectedCharacterOid);
+		}
+
+		return;
+	}
+
+	uint64 now = System::getMikroTime();
+
+	move(now);
+
+	if (manager->getChatIntervalMs() > 0 && now >= nextChatTime)
+		sendChat(now);
+
+	if (manager->getCombatIntervalMs() > 0 && now >= nextCombatTime)
+		sendCombat(now);
+
+	expirePending(now);
+
+	if (active.load())
+		reschedule(manager->getTickMs());
+}
+
+void SwarmBot::pickDestination() {
+	Vector3 center = home;
+	float radius = manager->getWalkRadius();
+
+	switch (manager->getPattern()) {
+	case SwarmManager::CROWD:
+		center = manager->getCrowdPoint(terrain);
+		radius = 8.f;
+		break;
+
+	case SwarmManager::TRAVEL: {
+		const Vector<Vector3>* cities = manager->getCities(terrain);
+
+		if (cities == nullptr || cities->size() == 0)
+			break;
+
+		int next = System::random(cities->size() - 1);
+
+		if (next == cityIndex && cities->size() > 1)
+			next = (next + 1) % cities->size();
+
+		cityIndex = next;
+		center = cities->get(cityIndex);
+		radius = 4.f;
+		break;
+	}
+
+	default:
+		break;
+	}
+
+	float angle = System::frandom(2 * M_PI);
+	float distance = System::frandom(radius);
+
+	destination = Vector3(center.getX() + cos(angle) * distance, center.getY() + sin(angle) * distance, position.getZ());
+}
+
+void SwarmBot::move(uint64 now) {
+	float seconds = (now - lastTickTime) / 1000000.f;
+	lastTickTime = now;
+
+	float deltaX = destination.getX() - position.getX();
+	float deltaY = destination.getY() - position.getY();
+
+	float distance = sqrt(deltaX * deltaX + deltaY * deltaY);
+	float step = manager->getSpeed() * seconds;
+
+	float heading = atan2(deltaX, deltaY);
+
+	if (distance <= step) {
+		position = Vector3(destination.getX(), destination.getY(), position.getZ());
+
+		pickDestination();
+	} else {
+		position = Vector3(position.getX() + deltaX / distance * step, position.getY() + deltaY / distance * step, position.getZ());
+	}
+
+	uint32 timeStamp = (now - zoneInTime) / 1000;
+
+	BaseMessage* message = new ClientDataTransformPacket(selectedCharacterOid, timeStamp, ++moveCount, heading,
+			position.getX(), position.getZ(), position.getY(), manager->getSpeed());
+	zone->getZoneClient()->sendMessage(message);
+
+	manager->characterMoved(terrain, selectedCharacterOid, position.getX(), position.getY());
+
+	manager->getStats().increment(SwarmStats::MOVES_SENT);
+}
+
+void SwarmBot::sendChat(uint64 now) {
+	String text = manager->getRandomChatMessage().replaceAll("{index}", String::valueOf(index)).replaceAll("{username}", username);
+
+	// target, chat type, mood, flags, language
+	UnicodeString arguments("0 0 0 0 0 " + text);
+
+	uint32 count = getNextActionCount();
+
+	Locker locker(&pendingMutex);
+
+	pendingChats.add(now);
+
+	locker.release();
+
+	zone->getZoneClient()->sendMessage(new ClientCommandQueueEnqueuePacket(selectedCharacterOid, count, "spatialchatinternal", 0, arguments));
+
+	manager->getStats().increment(SwarmStats::CHATS_SENT);
+
+	nextChatTime = now + manager->getChatIntervalMs() * 1000ULL;
+}
+
+void SwarmBot::sendCombat(uint64 now) {
+	nextCombatTime = now + manager->getCombatIntervalMs() * 1000ULL;
+
+	uint64 targetID = manager->getNearbyTarget(terrain, selectedCharacterOid, position.getX(), position.getY());
+
+	if (targetID == 0)
+		return;
+
+	uint32 count = getNextActionCount();
+
+	Locker locker(&pendingMutex);
+
+	pendingCombat.put(count, now);
+
+	locker.release();
+
+	zone->getZoneClient()->sendMessage(new ClientCommandQueueEnqueuePacket(selectedCharacterOid, count, manager->getCombatCommand(), targetID, UnicodeString("")));
+
+	manager->getStats().increment(SwarmStats::COMBAT_SENT);
+}
+
+void SwarmBot::expirePending(uint64 now) {
+	uint64 timeout = manager->getResponseTimeoutMs() * 1000ULL;
+	int expired = 0;
+
+	Locker locker(&pendingMutex);
+
+	while (pendingChats.size() > 0 && now - pendingChats.get(0) > timeout) {
+		pendingChats.remove(0);
+		++expired;
+	}
+
+	for (int i = pendingCombat.size() - 1; i >= 0; --i) {
+		if (now - pendingCombat.elementAt(i).getValue() > timeout) {
+			pendingCombat.remove(i);
+			++expired;
+		}
+	}
+
+	locker.release();
+
+	if (expired > 0)
+		manager->getStats().increment(SwarmStats::RESPONSE_TIMEOUTS, expired);
+}
+
+void SwarmBot::commandQueueRemoved(uint32 actionCount, float timer, uint32 errorType, uint32 errorAction) {
+	uint64 now = System::getMikroTime();
+
+	Locker locker(&pendingMutex);
+
+	int i = pendingCombat.find(actionCount);
+
+	if (i == -1)
+		return;
+
+	uint64 sent = pendingCombat.elementAt(i).getValue();
+	pendingCombat.remove(i);
+
+	locker.release();
+
+	SwarmStats& stats = manager->getStats();
+
+	stats.recordLatency(SwarmStats::COMBAT, now - sent);
+
+	if (errorType != 0)
+		stats.increment(SwarmStats::COMMAND_ERRORS);
+}
+
+void SwarmBot::spatialChatReceived(uint64 senderID, const UnicodeString& message) {
+	SwarmStats& stats = manager->getStats();
+
+	if (senderID != selectedCharacterOid) {
+		stats.increment(SwarmStats::CHATS_HEARD);
+		return;
+	}
+
+	uint64 now = System::getMikroTime();
+
+	Locker locker(&pendingMutex);
+
+	if (pendingChats.size() == 0)
+		return;
+
+	uint64 sent = pendingChats.remove(0);
+
+	locker.release();
+
+	stats.recordLatency(SwarmStats::CHAT, now - sent);
+}
+
+uint64 SwarmBot::getPacketCount() {
+	if (zone == nullptr || zone->getZoneClient() == nullptr)
+		return 0;
+
+	return zone->getZoneClient()->getPacketCount();
+}
@@ -0,0 +1,96 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SWARMBOT_H_
+#define SWARMBOT_H_
+
+#include <atomic>
+
+#include "engine/engine.h"
+#include "client/ClientSession.h"
+
+class ActionBase;
+class SwarmManager;
+
+/**
+ * Simulated client of the swarm. Logs in and zones in with its own copy of the
+ * action chain from a login thread, then ticks on the task manager: every run
+ * moves the character one step of the pattern of the swarm and sends the chat
+ * and combat commands that are due, without waiting on the server.
+ */
+class SwarmBot : public Task, public ClientSession, public Logger {
+	SwarmManager* manager;
+	int index;
+
+	Vector<ActionBase*> actions;
+	int shutdownAction; // First action run on disconnect
+
+	Mutex pendingMutex;
+	VectorMap<uint32, uint64> pendingCombat; // actionCount -> enqueue time
+	Vector<uint64> pendingChats; // enqueue times, own chat is heard back in order
+
+	String terrain;
+	Vector3 home;
+	Vector3 position;
+	Vector3 destination;
+	int cityIndex;
+
+	uint32 moveCount;
+	uint32 actionCount;
+
+	uint64 zoneInTime;
+	uint64 lastTickTime;
+	uint64 nextChatTime;
+	uint64 nextCombatTime;
+
+	std::atomic<bool> active;
+
+	void pickDestination();
+
+	void move(uint64 now);
+
+	void sendChat(uint64 now);
+
+	void sendCombat(uint64 now);
+
+	void expirePending(uint64 now);
+
+	uint32 getNextActionCount() {
+		return ++actionCount;
+	}
+
+public:
+	SwarmBot(SwarmManager* manager, int index, const String& username, const String& password);
+	~SwarmBot();
+
+	/**
+	 * Runs the actions of the chain up to the logout from the calling thread,
+	 * then starts ticking once the character is in the scene.
+	 * @return false if an action failed
+	 */
+	bool connect();
+
+	/**
+	 * Stops ticking and runs the remaining actions of the chain.
+	 */
+	void disconnect();
+
+	void run();
+
+	void commandQueueRemoved(uint32 actionCount, float timer, uint32 errorType, uint32 errorAction) override;
+
+	void spatialChatReceived(uint64 senderID, const UnicodeString& message) override;
+
+	uint64 getPacketCount();
+
+	int getIndex() const {
+		return index;
+	}
+
+	bool isActive() const {
+		return active.load();
+	}
+};
+
+#endif /* SWARMBOT_H_ */
@@ -0,0 +1,132 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "SwarmCharacterGrid.h"
+
+SwarmCharacterGrid::SwarmCharacterGrid(float cellSize) : cellSize(cellSize) {
+	characterCells.setAllowOverwriteInsertPlan();
+	cells.setNoDuplicateInsertPlan();
+}
+
+void SwarmCharacterGrid::removeFromCell(uint64 oid, uint64 cellKey) {
+	int index = cells.find(cellKey);
+
+	if (index == -1)
+		return;
+
+	VectorMap<uint64, Vector3>& cell = cells.elementAt(index).getValue();
+
+	cell.drop(oid);
+
+	if (cell.size() == 0)
+		cells.remove(index);
+}
+
+void SwarmCharacterGrid::put(uint64 oid, float x, float y) {
+	update(oid, x, y, true);
+}
+
+void SwarmCharacterGrid::move(uint64 oid, float x, float y) {
+	update(oid, x, y, false);
+}
+
+void SwarmCharacterGrid::update(uint64 oid, float x, float y, bool insert) {
+	uint64 cellKey = getCellKey(getCellCoordinate(x), getCellCoordinate(y));
+
+	Locker locker(&mutex);
+
+	int index = characterCells.find(oid);
+
+	if (index == -1 && !insert)
+		return;
+
+	if (index != -1) {
+		uint64 oldCellKey = characterCells.elementAt(index).getValue();
+
+		if (oldCellKey == cellKey) {
+			// Moved inside its cell, the common case of a tick
+			int cellIndex = cells.find(cellKey);
+
+			if (cellIndex != -1) {
+				VectorMap<uint64, Vector3>& cell = cells.elementAt(cellIndex).getValue();
+
+				int entry = cell.find(oid);
+
+				if (entry != -1) {
+					cell.elementAt(entry).getValue() = Vector3(x, y, 0.f);
+					return;
+				}
+			}
+		} else {
+			removeFromCell(oid, oldCellKey);
+		}
+	}
+
+	characterCells.put(oid, cellKey);
+
+	int cellIndex = cells.find(cellKey);
+
+	if (cellIndex == -1) {
+		cellIndex = cells.put(cellKey, VectorMap<uint64, Vector3>());
+		cells.elementAt(cellIndex).getValue().setAllowOverwriteInsertPlan();
+	}
+
+	cells.elementAt(cellIndex).getValue().put(oid, Vector3(x, y, 0.f));
+}
+
+void SwarmCharacterGrid::drop(uint64 oid) {
+	Locker locker(&mutex);
+
+	int index = characterCells.find(oid);
+
+	if (index == -1)
+		return;
+
+	removeFromCell(oid, characterCells.elementAt(index).getValue());
+
+	characterCells.remove(index);
+}
+
+uint64 SwarmCharacterGrid::getRandomInRange(uint64 self, float x, float y, float range) {
+	int minColumn = getCellCoordinate(x - range);
+	int maxColumn = getCellCoordinate(x + range);
+	int minRow = getCellCoordinate(y - range);
+	int maxRow = getCellCoordinate(y + range);
+
+	float rangeSquared = range * range;
+	uint64 target = 0;
+	int candidates = 0;
+
+	ReadLocker locker(&mutex);
+
+	for (int column = minColumn; column <= maxColumn; ++column) {
+		for (int row = minRow; row <= maxRow; ++row) {
+			int index = cells.find(getCellKey(column, row));
+
+			if (index == -1)
+				continue;
+
+			const VectorMap<uint64, Vector3>& cell = cells.elementAt(index).getValue();
+
+			// Uniform pick among the characters in range, in one pass
+			for (int i = 0; i < cell.size(); ++i) {
+				const auto& entry = cell.elementAt(i);
+
+				if (entry.getKey() == self)
+					continue;
+
+				float deltaX = entry.getValue().getX() - x;
+				float deltaY = entry.getValue().getY() - y;
+
+				if (deltaX * deltaX + deltaY * deltaY > rangeSquared)
+					continue;
+
+				if (System::random(candidates++) == 0)
+					target = entry.getKey();
+			}
+		}
+	}
+
+	return target;
+}
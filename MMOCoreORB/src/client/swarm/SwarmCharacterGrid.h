@@ -0,0 +1,61 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SWARMCHARACTERGRID_H_
+#define SWARMCHARACTERGRID_H_
+
+#include "system/lang.h"
+#include "engine/util/u3d/Vector3.h"
+
+/**
+ * Last known positions of the characters of the swarm on one terrain, bucketed
+ * in square cells at least as large as the combat range so a target lookup
+ * only visits the cells around the bot. Each terrain has its own lock.
+ */
+class SwarmCharacterGrid : public Object {
+	ReadWriteLock mutex;
+
+	float cellSize;
+
+	// Cell of each character
+	VectorMap<uint64, uint64> characterCells;
+
+	// Characters of each cell and their position
+	VectorMap<uint64, VectorMap<uint64, Vector3> > cells;
+
+	inline int getCellCoordinate(float value) const {
+		return (int) floor(value / cellSize);
+	}
+
+	static inline uint64 getCellKey(int column, int row) {
+		return ((uint64) (uint32) column << 32) | (uint32) row;
+	}
+
+	void removeFromCell(uint64 oid, uint64 cellKey);
+
+	void update(uint64 oid, float x, float y, bool insert);
+
+public:
+	SwarmCharacterGrid(float cellSize);
+
+	/**
+	 * Adds the character or moves it to its new position.
+	 */
+	void put(uint64 oid, float x, float y);
+
+	/**
+	 * Moves the character if it wasn't dropped.
+	 */
+	void move(uint64 oid, float x, float y);
+
+	void drop(uint64 oid);
+
+	/**
+	 * Picks a character other than self within range of the position, uniformly.
+	 * @return 0 if there is none
+	 */
+	uint64 getRandomInRange(uint64 self, float x, float y, float range);
+};
+
+#endif /* SWARMCHARACTERGRID_H_ */
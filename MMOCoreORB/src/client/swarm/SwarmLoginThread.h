@@ -0,0 +1,35 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SWARMLOGINTHREAD_H_
+#define SWARMLOGINTHREAD_H_
+
+#include "SwarmManager.h"
+#include "SwarmBot.h"
+
+/**
+ * Logs in the bots handed out by the manager one at a time. The login and zone
+ * in actions block on the server responses, so they run here instead of on the
+ * task manager workers that process those responses.
+ */
+class SwarmLoginThread : public Thread {
+	SwarmManager* manager;
+
+public:
+	SwarmLoginThread(SwarmManager* swarmManager) {
+		manager = swarmManager;
+	}
+
+	void run() {
+		SwarmBot* bot = nullptr;
+
+		while ((bot = manager->getNextLogin()) != nullptr) {
+			bot->connect();
+		}
+
+		manager->loginThreadFinished();
+	}
+};
+
+#endif /* SWARMLOGINTHREAD_H_ */
@@ -0,0 +1,414 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include <fstream>
+
+#include "SwarmManager.h"
+#include "SwarmBot.h"
+#include "SwarmLoginThread.h"
+
+#include "client/ClientCore.h"
+#include "client/ActionBase.h"
+#include "client/ActionManager.h"
+
+SwarmManager::SwarmManager(const ClientCoreOptions& options) : Logger("SwarmManager"), options(options) {
+	nextLogin = 0;
+	finishedLoginThreads = 0;
+
+	count = options.get<int>("/swarm/count", 0);
+	firstIndex = options.get<int>("/swarm/firstIndex", 1);
+	rampPerSecond = Math::max(0.01f, options.get<float>("/swarm/rampPerSecond", 10.f));
+	loginThreadCount = Math::clamp(1, options.get<int>("/swarm/loginThreads", 8), Math::max(1, count));
+	durationSeconds = options.get<int>("/swarm/durationSeconds", 300);
+	reportIntervalSeconds = Math::max(1, options.get<int>("/swarm/reportIntervalSeconds", 10));
+
+	String patternName = String(options.get<std::string>("/swarm/pattern", "random").c_str()).toLowerCase();
+
+	if (patternName == "crowd")
+		pattern = CROWD;
+	else if (patternName == "travel")
+		pattern = TRAVEL;
+	else
+		pattern = RANDOM_WALK;
+
+	tickMs = Math::max(100, options.get<int>("/swarm/tickMs", 1000));
+	chatIntervalMs = Math::max(0, options.get<int>("/swarm/chatIntervalSeconds", 30)) * 1000;
+	combatIntervalMs = Math::max(0, options.get<int>("/swarm/combatIntervalSeconds", 0)) * 1000;
+	responseTimeoutMs = Math::max(1000, options.get<int>("/swarm/responseTimeoutMs", 10000));
+	speed = options.get<float>("/swarm/speed", 5.f);
+	walkRadius = options.get<float>("/swarm/walkRadius", 64.f);
+	combatCommand = String(options.get<std::string>("/swarm/combatCommand", "attack").c_str());
+	combatRange = options.get<float>("/swarm/combatRange", 5.f);
+
+	JSONSerializationType messages = options.get<JSONSerializationType>("/swarm/chatMessages", JSONSerializationType::array());
+
+	if (messages.is_array()) {
+		for (const auto& message : messages) {
+			if (message.is_string())
+				chatMessages.add(String(message.get<std::string>().c_str()));
+		}
+	}
+
+	if (chatMessages.size() == 0)
+		chatMessages.add("swarm bot {index} checking in");
+
+	loadCities();
+
+	setLogLevel(static_cast<Logger::LogLevel>(ClientCore::getLogLevel()));
+}
+
+SwarmManager::~SwarmManager() {
+	bots.removeAll();
+}
+
+void SwarmManager::loadCities() {
+	// Starports of the main cities
+	const struct {
+		const char* terrain;
+		float x, y;
+	} defaultCities[] = {
+		{"tatooine", 3599.9f, -4780.4f}, // Mos Eisley
+		{"tatooine", -1361.2f, -3600.0f}, // Bestine
+		{"tatooine", -2833.2f, 2107.4f}, // Mos Espa
+		{"tatooine", 1266.1f, 3065.1f}, // Mos Entha
+		{"naboo", -4858.8f, 4164.1f}, // Theed
+		{"naboo", 1371.6f, 2747.9f}, // Keren
+		{"naboo", 4731.2f, -4677.5f}, // Moenia
+		{"naboo", 5280.2f, 6688.0f}, // Kaadara
+		{"corellia", -66.8f, -4711.3f}, // Coronet
+		{"corellia", -5003.1f, -2228.4f}, // Tyrena
+		{"corellia", -3157.3f, 2876.2f}, // Kor Vella
+		{"corellia", 3349.9f, 5598.1f}, // Doaba Guerfel
+		{"rori", 5340.f, 5734.f}, // Restuss
+		{"rori", -5374.1f, -2188.6f}, // Narmle
+		{"talus", 263.6f, -2952.1f}, // Dearic
+		{"talus", 4453.7f, 5354.3f}, // Nashal
+	};
+
+	JSONSerializationType configured = options.get<JSONSerializationType>("/swarm/cities", JSONSerializationType::object());
+
+	if (configured.is_object() && configured.size() > 0) {
+		for (auto it = configured.begin(); it != configured.end(); ++it) {
+			Vector<Vector3> waypoints;
+
+			for (const auto& point : it.value()) {
+				if (point.is_array() && point.size() >= 2)
+					waypoints.add(Vector3(point[0].get<float>(), point[1].get<float>(), 0.f));
+			}
+
+			cities.put(String(it.key().c_str()), waypoints);
+		}
+
+		return;
+	}
+
+	for (const auto& city : defaultCities) {
+		String terrain = city.terrain;
+
+		if (!cities.contains(terrain))
+			cities.put(terrain, Vector<Vector3>());
+
+		cities.get(terrain).add(Vector3(city.x, city.y, 0.f));
+	}
+}
+
+String SwarmManager::getUsername(int index) const {
+	String pattern = String(options.get<std::string>("/username", "").c_str());
+
+	if (pattern.indexOf("{index}") != -1)
+		return pattern.replaceAll("{index}", String::valueOf(index));
+
+	return pattern + String::valueOf(index);
+}
+
+Vector<ActionBase*> SwarmManager::createActions() const {
+	Vector<ActionBase*> actions;
+
+	for (int i = 0; i < options.actions.size(); ++i) {
+		ActionBase* action = options.actions.get(i);
+		ActionBase* copy = ActionManager::fromJSON(action->getName(), action->toJSON());
+
+		if (copy != nullptr)
+			actions.add(copy);
+	}
+
+	return actions;
+}
+
+SwarmBot* SwarmManager::getNextLogin() {
+	Locker locker(&mutex);
+
+	if (nextLogin >= bots.size())
+		return nullptr;
+
+	int slot = nextLogin++;
+	SwarmBot* bot = bots.get(slot);
+
+	locker.release();
+
+	int64 wait = (int64) (slot * 1000 / rampPerSecond) - (int64) startTime.miliDifference();
+
+	if (wait > 0)
+		Thread::sleep(wait);
+
+	return bot;
+}
+
+void SwarmManager::loginThreadFinished() {
+	Locker locker(&mutex);
+
+	++finishedLoginThreads;
+}
+
+Reference<SwarmCharacterGrid*> SwarmManager::getCharacterGrid(const String& terrain) {
+	ReadLocker locker(&charactersMutex);
+
+	int index = characters.find(terrain);
+
+	if (index == -1)
+		return nullptr;
+
+	return characters.elementAt(index).getValue();
+}
+
+void SwarmManager::characterZonedIn(const String& terrain, uint64 oid, float x, float y) {
+	Reference<SwarmCharacterGrid*> grid = getCharacterGrid(terrain);
+
+	if (grid == nullptr) {
+		Locker locker(&charactersMutex);
+
+		int index = characters.find(terrain);
+
+		if (index == -1) {
+			// Targets are at most combatRange away, so they are in the cells around the bot
+			index = characters.put(terrain, new SwarmCharacterGrid(Math::max(combatRange, 16.f)));
+		}
+
+		grid = characters.elementAt(index).getValue();
+	}
+
+	grid->put(oid, x, y);
+
+	Locker locker(&mutex);
+
+	if (!crowdPoints.contains(terrain)) {
+		float crowdX = options.get<float>("/swarm/crowdX", x);
+		float crowdY = options.get<float>("/swarm/crowdY", y);
+
+		crowdPoints.put(terrain, Vector3(crowdX, crowdY, 0.f));
+	}
+}
+
+void SwarmManager::characterMoved(const String& terrain, uint64 oid, float x, float y) {
+	Reference<SwarmCharacterGrid*> grid = getCharacterGrid(terrain);
+
+	if (grid != nullptr)
+		grid->move(oid, x, y);
+}
+
+void SwarmManager::characterLeft(const String& terrain, uint64 oid) {
+	Reference<SwarmCharacterGrid*> grid = getCharacterGrid(terrain);
+
+	if (grid != nullptr)
+		grid->drop(oid);
+}
+
+uint64 SwarmManager::getNearbyTarget(const String& terrain, uint64 self, float x, float y) {
+	Reference<SwarmCharacterGrid*> grid = getCharacterGrid(terrain);
+
+	if (grid == nullptr)
+		return 0;
+
+	return grid->getRandomInRange(self, x, y, combatRange);
+}
+
+Vector3 SwarmManager::getCrowdPoint(const String& terrain) {
+	Locker locker(&mutex);
+
+	int index = crowdPoints.find(terrain);
+
+	if (index == -1)
+		return Vector3(options.get<float>("/swarm/crowdX", 0.f), options.get<float>("/swarm/crowdY", 0.f), 0.f);
+
+	return crowdPoints.elementAt(index).getValue();
+}
+
+const Vector<Vector3>* SwarmManager::getCities(const String& terrain) const {
+	int index = cities.find(terrain);
+
+	if (index == -1)
+		return nullptr;
+
+	return &cities.elementAt(index).getValue();
+}
+
+int SwarmManager::run() {
+	if (count <= 0) {
+		error() << "swarm count must be positive";
+		return 100;
+	}
+
+	info(true) << "Starting swarm of " << count << " bots at " << rampPerSecond << " logins/s with "
+		<< loginThreadCount << " login threads, running " << durationSeconds << "s after the ramp up";
+
+	String password = String(options.get<std::string>("/password", "").c_str());
+
+	for (int i = 0; i < count; ++i) {
+		int index = firstIndex + i;
+
+		bots.add(new SwarmBot(this, index, getUsername(index), password));
+	}
+
+	startTime.updateToCurrentTime();
+
+	for (int i = 0; i < loginThreadCount; ++i) {
+		Thread* thread = new SwarmLoginThread(this);
+		thread->start();
+
+		loginThreads.add(thread);
+	}
+
+	uint64 lastCounters[SwarmStats::COUNTER_COUNT] = {0};
+	uint64 lastReportMs = 0;
+	uint64 lastPacketCount = 0;
+
+	Time rampEnd;
+	bool rampDone = false;
+
+	while (true) {
+		Thread::sleep(reportIntervalSeconds * 1000);
+
+		report(lastCounters, lastReportMs, lastPacketCount);
+
+		Locker locker(&mutex);
+
+		bool loginsDone = finishedLoginThreads == loginThreadCount;
+
+		locker.release();
+
+		if (!loginsDone)
+			continue;
+
+		if (!rampDone) {
+			info(true) << "Ramp up done in " << startTime.miliDifference() << "ms, " << stats.getCounter(SwarmStats::ZONED_IN) << " bots zoned in";
+
+			rampEnd.updateToCurrentTime();
+			rampDone = true;
+		}
+
+		if (rampEnd.miliDifference() >= durationSeconds * 1000LL)
+			break;
+	}
+
+	for (int i = 0; i < loginThreads.size(); ++i) {
+		loginThreads.get(i)->join();
+
+		delete loginThreads.get(i);
+	}
+
+	loginThreads.removeAll();
+
+	info(true) << "Disconnecting " << bots.size() << " bots...";
+
+	for (int i = 0; i < bots.size(); ++i) {
+		bots.get(i)->disconnect();
+	}
+
+	JSONSerializationType summary = stats.toJSON(startTime.miliDifference());
+
+	info(true) << "Swarm summary: " << summary.dump().c_str();
+
+	std::string saveState = options.get<std::string>("/saveState", "");
+
+	if (!saveState.empty())
+		saveStateToFile(String(saveState.c_str()));
+
+	return stats.getCounter(SwarmStats::ZONED_IN) > 0 ? 0 : 101;
+}
+
+void SwarmManager::report(uint64* lastCounters, uint64& lastReportMs, uint64& lastPacketCount) {
+	uint64 now = startTime.miliDifference();
+	double seconds = Math::max(now - lastReportMs, (uint64) 1) / 1000.0;
+
+	int active = 0;
+	uint64 packetCount = 0;
+
+	for (int i = 0; i < bots.size(); ++i) {
+		SwarmBot* bot = bots.get(i);
+
+		if (bot->isActive())
+			++active;
+
+		packetCount += bot->getPacketCount();
+	}
+
+	StringBuffer msg;
+	msg << "[" << now / 1000 << "s] active=" << active << "/" << count
+		<< " recv/s=" << (int) ((packetCount - Math::min(packetCount, lastPacketCount)) / seconds);
+
+	for (int i = SwarmStats::MOVES_SENT; i < SwarmStats::COUNTER_COUNT; ++i) {
+		uint64 value = stats.getCounter(i);
+
+		msg << " " << SwarmStats::getCounterName(i) << "/s=" << (int) ((value - lastCounters[i]) / seconds);
+	}
+
+	for (int i = 0; i < SwarmStats::COUNTER_COUNT; ++i) {
+		lastCounters[i] = stats.getCounter(i);
+	}
+
+	for (int i = 0; i < SwarmStats::LATENCY_COUNT; ++i) {
+		const LatencyHistogram& latency = stats.getLatency(i);
+
+		if (latency.getCount() == 0)
+			continue;
+
+		msg << " " << SwarmStats::getLatencyName(i) << " p50/p99=" << latency.getPercentile(50) / 1000 << "/" << latency.getPercentile(99) / 1000 << "ms";
+	}
+
+	info(true) << msg.toString();
+
+	lastReportMs = now;
+	lastPacketCount = packetCount;
+}
+
+void SwarmManager::saveStateToFile(const String& filename) {
+	try {
+		JSONSerializationType jsonData;
+
+		Time now;
+		now.updateToCurrentTime();
+		jsonData["@timestamp"] = now.getFormattedTimeFull().toCharArray();
+		jsonData["time_msecs"] = now.getMiliTime();
+
+		jsonData["swarm"] = stats.toJSON(startTime.miliDifference());
+		jsonData["runtimeOptions"] = options.getAsJSON();
+
+		JSONSerializationType failures = JSONSerializationType::array();
+
+		for (int i = 0; i < bots.size(); ++i) {
+			SwarmBot* bot = bots.get(i);
+
+			if (bot->hasVar("ErrorMessage/message")) {
+				JSONSerializationType failure;
+				failure["username"] = bot->username.toCharArray();
+				failure["error"] = bot->getVar("ErrorMessage/message", String()).toCharArray();
+				failures.push_back(failure);
+			}
+		}
+
+		jsonData["errors"] = failures;
+
+		std::ofstream file(filename.toCharArray());
+
+		if (file.is_open()) {
+			file << jsonData.dump(2);
+			file.close();
+			info(true) << "State saved to: " << filename;
+		} else {
+			error() << "Failed to open file for writing: " << filename;
+		}
+	} catch (Exception& e) {
+		error() << "Error saving state: " << e.getMessage();
+	}
+}
@@ -0,0 +1,169 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SWARMMANAGER_H_
+#define SWARMMANAGER_H_
+
+#include "system/lang.h"
+#include "engine/log/Logger.h"
+#include "engine/util/u3d/Vector3.h"
+#include "client/swarm/SwarmStats.h"
+#include "client/swarm/SwarmCharacterGrid.h"
+
+struct ClientCoreOptions;
+class ActionBase;
+class SwarmBot;
+
+/**
+ * Load generator mode of the client: logs in count accounts with the action
+ * chain of the options, then drives their characters from short tasks on the
+ * engine task manager until the run is over, reporting the latencies and
+ * throughput of the server responses.
+ */
+class SwarmManager : public Logger {
+public:
+	enum MovementPattern {
+		RANDOM_WALK = 0,  // Wander around the spawn point
+		CROWD,            // Gather in one spot of the planet
+		TRAVEL            // Walk from city to city
+	};
+
+private:
+	const ClientCoreOptions& options;
+
+	SwarmStats stats;
+
+	Vector<Reference<SwarmBot*>> bots;
+	Vector<Thread*> loginThreads;
+
+	Mutex mutex;
+	int nextLogin;
+	int finishedLoginThreads;
+
+	// Last known position of the zoned in characters by terrain, to pick combat targets from
+	ReadWriteLock charactersMutex;
+	VectorMap<String, Reference<SwarmCharacterGrid*> > characters;
+
+	VectorMap<String, Vector3> crowdPoints;
+	VectorMap<String, Vector<Vector3> > cities;
+
+	Time startTime;
+
+	int count;
+	int firstIndex;
+	float rampPerSecond;
+	int loginThreadCount;
+	int durationSeconds;
+	int reportIntervalSeconds;
+
+	MovementPattern pattern;
+	int tickMs;
+	int chatIntervalMs;
+	int combatIntervalMs;
+	int responseTimeoutMs;
+	float speed;
+	float walkRadius;
+	String combatCommand;
+	float combatRange;
+	Vector<String> chatMessages;
+
+	void loadCities();
+
+	String getUsername(int index) const;
+
+	void report(uint64* lastCounters, uint64& lastReportMs, uint64& lastPacketCount);
+
+	void saveStateToFile(const String& filename);
+
+	Reference<SwarmCharacterGrid*> getCharacterGrid(const String& terrain);
+
+public:
+	SwarmManager(const ClientCoreOptions& options);
+	~SwarmManager();
+
+	/**
+	 * Runs the swarm to completion.
+	 * @return exit code of the client
+	 */
+	int run();
+
+	/**
+	 * Next bot to log in for the login threads, waiting for its slot of the ramp up.
+	 * @return nullptr once every bot was handed out
+	 */
+	SwarmBot* getNextLogin();
+
+	void loginThreadFinished();
+
+	/**
+	 * Creates the actions of the chain of the options for one bot.
+	 */
+	Vector<ActionBase*> createActions() const;
+
+	void characterZonedIn(const String& terrain, uint64 oid, float x, float y);
+
+	void characterMoved(const String& terrain, uint64 oid, float x, float y);
+
+	void characterLeft(const String& terrain, uint64 oid);
+
+	/**
+	 * Picks a combat target among the characters of the swarm within the combat
+	 * range of the position, so the command isn't rejected as out of range.
+	 * @return 0 if there is none
+	 */
+	uint64 getNearbyTarget(const String& terrain, uint64 self, float x, float y);
+
+	/**
+	 * Spot the crowd pattern gathers at, the configured one or where the first
+	 * character zoned in on the terrain.
+	 */
+	Vector3 getCrowdPoint(const String& terrain);
+
+	/**
+	 * Waypoints of the travel pattern on the terrain, nullptr if none are known.
+	 */
+	const Vector<Vector3>* getCities(const String& terrain) const;
+
+	SwarmStats& getStats() {
+		return stats;
+	}
+
+	MovementPattern getPattern() const {
+		return pattern;
+	}
+
+	int getTickMs() const {
+		return tickMs;
+	}
+
+	int getChatIntervalMs() const {
+		return chatIntervalMs;
+	}
+
+	int getCombatIntervalMs() const {
+		return combatIntervalMs;
+	}
+
+	int getResponseTimeoutMs() const {
+		return responseTimeoutMs;
+	}
+
+	float getSpeed() const {
+		return speed;
+	}
+
+	float getWalkRadius() const {
+		return walkRadius;
+	}
+
+	const String& getCombatCommand() const {
+		return combatCommand;
+	}
+
+	const String& getRandomChatMessage() const {
+		return chatMessages.get(System::random(chatMessages.size() - 1));
+	}
+};
+
+#endif /* SWARMMANAGER_H_ */
@@ -0,0 +1,49 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "SwarmStats.h"
+
+const char* SwarmStats::getLatencyName(int latency) {
+	static const char* names[] = {"login", "zoneIn", "chat", "combat"};
+
+	static_assert(sizeof(names) / sizeof(names[0]) == LATENCY_COUNT, "latency names out of sync");
+
+	return names[latency];
+}
+
+const char* SwarmStats::getCounterName(int counter) {
+	static const char* names[] = {"loginsStarted", "loginsFailed", "zonedIn", "disconnects", "movesSent",
+		"chatsSent", "chatsHeard", "combatSent", "commandErrors", "responseTimeouts"};
+
+	static_assert(sizeof(names) / sizeof(names[0]) == COUNTER_COUNT, "counter names out of sync");
+
+	return names[counter];
+}
+
+JSONSerializationType SwarmStats::toJSON(uint64 elapsedMs) const {
+	JSONSerializationType json;
+	JSONSerializationType countersJson;
+	JSONSerializationType ratesJson;
+	JSONSerializationType latenciesJson;
+
+	double elapsedSeconds = Math::max(elapsedMs, (uint64) 1) / 1000.0;
+
+	for (int i = 0; i < COUNTER_COUNT; ++i) {
+		uint64 value = getCounter(i);
+
+		countersJson[getCounterName(i)] = value;
+		ratesJson[getCounterName(i)] = value / elapsedSeconds;
+	}
+
+	for (int i = 0; i < LATENCY_COUNT; ++i) {
+		latenciesJson[getLatencyName(i)] = latencies[i].toJSON();
+	}
+
+	json["elapsedMs"] = elapsedMs;
+	json["counters"] = countersJson;
+	json["ratesPerSecond"] = ratesJson;
+	json["latencies"] = latenciesJson;
+
+	return json;
+}
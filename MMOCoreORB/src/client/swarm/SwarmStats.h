@@ -0,0 +1,74 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SWARMSTATS_H_
+#define SWARMSTATS_H_
+
+#include "LatencyHistogram.h"
+
+/**
+ * Latencies and counters shared by all the bots of a swarm.
+ */
+class SwarmStats {
+public:
+	enum Latency {
+		LOGIN = 0,  // loginAccount run
+		ZONE_IN,    // Zone connection to scene ready
+		CHAT,       // spatialchatinternal enqueued to own SpatialChat heard
+		COMBAT,     // Combat command enqueued to CommandQueueRemove
+		LATENCY_COUNT
+	};
+
+	enum Counter {
+		LOGINS_STARTED = 0,
+		LOGINS_FAILED,
+		ZONED_IN,
+		DISCONNECTS,
+		MOVES_SENT,
+		CHATS_SENT,
+		CHATS_HEARD,
+		COMBAT_SENT,
+		COMMAND_ERRORS,
+		RESPONSE_TIMEOUTS,
+		COUNTER_COUNT
+	};
+
+private:
+	LatencyHistogram latencies[LATENCY_COUNT];
+	std::atomic<uint64> counters[COUNTER_COUNT];
+
+public:
+	SwarmStats() {
+		for (int i = 0; i < COUNTER_COUNT; ++i) {
+			counters[i].store(0, std::memory_order_relaxed);
+		}
+	}
+
+	static const char* getLatencyName(int latency);
+
+	static const char* getCounterName(int counter);
+
+	void recordLatency(Latency latency, uint64 microseconds) {
+		latencies[latency].record(microseconds);
+	}
+
+	void increment(Counter counter, uint64 value = 1) {
+		counters[counter].fetch_add(value, std::memory_order_relaxed);
+	}
+
+	const LatencyHistogram& getLatency(int latency) const {
+		return latencies[latency];
+	}
+
+	uint64 getCounter(int counter) const {
+		return counters[counter].load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Counters with their rate per second over elapsedMs and the latency histograms.
+	 */
+	JSONSerializationType toJSON(uint64 elapsedMs) const;
+};
+
+#endif /* SWARMSTATS_H_ */
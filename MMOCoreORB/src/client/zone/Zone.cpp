@@ -6,8 +6,8 @@
 #include "client/zone/managers/objectcontroller/ObjectController.h"
 #include "client/zone/managers/object/ObjectManager.h"
 
-Zone::Zone(ClientCore* core, uint32 account, const String& sessionID, const String& galaxyAddress, uint32 galaxyPort) : Thread(), Mutex("Zone"), Logger("Zone") {
-	clientCore = core;
+Zone::Zone(ClientSession* session, uint32 account, const String& sessionID, const String& galaxyAddress, uint32 galaxyPort) : Thread(), Mutex("Zone"), Logger("Zone") {
+	this->session = session;
 	accountID = account;
 	this->sessionID = sessionID;
 	this->galaxyAddress = galaxyAddress;
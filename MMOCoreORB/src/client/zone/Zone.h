@@ -22,7 +22,7 @@ class Zone : public Thread, public Mutex, public Logger {
 	Reference<ZoneClient*> client;
 	ZoneClientThread* clientThread;
 
-	class ClientCore* clientCore;  // Reference to core context for vars storage
+	class ClientSession* session;  // Session the connection belongs to, for vars storage
 	ObjectController* objectController;
 
 	Condition sceneReadyCondition;
@@ -46,7 +46,7 @@ class Zone : public Thread, public Mutex, public Logger {
 	VectorMap<uint32, Condition*> waitConditions;
 
 public:
-	Zone(class ClientCore* core, uint32 account, const String& sessionID, const String& galaxyAddress, uint32 galaxyPort);
+	Zone(class ClientSession* session, uint32 account, const String& sessionID, const String& galaxyAddress, uint32 galaxyPort);
 	~Zone();
 
 	void run();
@@ -130,7 +130,7 @@ public:
 	 * @return true if any signal received, false if timeout
 	 *
 	 * Use for scenarios where multiple responses are possible (success/failed/error).
-	 * After wait returns true, check ClientCore::vars to determine which response arrived.
+	 * After wait returns true, check ClientSession::vars to determine which response arrived.
 	 */
 	bool waitForAny(uint32 opcodes[], int count, int timeoutMs) {
 		Locker locker(this);
@@ -171,8 +171,8 @@ public:
 		return client;
 	}
 
-	inline ClientCore* getClientCore() {
-		return clientCore;
+	inline ClientSession* getSession() {
+		return session;
 	}
 
 	inline ObjectManager* getObjectManager() {
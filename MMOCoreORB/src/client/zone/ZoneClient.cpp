@@ -38,7 +38,7 @@ void ZoneClient::handleMessage(ServiceClient* client, Packet* message) {
 }
 
 void ZoneClient::initialize() {
-	zonePacketHandler = new ZonePacketHandler("ZonePacketHandler", zone, zone->getClientCore());
+	zonePacketHandler = new ZonePacketHandler("ZonePacketHandler", zone, zone->getSession());
 
 	client->initialize();
 }
@@ -8,9 +8,9 @@
 #include "client/zone/managers/objectcontroller/ObjectController.h"
 #include "server/zone/packets/charcreation/ClientCreateCharacter.h"
 
-ZonePacketHandler::ZonePacketHandler(const String& s, Zone* z, ClientCore* clientCore) : Logger(s) {
+ZonePacketHandler::ZonePacketHandler(const String& s, Zone* z, ClientSession* clientSession) : Logger(s) {
 	zone = z;
-	core = clientCore;
+	session = clientSession;
 
 	setLogging(true);
 	setGlobalLogging(true);
@@ -187,15 +187,20 @@ void ZonePacketHandler::handleCmdStartScene(Message* pack) {
 	uint64 galacticTime = pack->parseLong();
 
 	// Server confirms our character OID
-	if (core->selectedCharacterOid != selfPlayerObjectID) {
+	if (session->selectedCharacterOid != selfPlayerObjectID) {
 		error() << "Scene starting for wrong OID: " << selfPlayerObjectID
-			<< "; expected OID: " << core->selectedCharacterOid
+			<< "; expected OID: " << session->selectedCharacterOid
 			<< "; aborting Scene.";
 		return;
 	}
 
 	info(true) << "Scene Starting for character OID: " << selfPlayerObjectID;
 
+	session->setVar("CmdStartScene/terrain", terrain);
+	session->setVar("CmdStartScene/x", x);
+	session->setVar("CmdStartScene/z", z);
+	session->setVar("CmdStartScene/y", y);
+
 	BaseMessage* msg = new CmdSceneReady();
 	client->sendPacket(msg);
 
@@ -303,14 +308,32 @@ void ZonePacketHandler::handleObjectControllerMessage(Message* pack) {
 	uint32 header1 = pack->parseInt();
 	uint32 header2 = pack->parseInt();
 
-	uint64 objectID = pack->parseLong();
+	pack->parseLong(); // object id
 
 	pack->parseInt();
 
-	SceneObject* object = zone->getObject(objectID);
+	switch (header2) {
+	case 0x117: { // CommandQueueRemove
+		uint32 actionCount = pack->parseInt();
+		float timer = pack->parseFloat();
+		uint32 errorType = pack->parseInt();
+		uint32 errorAction = pack->parseInt();
+
+		session->commandQueueRemoved(actionCount, timer, errorType, errorAction);
+		break;
+	}
+	case 0xF4: { // SpatialChat
+		uint64 senderID = pack->parseLong();
+		pack->parseLong(); // chat target
+
+		UnicodeString message;
+		pack->parseUnicode(message);
 
-	if (object != nullptr) {
-		// No object controller handling needed
+		session->spatialChatReceived(senderID, message);
+		break;
+	}
+	default:
+		break;
 	}
 }
 
@@ -358,7 +381,7 @@ void ZonePacketHandler::handleClientCreateCharacterSuccess(Message* pack) {
 	info(true) << "Character creation SUCCESS - OID: " << newCharacterOID;
 
 	// Store in vars
-	core->setVar("ClientCreateCharacterSuccess/oid", newCharacterOID);
+	session->setVar("ClientCreateCharacterSuccess/oid", newCharacterOID);
 
 	// Now send SelectCharacter with the new OID
 	BaseClient* client = (BaseClient*) pack->getClient();
@@ -383,8 +406,8 @@ void ZonePacketHandler::handleClientCreateCharacterFailed(Message* pack) {
 	error() << "  UI file: " << uiFile;
 
 	// Store in vars
-	core->setVar("ClientCreateCharacterFailed/errorCode", errorCode);
-	core->setVar("ClientCreateCharacterFailed/uiFile", uiFile);
+	session->setVar("ClientCreateCharacterFailed/errorCode", errorCode);
+	session->setVar("ClientCreateCharacterFailed/uiFile", uiFile);
 }
 
 void ZonePacketHandler::handleErrorMessage(Message* pack) {
@@ -397,9 +420,9 @@ void ZonePacketHandler::handleErrorMessage(Message* pack) {
 	error() << "Zone ERROR: " << errorType << " - " << errorMessage;
 
 	// Store in vars
-	core->setVar("ErrorMessage/type", errorType);
-	core->setVar("ErrorMessage/message", errorMessage);
-	core->setVar("ErrorMessage/source", "ZonePacketHandler");
+	session->setVar("ErrorMessage/type", errorType);
+	session->setVar("ErrorMessage/message", errorMessage);
+	session->setVar("ErrorMessage/source", "ZonePacketHandler");
 
 	zone->setError(errorMessage, 1);
 }
@@ -425,7 +448,7 @@ void ZonePacketHandler::handleClientRandomNameResponse(Message* pack) {
 	info(true) << "  Approval: " << approvalStatus;
 
 	// Store in vars
-	core->setVar("ClientRandomNameResponse/name", suggestedName.toString());
-	core->setVar("ClientRandomNameResponse/template", templatePath);
-	core->setVar("ClientRandomNameResponse/approval", approvalStatus);
+	session->setVar("ClientRandomNameResponse/name", suggestedName.toString());
+	session->setVar("ClientRandomNameResponse/template", templatePath);
+	session->setVar("ClientRandomNameResponse/approval", approvalStatus);
 }
@@ -11,11 +11,11 @@ class Zone;
 
 class ZonePacketHandler : public Mutex, public Logger {
 	Zone* zone;
-	class ClientCore* core;
+	class ClientSession* session;
 	VectorMap<uint32, uint32> unknownOpcodes;  // opcode -> count
 
 public:
-	ZonePacketHandler(const String& s, Zone* z, class ClientCore* clientCore);
+	ZonePacketHandler(const String& s, Zone* z, class ClientSession* clientSession);
 
 	~ZonePacketHandler() {
 	}
@@ -0,0 +1,30 @@
+/*
+ * ClientCommandQueueEnqueuePacket.h
+ *
+ * Client-side request to run a command, answered by CommandQueueRemove for combat queue commands
+ */
+
+#ifndef CLIENTCOMMANDQUEUEENQUEUEPACKET_H_
+#define CLIENTCOMMANDQUEUEENQUEUEPACKET_H_
+
+#include "engine/service/proto/BaseMessage.h"
+
+class ClientCommandQueueEnqueuePacket : public BaseMessage {
+public:
+	ClientCommandQueueEnqueuePacket(uint64 objectID, uint32 actionCount, const String& command, uint64 targetID, const UnicodeString& arguments) : BaseMessage() {
+		insertShort(0x05);
+		insertInt(0x80CE5E46);  // ObjControllerMessage
+		insertInt(0x23);
+		insertInt(0x116);  // CommandQueueEnqueue
+		insertLong(objectID);
+		insertInt(0);
+		insertInt(actionCount);
+		insertInt(command.toLowerCase().hashCode());
+		insertLong(targetID);
+		insertUnicode(arguments);
+
+		setCompression(false);
+	}
+};
+
+#endif /* CLIENTCOMMANDQUEUEENQUEUEPACKET_H_ */
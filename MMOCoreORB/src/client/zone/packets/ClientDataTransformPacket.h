@@ -0,0 +1,39 @@
+/*
+ * ClientDataTransformPacket.h
+ *
+ * Client-side movement update of the player creature
+ */
+
+#ifndef CLIENTDATATRANSFORMPACKET_H_
+#define CLIENTDATATRANSFORMPACKET_H_
+
+#include "engine/service/proto/BaseMessage.h"
+
+class ClientDataTransformPacket : public BaseMessage {
+public:
+	ClientDataTransformPacket(uint64 objectID, uint32 timeStamp, uint32 moveCount, float directionAngle, float x, float z, float y, float speed) : BaseMessage() {
+		insertShort(0x05);
+		insertInt(0x80CE5E46);  // ObjControllerMessage
+		insertInt(0x23);
+		insertInt(0x71);  // DataTransform
+		insertLong(objectID);
+		insertInt(timeStamp);
+		insertInt(moveCount);
+
+		// Rotation around the up axis only
+		insertFloat(0.f);
+		insertFloat(sin(directionAngle / 2.f));
+		insertFloat(0.f);
+		insertFloat(cos(directionAngle / 2.f));
+
+		insertFloat(x);
+		insertFloat(z);
+		insertFloat(y);
+
+		insertFloat(speed);
+
+		setCompression(false);
+	}
+};
+
+#endif /* CLIENTDATATRANSFORMPACKET_H_ */
@@ -0,0 +1,199 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef CONFIGHANDLE_H_
+#define CONFIGHANDLE_H_
+
+#include <atomic>
+
+#include "engine/engine.h"
+
+namespace conf {
+	class ConfigManager;
+
+	/**
+	 * Value of a config item as read through a ConfigHandle, converted once when
+	 * the snapshot holding it is built.
+	 */
+	class ConfigValue {
+	public:
+		bool asBool = false;
+		int asInt = 0;
+		float asFloat = 0.f;
+		String asString;
+
+		template <typename T>
+		T get() const;
+	};
+
+	template <>
+	inline bool ConfigValue::get<bool>() const {
+		return asBool;
+	}
+
+	template <>
+	inline int ConfigValue::get<int>() const {
+		return asInt;
+	}
+
+	template <>
+	inline float ConfigValue::get<float>() const {
+		return asFloat;
+	}
+
+	template <>
+	inline String ConfigValue::get<String>() const {
+		return asString;
+	}
+
+	/**
+	 * Read counter split in shards picked by thread, so hot items don't have
+	 * every zone thread incrementing the same cache line.
+	 */
+	class ConfigUsageCounter {
+	public:
+		const static int SHARDS = 16;
+
+	private:
+		struct Shard {
+			std::atomic<uint64> count;
+			char padding[64 - sizeof(std::atomic<uint64>)];
+
+			Shard() : count(0) {
+			}
+		};
+
+		Shard shards[SHARDS];
+
+		static int getShardIndex() {
+			static std::atomic<uint32> nextShard(0);
+			static thread_local int shardIndex = nextShard.fetch_add(1, std::memory_order_relaxed) % SHARDS;
+
+			return shardIndex;
+		}
+
+	public:
+		inline void increment() {
+			shards[getShardIndex()].count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		uint64 get() const {
+			uint64 total = 0;
+
+			for (int i = 0; i < SHARDS; ++i) {
+				total += shards[i].count.load(std::memory_order_relaxed);
+			}
+
+			return total;
+		}
+
+		uint64 reset() {
+			uint64 total = 0;
+
+			for (int i = 0; i < SHARDS; ++i) {
+				total += shards[i].count.exchange(0, std::memory_order_relaxed);
+			}
+
+			return total;
+		}
+	};
+
+	/**
+	 * Registration of a handle, owned by the manager and never freed while it lives.
+	 */
+	class ConfigHandleSlot {
+		int index;
+		String name;
+		ConfigValue defaultValue;
+		ConfigUsageCounter reads;
+
+	public:
+		ConfigHandleSlot(int index, const String& name) : index(index), name(name) {
+		}
+
+		inline int getIndex() const {
+			return index;
+		}
+
+		inline const String& getName() const {
+			return name;
+		}
+
+		inline ConfigValue& getDefaultValue() {
+			return defaultValue;
+		}
+
+		inline ConfigUsageCounter& getReads() {
+			return reads;
+		}
+	};
+
+	/**
+	 * Immutable values of every registered handle at one config version. The
+	 * manager builds a new one when the config changes and swaps it in; the
+	 * replaced ones are freed once no handle is reading them.
+	 */
+	class ConfigSnapshot {
+		int version;
+		int size;
+		ConfigValue* values;
+
+	public:
+		ConfigSnapshot(int version, int size) : version(version), size(size) {
+			values = size > 0 ? new ConfigValue[size] : nullptr;
+		}
+
+		~ConfigSnapshot() {
+			delete [] values;
+		}
+
+		inline int getVersion() const {
+			return version;
+		}
+
+		inline int getSize() const {
+			return size;
+		}
+
+		inline const ConfigValue& getValue(int index) const {
+			return values[index];
+		}
+
+		inline ConfigValue& getValue(int index) {
+			return values[index];
+		}
+	};
+
+	/**
+	 * Typed config item looked up by name once. Reads go through the current
+	 * snapshot of the manager without taking its lock, so they are meant to be
+	 * kept in a static for items read on hot paths:
+	 *
+	 *   static ConfigHandle<bool> pvpMode("Core3.PvpMode", false);
+	 *   if (pvpMode.get()) ...
+	 *
+	 * Per account overrides are not applied, use the getters of the manager
+	 * taking an accountID for those.
+	 */
+	template <typename T>
+	class ConfigHandle {
+		ConfigManager* manager;
+		ConfigHandleSlot* slot;
+
+	public:
+		ConfigHandle(const String& name, const T& defaultValue);
+
+		T get() const;
+
+		inline const String& getName() const {
+			return slot->getName();
+		}
+
+		inline uint64 getReads() const {
+			return slot->getReads().get();
+		}
+	};
+}
+
+#endif // #ifndef CONFIGHANDLE_H_
@@ -14,10 +14,21 @@ ConfigManager::ConfigManager() {
 #else // DEBUG_CONFIGMANAGER
 	setLogLevel(Logger::INFO);
 #endif // DEBUG_CONFIGMANAGER
+
+	// Never matches configVersion, the first read through a handle builds the real one
+	snapshot.store(new ConfigSnapshot(-1, 0), std::memory_order_release);
 }
 
 ConfigManager::~ConfigManager() {
 	clearConfigData();
+
+	delete snapshot.exchange(nullptr);
+
+	for (int i = 0; i < handleSlots.size(); ++i) {
+		delete handleSlots.getUnsafe(i);
+	}
+
+	handleSlots.removeAll();
 }
 
 bool ConfigManager::loadConfigData() {
@@ -102,6 +113,7 @@ void ConfigManager::clearConfigData() {
 
 	configData.removeAll();
 	configData.setNoDuplicateInsertPlan();
+	hasAccountFlags = false;
 	incrementConfigVersion();
 }
 
@@ -154,6 +166,15 @@ void ConfigManager::dumpConfig(bool includeSecure) {
 		       	hottestKey << " usageCounter: " << maxUsageCounter << " (" << maxPS << "/s)";
 	}
 
+	for (int i = 0; i < handleSlots.size(); ++i) {
+		ConfigHandleSlot* slot = handleSlots.getUnsafe(i);
+		uint64 reads = slot->getReads().get();
+
+		info(true) << "handle #" << slot->getIndex() << " " << slot->getName()
+			<< " reads: " << reads
+			<< " (" << (age > 0 ? reads / age : 0) << "/s)";
+	}
+
 	auto engineConfig = Core::getPropertiesString();
 
 	info(true) << engineConfig;
@@ -451,7 +472,7 @@ bool ConfigManager::contains(const String& name, unsigned int accountID) const {
 ConfigDataItem* ConfigManager::findItem(const String& name, unsigned int accountID) const {
 	int pos = -1;
 
-	if (pos == -1 && accountID > 0) {
+	if (accountID > 0 && hasAccountFlags) {
 		pos = configData.find(withAccount(name, accountID));
 	}
 
@@ -636,11 +657,70 @@ bool ConfigManager::updateItem(const String& name, ConfigDataItem* newItem) {
 	newItem->setDebugTag(name);
 #endif // DEBUG_CONFIGMANAGER
 
+	if (!hasAccountFlags && name.beginsWith("Core3.AccountFlags."))
+		hasAccountFlags = true;
+
 	configData.put(std::move(name), std::move(newItem));
 	incrementConfigVersion();
 	return true;
 }
 
+ConfigHandleSlot* ConfigManager::registerHandle(const String& name, const ConfigDataItem& defaultItem) {
+	Locker guard(&mutex);
+
+	ConfigHandleSlot* slot = new ConfigHandleSlot(handleSlots.size(), name);
+	defaultItem.getValue(slot->getDefaultValue());
+
+	handleSlots.add(slot);
+
+	// The first get() of the handle finds the snapshot too small and refreshes it,
+	// so the handles registered during static initialization don't build one each
+	return slot;
+}
+
+void ConfigManager::refreshSnapshot() {
+	Locker guard(&mutex);
+
+	ConfigSnapshot* current = snapshot.load(std::memory_order_acquire);
+
+	// Another reader got here first
+	if (current->getVersion() == configVersion.get() && current->getSize() == handleSlots.size())
+		return;
+
+	publishSnapshot();
+}
+
+void ConfigManager::tryRefreshSnapshot() {
+	// Keep reading the previous values while a reload holds the lock
+	if (!mutex.tryWLock())
+		return;
+
+	ConfigSnapshot* current = snapshot.load(std::memory_order_acquire);
+
+	if (current->getVersion() != configVersion.get() || current->getSize() != handleSlots.size())
+		publishSnapshot();
+
+	mutex.unlock();
+}
+
+void ConfigManager::publishSnapshot() {
+	ConfigSnapshot* newSnapshot = new ConfigSnapshot(configVersion.get(), handleSlots.size());
+
+	for (int i = 0; i < handleSlots.size(); ++i) {
+		ConfigHandleSlot* slot = handleSlots.getUnsafe(i);
+		ConfigDataItem* itm = findItem(slot->getName());
+
+		if (itm == nullptr)
+			newSnapshot->getValue(i) = slot->getDefaultValue();
+		else
+			itm->getValue(newSnapshot->getValue(i));
+	}
+
+	ConfigSnapshot* oldSnapshot = snapshot.exchange(newSnapshot, std::memory_order_seq_cst);
+
+	retiredSnapshots.retire(oldSnapshot);
+}
+
 bool ConfigManager::setNumber(const String& name, lua_Number newValue) {
 	return updateItem(name, new ConfigDataItem(newValue));
 }
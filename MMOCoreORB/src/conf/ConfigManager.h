@@ -8,6 +8,8 @@
 // #define DEBUG_CONFIGMANAGER
 
 #include "engine/engine.h"
+#include "conf/ConfigHandle.h"
+#include "conf/HazardPointers.h"
 
 namespace conf {
 
@@ -53,6 +55,14 @@ namespace conf {
 			return asString;
 		}
 
+		inline void getValue(ConfigValue& value) const {
+			usageCounter.increment();
+			value.asBool = asBool;
+			value.asInt = (int)asNumber;
+			value.asFloat = (float)asNumber;
+			value.asString = asString;
+		}
+
 		const Vector<String>& getStringVector() {
 			Locker guard(&mutex);
 
@@ -182,10 +192,20 @@ namespace conf {
 
 		ReadWriteLock mutex;
 
+		// Skips the per account lookup until a Core3.AccountFlags item is set
+		bool hasAccountFlags = false;
+
+		// Typed handles, read through a snapshot rebuilt after each change
+		Vector<ConfigHandleSlot*> handleSlots;
+		std::atomic<ConfigSnapshot*> snapshot;
+		RetireList<ConfigSnapshot> retiredSnapshots;
+
 	private:
 		ConfigDataItem* findItem(const String& name, unsigned int accountID = 0) const;
 		bool updateItem(const String& name, ConfigDataItem* newItem);
 
+		void publishSnapshot();
+
 		bool parseConfigData(const String& prefix, bool isGlobal = false, int maxDepth = 5);
 		bool parseConfigJSONRecursive(const String prefix, JSONSerializationType jsonNode, String& errorMessage, bool updateOnly = true);
 		void writeJSONPath(StringTokenizer& tokens, JSONSerializationType& jsonData, const JSONSerializationType& jsonValue);
@@ -226,6 +246,16 @@ namespace conf {
 			return configVersion.get();
 		}
 
+		// Typed handles
+		ConfigHandleSlot* registerHandle(const String& name, const ConfigDataItem& defaultItem);
+		void refreshSnapshot();
+		void tryRefreshSnapshot();
+
+		// Read it through a HazardGuard, replaced snapshots are freed once no guard holds them
+		inline const std::atomic<ConfigSnapshot*>& getSnapshot() const {
+			return snapshot;
+		}
+
 		// General config functions
 		bool contains(const String& name, unsigned int accountID = 0) const;
 		int getUsageCounter(const String& name) const;
@@ -272,46 +302,25 @@ namespace conf {
 
 		inline bool shouldUnloadContainers() {
 			// Use cached value as this is called often
-			static uint32 cachedVersion = 0;
-			static bool cachedUnloadContainers;
+			static ConfigHandle<bool> unloadContainers("Core3.UnloadContainers", true);
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedUnloadContainers = getBool("Core3.UnloadContainers", true);
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedUnloadContainers;
+			return unloadContainers.get();
 		}
 
 		inline bool shouldUseMetrics() {
 			// On Basilisk this is called 400/s
-			static uint32 cachedVersion = 0;
-			static bool cachedUseMetrics;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedUseMetrics = getBool("Core3.UseMetrics", false);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<bool> useMetrics("Core3.UseMetrics", false);
 
-			return cachedUseMetrics;
+			return useMetrics.get();
 		}
 
 		inline bool getPvpMode() {
 			// Use cached value as this is a hot item called in:
 			//   CreatureObjectImplementation::isAttackableBy
 			//   CreatureObjectImplementation::isAggressiveTo
-			static uint32 cachedVersion = 0;
-			static bool cachedPvpMode;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedPvpMode = getBool("Core3.PvpMode", false);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<bool> pvpMode("Core3.PvpMode", false);
 
-			return cachedPvpMode;
+			return pvpMode.get();
 		}
 
 		inline bool setPvpMode(bool val) {
@@ -332,30 +341,16 @@ namespace conf {
 
 		inline bool isProgressMonitorActivated() {
 			// Use cached value as this a hot item called in lots of loops
-			static uint32 cachedVersion = 0;
-			static bool cachedProgressMonitors;
+			static ConfigHandle<bool> progressMonitors("Core3.ProgressMonitors", false);
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedProgressMonitors = getBool("Core3.ProgressMonitors", false);
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedProgressMonitors;
+			return progressMonitors.get();
 		}
 
 		inline bool includeFactionPetsForMissionDifficulty() {
 			// Use cached value as this a hot item called in lots of loops
-			static uint32 cachedVersion = 0;
-			static bool cachedValue;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedValue = getBool("Core3.MissionManager.IncludeFactionPets", true);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<bool> value("Core3.MissionManager.IncludeFactionPets", true);
 
-			return cachedValue;
+			return value.get();
 		}
 
 		inline int getDBPort() {
@@ -475,7 +470,15 @@ namespace conf {
 		}
 
 		inline int getZoneProcessingThreads() {
-			return getInt("Core3.ZoneProcessingThreads", 10);
+			static ConfigHandle<int> zoneProcessingThreads("Core3.ZoneProcessingThreads", 10);
+
+			return zoneProcessingThreads.get();
+		}
+
+		inline int getSpaceProjectileThreads() {
+			static ConfigHandle<int> spaceProjectileThreads("Core3.SpaceProjectileThreads", 4);
+
+			return spaceProjectileThreads.get();
 		}
 
 		inline int getZoneAllowedConnections() {
@@ -571,11 +574,15 @@ namespace conf {
 		}
 
 		inline bool getCharacterBuilderEnabled() {
-			return getBool("Core3.CharacterBuilderEnabled", false);
+			static ConfigHandle<bool> characterBuilderEnabled("Core3.CharacterBuilderEnabled", false);
+
+			return characterBuilderEnabled.get();
 		}
 
 		inline int getPlayerLogLevel() {
-			return getInt("Core3.PlayerLogLevel", Logger::INFO);
+			static ConfigHandle<int> playerLogLevel("Core3.PlayerLogLevel", Logger::INFO);
+
+			return playerLogLevel.get();
 		}
 
 		inline int getMaxLogLines() {
@@ -583,23 +590,13 @@ namespace conf {
 		}
 
 		inline int getSessionStatsSeconds() {
-			static uint32 cachedVersion = 0;
-			static int cachedSessionStatsSeconds;
+			static ConfigHandle<int> sessionStatsSeconds("Core3.SessionStatsSeconds", 1800);
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedSessionStatsSeconds = getInt("Core3.SessionStatsSeconds", 1800);
 #ifndef NDEBUG
-				if (cachedSessionStatsSeconds < 300) {
-					cachedSessionStatsSeconds = 300;
-				} else if (cachedSessionStatsSeconds > 3600) {
-					cachedSessionStatsSeconds = 3600;
-				}
+			return Math::clamp(300, sessionStatsSeconds.get(), 3600);
+#else // NDEBUG
+			return sessionStatsSeconds.get();
 #endif // !NDEBUG
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedSessionStatsSeconds;
 		}
 
 		inline int getOnlineLogSeconds() {
@@ -607,221 +604,105 @@ namespace conf {
 		}
 
 		inline int getOnlineLogSize() {
-			static uint32 cachedVersion = 0;
-			static int cachedOnlineLogSize;
+			static ConfigHandle<int> onlineLogSize("Core3.OnlineLogSize", 100000000);
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedOnlineLogSize = getInt("Core3.OnlineLogSize", 100000000);
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedOnlineLogSize;
+			return onlineLogSize.get();
 		}
 
 		inline String getNoTradeMessage() {
-			static uint32 cachedVersion = 0;
-			static String cachedNoTradeMessage;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedNoTradeMessage = getString("Core3.TangibleObject.NoTradeMessage", "");
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<String> noTradeMessage("Core3.TangibleObject.NoTradeMessage", "");
 
-			return cachedNoTradeMessage;
+			return noTradeMessage.get();
 		}
 
 		inline String getForceNoTradeMessage() {
-			static uint32 cachedVersion = 0;
-			static String cachedForceNoTradeMessage;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedForceNoTradeMessage = getString("Core3.TangibleObject.ForceNoTradeMessage", "");
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<String> forceNoTradeMessage("Core3.TangibleObject.ForceNoTradeMessage", "");
 
-			return cachedForceNoTradeMessage;
+			return forceNoTradeMessage.get();
 		}
 
 		inline String getForceNoTradeADKMessage() {
-			static uint32 cachedVersion = 0;
-			static String cachedForceNoTradeADKMessage;
+			static ConfigHandle<String> forceNoTradeADKMessage("Core3.TangibleObject.ForceNoTradeADKMessage", "");
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedForceNoTradeADKMessage = getString("Core3.TangibleObject.ForceNoTradeADKMessage", "");
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedForceNoTradeADKMessage;
+			return forceNoTradeADKMessage.get();
 		}
 
 		inline uint32 getAiAgentConsoleThrottle() {
-			static uint32 cachedVersion = 0;
-			static uint32 cachedValue;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
 #ifdef DEBUG_AI
-				cachedValue = getInt("Core3.AiAgent.ConsoleThrottle", 1);
+			static ConfigHandle<int> consoleThrottle("Core3.AiAgent.ConsoleThrottle", 1);
 #else // !DEBUG_AI
-				cachedValue = getInt("Core3.AiAgent.ConsoleThrottle", 100);
+			static ConfigHandle<int> consoleThrottle("Core3.AiAgent.ConsoleThrottle", 100);
 #endif // DEBUG_AI
-				if (cachedVersion <= 0) {
-					cachedVersion = 1;
-				}
 
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedValue;
+			return consoleThrottle.get();
 		}
 
 #ifdef DEBUG_AI
 		inline bool getAiAgentLoadTesting() {
-			static uint32 cachedVersion = 0;
-			static bool cachedAiAgentLoadTesting;
+			static ConfigHandle<bool> aiAgentLoadTesting("Core3.AiAgent.AiAgentLoadTesting", false);
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedAiAgentLoadTesting = getBool("Core3.AiAgent.AiAgentLoadTesting", false);
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedAiAgentLoadTesting;
+			return aiAgentLoadTesting.get();
 		}
 #endif // DEBUG_AI
 
 		inline bool isPvpBroadcastChannelEnabled() {
-			static uint32 cachedVersion = 0;
-			static bool cachedPvpBroadcastChannel;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedPvpBroadcastChannel = getBool("Core3.ChatManager.PvpBroadcastChannel", false);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<bool> pvpBroadcastChannel("Core3.ChatManager.PvpBroadcastChannel", false);
 
-			return cachedPvpBroadcastChannel;
+			return pvpBroadcastChannel.get();
 		}
 
 		inline bool useCovertOvertSystem() {
-			static uint32 cachedVersion = 0;
-			static bool cachedCovertOvertSystem;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedCovertOvertSystem = getBool("Core3.GCWManager.useCovertOvertSystem", false);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<bool> covertOvertSystem("Core3.GCWManager.useCovertOvertSystem", false);
 
-			return cachedCovertOvertSystem;
+			return covertOvertSystem.get();
 		}
 
 		inline bool getLoginEnableSessionId() {
-			static uint32 cachedVersion = 0;
-			static bool cachedEnableSessionId;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedEnableSessionId = getBool("Core3.Login.EnableSessionId", false);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<bool> enableSessionId("Core3.Login.EnableSessionId", false);
 
-			return cachedEnableSessionId;
+			return enableSessionId.get();
 		}
 
 		inline int getMinLairSpawnInterval() {
-			static uint32 cachedVersion = 0;
-			static int cachedMinSpawnDelay;
+			static ConfigHandle<int> minSpawnDelay("Core3.Regions.minimumLairSpawnInterval", 5000);
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedMinSpawnDelay = getInt("Core3.Regions.minimumLairSpawnInterval", 5000);
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedMinSpawnDelay;
+			return minSpawnDelay.get();
 		}
 
 		inline int getMinSpaceSpawnInterval() {
-			static uint32 cachedVersion = 0;
-			static int cachedMinSpaceSpawnDelay;
+			static ConfigHandle<int> minSpaceSpawnDelay("Core3.Regions.minimumSpaceSpawnInterval", 5000);
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedMinSpaceSpawnDelay = getInt("Core3.Regions.minimumSpaceSpawnInterval", 5000);
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedMinSpaceSpawnDelay;
+			return minSpaceSpawnDelay.get();
 		}
 
 		inline bool disableWorldSpawns() {
-			static uint32 cachedVersion = 0;
-			static bool cachedDisableWorldSpawns;
+			static ConfigHandle<bool> disableWorldSpawns("Core3.Regions.DisableWorldSpawns", false);
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedDisableWorldSpawns = getBool("Core3.Regions.DisableWorldSpawns", false);
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedDisableWorldSpawns;
+			return disableWorldSpawns.get();
 		}
 
 		inline bool disableSpaceSpawns() {
-			static uint32 cachedVersion = 0;
-			static bool cachedDisableSpaceSpawns;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedDisableSpaceSpawns = getBool("Core3.Regions.DisableSpaceSpawns", false);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<bool> disableSpaceSpawns("Core3.Regions.DisableSpaceSpawns", false);
 
-			return cachedDisableSpaceSpawns;
+			return disableSpaceSpawns.get();
 		}
 
 		inline float getSpawnCheckRange() {
-			static uint32 cachedVersion = 0;
-			static float cachedSpawnRange;
+			static ConfigHandle<float> spawnRange("Core3.Regions.spawnCheckRange", 64.f);
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedSpawnRange = getFloat("Core3.Regions.spawnCheckRange", 64.f);
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedSpawnRange;
+			return spawnRange.get();
 		}
 
 		inline float getSpaceSpawnCheckRange() {
-			static uint32 cachedVersion = 0;
-			static float cachedSpaceSpawnRange;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedSpaceSpawnRange = getFloat("Core3.Regions.spaceSpawnCheckRange", 1024.f);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<float> spaceSpawnRange("Core3.Regions.spaceSpawnCheckRange", 1024.f);
 
-			return cachedSpaceSpawnRange;
+			return spaceSpawnRange.get();
 		}
 
 		inline bool getLootDebugAttributes() {
-			static uint32 cachedVersion = 0;
-			static bool cachedValue;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedValue = getBool("Core3.LootManager.DebugAttributes", false);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<bool> value("Core3.LootManager.DebugAttributes", false);
 
-			return cachedValue;
+			return value.get();
 		}
 
 
@@ -833,31 +714,45 @@ namespace conf {
 
 
 		inline bool isJtlEnabled() {
-			static uint32 cachedVersion = 0;
-			static bool cachedJtlEnabled;
+			static ConfigHandle<bool> jtlEnabled("Core3.JTL.JTLEnabled", false);
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedJtlEnabled = getBool("Core3.JTL.JTLEnabled", false);
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedJtlEnabled;
+			return jtlEnabled.get();
 		}
 
 		inline bool launchFromDevice() {
-			static uint32 cachedVersion = 0;
-			static bool cachedLaunchFromDevice;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedLaunchFromDevice = getBool("Core3.JTL.LaunchFromDevice", false);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<bool> launchFromDevice("Core3.JTL.LaunchFromDevice", false);
 
-			return cachedLaunchFromDevice;
+			return launchFromDevice.get();
 		}
 	};
+
+	template <typename T>
+	ConfigHandle<T>::ConfigHandle(const String& name, const T& defaultValue) {
+		manager = ConfigManager::instance();
+
+		ConfigDataItem defaultItem(defaultValue);
+		slot = manager->registerHandle(name, defaultItem);
+	}
+
+	template <typename T>
+	inline T ConfigHandle<T>::get() const {
+		slot->getReads().increment();
+
+		HazardGuard<ConfigSnapshot> current(manager->getSnapshot());
+
+		if (current->getVersion() != manager->getConfigVersion()) {
+			manager->tryRefreshSnapshot();
+			current.reload();
+		}
+
+		// Registered after this snapshot was built by another thread
+		if (slot->getIndex() >= current->getSize()) {
+			manager->refreshSnapshot();
+			current.reload();
+		}
+
+		return current->getValue(slot->getIndex()).get<T>();
+	}
 }
 
 using namespace conf;
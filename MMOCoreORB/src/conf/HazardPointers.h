@@ -0,0 +1,222 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef HAZARDPOINTERS_H_
+#define HAZARDPOINTERS_H_
+
+#include <atomic>
+
+#include "engine/engine.h"
+
+namespace conf {
+	/**
+	 * Hazard pointers of the tables that are read without locking and replaced
+	 * by copy on write. Each thread publishes the tables it is reading in its
+	 * own slots, so a writer knows which of the tables it swapped out it can
+	 * free. See HazardGuard and RetireList.
+	 */
+	class HazardPointers {
+	public:
+		// Guards a thread can hold at once
+		const static int SLOTS_PER_THREAD = 4;
+
+	private:
+		struct ThreadSlots {
+			std::atomic<const void*> pointers[SLOTS_PER_THREAD];
+			std::atomic<bool> inUse;
+			ThreadSlots* next;
+			int depth;
+
+			ThreadSlots() : inUse(true), next(nullptr), depth(0) {
+				for (int i = 0; i < SLOTS_PER_THREAD; ++i)
+					pointers[i].store(nullptr, std::memory_order_relaxed);
+			}
+		};
+
+		// Gives the slots of an exiting thread to the next new one
+		struct ThreadSlotsOwner {
+			ThreadSlots* slots;
+
+			ThreadSlotsOwner() : slots(acquireThreadSlots()) {
+			}
+
+			~ThreadSlotsOwner() {
+				slots->inUse.store(false, std::memory_order_release);
+			}
+		};
+
+		// Slots are never freed, there is one per thread that ever read a table
+		static std::atomic<ThreadSlots*>& getHead() {
+			static std::atomic<ThreadSlots*> head(nullptr);
+
+			return head;
+		}
+
+		static ThreadSlots* acquireThreadSlots() {
+			std::atomic<ThreadSlots*>& head = getHead();
+
+			for (ThreadSlots* slots = head.load(std::memory_order_acquire); slots != nullptr; slots = slots->next) {
+				bool expected = false;
+
+				if (!slots->inUse.load(std::memory_order_relaxed) && slots->inUse.compare_exchange_strong(expected, true))
+					return slots;
+			}
+
+			ThreadSlots* slots = new ThreadSlots();
+			ThreadSlots* next = head.load(std::memory_order_relaxed);
+
+			do {
+				slots->next = next;
+			} while (!head.compare_exchange_weak(next, slots, std::memory_order_release, std::memory_order_relaxed));
+
+			return slots;
+		}
+
+		static ThreadSlots* getThreadSlots() {
+			static thread_local ThreadSlotsOwner owner;
+
+			return owner.slots;
+		}
+
+	public:
+		/**
+		 * Publishes the value of source in a free slot of the current thread.
+		 * @param slot set to the slot to pass to release
+		 */
+		template <typename T>
+		static const T* protect(const std::atomic<T*>& source, std::atomic<const void*>*& slot) {
+			ThreadSlots* slots = getThreadSlots();
+
+			if (slots->depth >= SLOTS_PER_THREAD)
+				throw Exception("HazardPointers: too many nested guards");
+
+			slot = &slots->pointers[slots->depth++];
+
+			return reload(source, slot);
+		}
+
+		/**
+		 * Publishes the current value of source in slot, replacing the one it held.
+		 */
+		template <typename T>
+		static const T* reload(const std::atomic<T*>& source, std::atomic<const void*>* slot) {
+			const T* value = source.load(std::memory_order_acquire);
+
+			while (true) {
+				slot->store(value, std::memory_order_seq_cst);
+
+				// Still published after the slot became visible, no writer can free it now
+				const T* current = source.load(std::memory_order_seq_cst);
+
+				if (current == value)
+					return value;
+
+				value = current;
+			}
+		}
+
+		static void release(std::atomic<const void*>* slot) {
+			slot->store(nullptr, std::memory_order_release);
+
+			--getThreadSlots()->depth;
+		}
+
+		/**
+		 * @return true if a reader may still be using pointer
+		 */
+		static bool isProtected(const void* pointer) {
+			for (ThreadSlots* slots = getHead().load(std::memory_order_acquire); slots != nullptr; slots = slots->next) {
+				for (int i = 0; i < SLOTS_PER_THREAD; ++i) {
+					if (slots->pointers[i].load(std::memory_order_seq_cst) == pointer)
+						return true;
+				}
+			}
+
+			return false;
+		}
+	};
+
+	/**
+	 * Scoped read of a table published through an atomic pointer. The table
+	 * stays allocated until the guard goes out of scope, even if a writer
+	 * replaces it meanwhile.
+	 */
+	template <typename T>
+	class HazardGuard {
+		const std::atomic<T*>& source;
+		std::atomic<const void*>* slot;
+		const T* value;
+
+	public:
+		HazardGuard(const std::atomic<T*>& source) : source(source) {
+			value = HazardPointers::protect(source, slot);
+		}
+
+		~HazardGuard() {
+			HazardPointers::release(slot);
+		}
+
+		HazardGuard(const HazardGuard&) = delete;
+		HazardGuard& operator=(const HazardGuard&) = delete;
+
+		/**
+		 * Switches to the table published now, after the caller replaced it.
+		 */
+		inline void reload() {
+			value = HazardPointers::reload(source, slot);
+		}
+
+		inline const T* get() const {
+			return value;
+		}
+
+		inline const T* operator->() const {
+			return value;
+		}
+	};
+
+	/**
+	 * Tables a writer swapped out. Each one is freed by the first retire or
+	 * reclaim call made once no HazardGuard holds it, and the ones left are
+	 * freed with the list. Callers serialize the calls with their writer lock,
+	 * and must replace the published pointer with a sequentially consistent
+	 * store before retiring the old table.
+	 */
+	template <typename T>
+	class RetireList {
+		Vector<const T*> retired;
+
+	public:
+		~RetireList() {
+			for (int i = 0; i < retired.size(); ++i)
+				delete retired.getUnsafe(i);
+		}
+
+		void retire(const T* value) {
+			if (value != nullptr)
+				retired.add(value);
+
+			reclaim();
+		}
+
+		void reclaim() {
+			for (int i = retired.size() - 1; i >= 0; --i) {
+				const T* value = retired.getUnsafe(i);
+
+				if (HazardPointers::isProtected(value))
+					continue;
+
+				retired.remove(i);
+
+				delete value;
+			}
+		}
+
+		int size() const {
+			return retired.size();
+		}
+	};
+}
+
+#endif // #ifndef HAZARDPOINTERS_H_
@@ -12,6 +12,7 @@
 #include "server/zone/managers/collision/NavMeshManager.h"
 #include "server/zone/managers/director/DirectorManager.h"
 #include "server/zone/managers/object/ObjectManager.h"
+#include "terrain/manager/TerrainManager.h"
 
 #ifdef COMPILE_CORE3_TESTS
 #include "tests/TestCore.h"
@@ -81,6 +82,16 @@ int main(int argc, char* argv[]) {
 			NavMeshManager::instance()->info("Dumping nav meshes to files...", true);
 
 			NavMeshManager::instance()->dumpMeshesToFiles();
+		} else if (arguments.contains("bakeNavMeshTileStores")) {
+			NavMeshManager::instance()->info("Baking nav meshes to the tile store...", true);
+
+			NavMeshManager::instance()->bakeMeshesToTileStore();
+		} else if (arguments.contains("bakeTerrain")) {
+			ConfigManager::instance()->loadConfigData();
+
+			Logger::console.info("Baking planet terrains...", true);
+
+			TerrainManager::bakeTerrainFiles(arguments.contains("quantize"));
 		} else {
 			bool truncateData = arguments.contains("clean");
 
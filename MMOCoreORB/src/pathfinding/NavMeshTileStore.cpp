@@ -0,0 +1,318 @@
+/*
+ * NavMeshTileStore.cpp
+ */
+
+#include "NavMeshTileStore.h"
+#include "conf/ConfigManager.h"
+#include "pathfinding/recast/DetourCommon.h"
+
+#ifndef PLATFORM_WIN
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+NavMeshTileStore::NavMeshTileStore() : Logger("NavMeshTileStore") {
+	fd = -1;
+	base = nullptr;
+	length = 0;
+	header = nullptr;
+	entries = nullptr;
+	digest = 0;
+}
+
+NavMeshTileStore::~NavMeshTileStore() {
+	close();
+}
+
+String NavMeshTileStore::getStorePath(const String& meshName) {
+	return "navmeshes/" + meshName + ".tiles";
+}
+
+bool NavMeshTileStore::isEnabled() {
+#ifdef PLATFORM_WIN
+	return false;
+#else
+	static const bool enabled = ConfigManager::instance()->getBool("Core3.NavMeshStore.Enabled", true);
+
+	return enabled;
+#endif
+}
+
+static uint64 hashBytes(uint64 hash, const byte* data, int size) {
+	// FNV-1a
+	for (int i = 0; i < size; ++i) {
+		hash ^= data[i];
+		hash *= 0x100000001B3ULL;
+	}
+
+	return hash;
+}
+
+uint64 NavMeshTileStore::hashTileData(const byte* data, int size) {
+	uint64 hash = 0xCBF29CE484222325ULL;
+
+	// Database tiles are not necessarily aligned
+	dtMeshHeader meshHeader;
+
+	if (size < (int) sizeof(dtMeshHeader))
+		return hashBytes(hash, data, size);
+
+	memcpy(&meshHeader, data, sizeof(dtMeshHeader));
+
+	if (meshHeader.magic != DT_NAVMESH_MAGIC)
+		return hashBytes(hash, data, size);
+
+	// Same layout as dtNavMesh::addTile
+	const int headerSize = dtAlign4(sizeof(dtMeshHeader));
+	const int vertsSize = dtAlign4(sizeof(float) * 3 * meshHeader.vertCount);
+	const int polysSize = dtAlign4(sizeof(dtPoly) * meshHeader.polyCount);
+	const int linksSize = dtAlign4(sizeof(dtLink) * meshHeader.maxLinkCount);
+
+	const int polysOffset = headerSize + vertsSize;
+	const int linksOffset = polysOffset + polysSize;
+	const int detailOffset = linksOffset + linksSize;
+
+	if (detailOffset > size)
+		return hashBytes(hash, data, size);
+
+	hash = hashBytes(hash, data, polysOffset);
+
+	// Detour relinks the polygons whenever the tile is added, leave the links out
+	for (int i = 0; i < meshHeader.polyCount; ++i) {
+		dtPoly poly;
+		memcpy(&poly, data + polysOffset + i * sizeof(dtPoly), sizeof(dtPoly));
+		poly.firstLink = 0;
+
+		hash = hashBytes(hash, reinterpret_cast<const byte*>(&poly), sizeof(dtPoly));
+	}
+
+	return hashBytes(hash, data + detailOffset, size - detailOffset);
+}
+
+bool NavMeshTileStore::write(const String& path, const dtNavMesh* mesh, uint64 inputSalt, const VectorMap<uint64, uint64>& tileHashes) {
+	if (mesh == nullptr)
+		return false;
+
+	Vector<const dtMeshTile*> tiles;
+
+	for (int i = 0; i < mesh->getMaxTiles(); ++i) {
+		const dtMeshTile* tile = mesh->getTile(i);
+
+		if (!tile || !tile->header || !tile->dataSize)
+			continue;
+
+		tiles.add(tile);
+	}
+
+	NavMeshTileStoreHeader storeHeader;
+	memset(&storeHeader, 0, sizeof(storeHeader));
+
+	storeHeader.magic = NAVMESHTILESTORE_MAGIC;
+	storeHeader.version = NAVMESHTILESTORE_VERSION;
+	storeHeader.numTiles = tiles.size();
+	storeHeader.inputSalt = inputSalt;
+	memcpy(&storeHeader.params, mesh->getParams(), sizeof(dtNavMeshParams));
+
+	// Tile data is kept 16 byte aligned for Detour
+	auto align = [] (uint64 offset) -> uint64 {
+		return (offset + 15) & ~((uint64) 15);
+	};
+
+	uint64 dataOffset = align(sizeof(NavMeshTileStoreHeader) + sizeof(NavMeshTileStoreEntry) * tiles.size());
+
+	Vector<NavMeshTileStoreEntry> storeEntries;
+
+	for (int i = 0; i < tiles.size(); ++i) {
+		const dtMeshTile* tile = tiles.get(i);
+
+		NavMeshTileStoreEntry entry;
+		memset(&entry, 0, sizeof(entry));
+
+		entry.tileRef = mesh->getTileRef(tile);
+		entry.tileX = tile->header->x;
+		entry.tileY = tile->header->y;
+		entry.layer = tile->header->layer;
+		entry.inputHash = tileHashes.get(getTileKey(entry.tileX, entry.tileY, entry.layer));
+		entry.dataOffset = dataOffset;
+		entry.dataSize = tile->dataSize;
+		entry.dataHash = hashTileData(tile->data, tile->dataSize);
+
+		storeEntries.add(entry);
+
+		dataOffset = align(dataOffset + tile->dataSize);
+	}
+
+	String tempPath = path + ".tmp";
+
+	FILE* fp = fopen(tempPath.toCharArray(), "wb");
+
+	if (!fp) {
+		Logger::console.error() << "could not open file to save navmesh tiles: " << tempPath;
+		return false;
+	}
+
+	bool success = fwrite(&storeHeader, sizeof(storeHeader), 1, fp) == 1;
+
+	for (int i = 0; success && i < storeEntries.size(); ++i) {
+		success = fwrite(&storeEntries.get(i), sizeof(NavMeshTileStoreEntry), 1, fp) == 1;
+	}
+
+	static const byte padding[16] = {0};
+
+	for (int i = 0; success && i < tiles.size(); ++i) {
+		const NavMeshTileStoreEntry& entry = storeEntries.get(i);
+		long position = ftell(fp);
+
+		if (position < (long) entry.dataOffset)
+			success = fwrite(padding, entry.dataOffset - position, 1, fp) == 1;
+
+		if (success)
+			success = fwrite(tiles.get(i)->data, entry.dataSize, 1, fp) == 1;
+	}
+
+	if (fclose(fp) != 0)
+		success = false;
+
+	if (!success || rename(tempPath.toCharArray(), path.toCharArray()) != 0) {
+		Logger::console.error() << "could not write navmesh tiles to " << path;
+		remove(tempPath.toCharArray());
+
+		return false;
+	}
+
+	return true;
+}
+
+bool NavMeshTileStore::open(const String& storePath) {
+	close();
+
+#ifdef PLATFORM_WIN
+	return false;
+#else
+	path = storePath;
+	setLoggingName("NavMeshTileStore " + path);
+
+	fd = ::open(path.toCharArray(), O_RDONLY);
+
+	if (fd == -1)
+		return false;
+
+	struct stat st;
+
+	if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(NavMeshTileStoreHeader)) {
+		close();
+		return false;
+	}
+
+	length = st.st_size;
+
+	// Writable for Detour, the writes stay private to this process
+	void* mapping = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+	if (mapping == MAP_FAILED) {
+		error() << "could not map " << path;
+
+		base = nullptr;
+		close();
+
+		return false;
+	}
+
+	base = static_cast<byte*>(mapping);
+
+	const NavMeshTileStoreHeader* storeHeader = reinterpret_cast<const NavMeshTileStoreHeader*>(base);
+
+	if (storeHeader->magic != NAVMESHTILESTORE_MAGIC || storeHeader->version != NAVMESHTILESTORE_VERSION || storeHeader->numTiles < 0) {
+		info() << "ignoring outdated navmesh tile store " << path;
+
+		close();
+		return false;
+	}
+
+	uint64 tableEnd = sizeof(NavMeshTileStoreHeader) + sizeof(NavMeshTileStoreEntry) * (uint64) storeHeader->numTiles;
+
+	if (tableEnd > length) {
+		error() << "truncated tile table in " << path;
+
+		close();
+		return false;
+	}
+
+	const NavMeshTileStoreEntry* storeEntries = reinterpret_cast<const NavMeshTileStoreEntry*>(base + sizeof(NavMeshTileStoreHeader));
+	uint64 storeDigest = 0;
+
+	for (int i = 0; i < storeHeader->numTiles; ++i) {
+		const NavMeshTileStoreEntry& entry = storeEntries[i];
+
+		if (entry.dataSize <= 0 || entry.dataOffset < tableEnd || entry.dataOffset + entry.dataSize > length) {
+			error() << "invalid tile entry " << i << " in " << path;
+
+			close();
+			return false;
+		}
+
+		storeDigest = addToDigest(storeDigest, entry.tileRef, entry.dataHash);
+	}
+
+	header = storeHeader;
+	entries = storeEntries;
+	digest = storeDigest;
+
+	// Tiles are paged in as queries reach them
+	madvise(base, length, MADV_RANDOM);
+
+	return true;
+#endif
+}
+
+void NavMeshTileStore::close() {
+#ifndef PLATFORM_WIN
+	if (base != nullptr)
+		munmap(base, length);
+
+	if (fd != -1)
+		::close(fd);
+#endif
+
+	fd = -1;
+	base = nullptr;
+	length = 0;
+	header = nullptr;
+	entries = nullptr;
+	digest = 0;
+}
+
+dtNavMesh* NavMeshTileStore::createNavMesh() {
+	if (!isOpen())
+		return nullptr;
+
+	dtNavMesh* mesh = dtAllocNavMesh();
+
+	if (!mesh)
+		return nullptr;
+
+	dtStatus status = mesh->init(&header->params);
+
+	if (dtStatusFailed(status)) {
+		dtFreeNavMesh(mesh);
+		return nullptr;
+	}
+
+	for (int i = 0; i < header->numTiles; ++i) {
+		const NavMeshTileStoreEntry& entry = entries[i];
+
+		// No DT_TILE_FREE_DATA, the data belongs to the mapping
+		status = mesh->addTile(base + entry.dataOffset, entry.dataSize, 0, entry.tileRef, 0);
+
+		if (dtStatusFailed(status)) {
+			error() << "could not add tile " << entry.tileX << ", " << entry.tileY << " from " << path;
+
+			dtFreeNavMesh(mesh);
+			return nullptr;
+		}
+	}
+
+	return mesh;
+}
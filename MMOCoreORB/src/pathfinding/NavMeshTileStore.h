@@ -0,0 +1,129 @@
+/*
+ * NavMeshTileStore.h
+ */
+
+#ifndef NAVMESHTILESTORE_H_
+#define NAVMESHTILESTORE_H_
+
+#include "engine/engine.h"
+#include "pathfinding/recast/DetourNavMesh.h"
+
+static const int NAVMESHTILESTORE_MAGIC = 'N'<<24 | 'M'<<16 | 'T'<<8 | 'S'; //'NMTS';
+static const int NAVMESHTILESTORE_VERSION = 3;
+
+struct NavMeshTileStoreHeader {
+	int magic;
+	int version;
+	int numTiles;
+	int reserved;
+	// Hash of the mesh wide build inputs (zone, bounds, settings)
+	uint64 inputSalt;
+	dtNavMeshParams params;
+};
+
+struct NavMeshTileStoreEntry {
+	dtTileRef tileRef;
+	// Hash of the objects the tile was built from, 0 when unknown
+	uint64 inputHash;
+	// Hash of the stored tile data, see hashTileData
+	uint64 dataHash;
+	uint64 dataOffset;
+	int dataSize;
+	int tileX;
+	int tileY;
+	int layer;
+};
+
+/**
+ * Memory mapped store of the tiles of a navmesh. The file is laid out as a header,
+ * the tile table and the raw Detour tile data. The mesh created from a store keeps
+ * its tiles in the private mapping: Detour only writes the polygons and links of a
+ * tile, so the vertices, detail meshes and BV trees stay clean file pages that are
+ * read the first time a query touches the tile and can be dropped under memory
+ * pressure. The database still holds every tile, see RecastNavMesh::loadAll.
+ */
+class NavMeshTileStore : public Object, public Logger {
+	String path;
+
+	int fd;
+	byte* base;
+	uint64 length;
+
+	const NavMeshTileStoreHeader* header;
+	const NavMeshTileStoreEntry* entries;
+
+	uint64 digest;
+
+public:
+	NavMeshTileStore();
+	~NavMeshTileStore();
+
+	static String getStorePath(const String& meshName);
+
+	static bool isEnabled();
+
+	static inline uint64 getTileKey(int x, int y, int layer) {
+		return ((uint64)(uint32) x << 32) | ((uint64)(uint16) y << 16) | (uint16) layer;
+	}
+
+	/**
+	 * Hashes a Detour tile without the link data that Detour rewrites when it adds the
+	 * tile, so the same tile hashes the same in the database and in the store.
+	 */
+	static uint64 hashTileData(const byte* data, int size);
+
+	/**
+	 * Order independent digest of the tile references and data hashes, a store is only
+	 * used for a mesh whose database tiles have the same digest.
+	 */
+	static inline uint64 addToDigest(uint64 digest, dtTileRef tileRef, uint64 dataHash) {
+		uint64 hash = ((uint64) tileRef ^ (dataHash * 0x9E3779B97F4A7C15ULL)) * 0xBF58476D1CE4E5B9ULL;
+
+		return digest + (hash ^ (hash >> 31));
+	}
+
+	/**
+	 * Writes mesh to path, replacing the previous file atomically.
+	 * @param tileHashes input hash per tile key, tiles missing from it are stored with hash 0
+	 */
+	static bool write(const String& path, const dtNavMesh* mesh, uint64 inputSalt, const VectorMap<uint64, uint64>& tileHashes);
+
+	bool open(const String& path);
+
+	void close();
+
+	/**
+	 * Creates a navmesh whose tiles point into the mapping, the store must outlive it.
+	 */
+	dtNavMesh* createNavMesh();
+
+	inline bool isOpen() const {
+		return header != nullptr;
+	}
+
+	inline int getNumTiles() const {
+		return header != nullptr ? header->numTiles : 0;
+	}
+
+	inline const NavMeshTileStoreEntry& getEntry(int i) const {
+		return entries[i];
+	}
+
+	inline uint64 getDigest() const {
+		return digest;
+	}
+
+	inline uint64 getInputSalt() const {
+		return header != nullptr ? header->inputSalt : 0;
+	}
+
+	inline const dtNavMeshParams* getParams() const {
+		return header != nullptr ? &header->params : nullptr;
+	}
+
+	inline const String& getPath() const {
+		return path;
+	}
+};
+
+#endif /* NAVMESHTILESTORE_H_ */
@@ -41,6 +41,32 @@ void RecastNavMesh::loadAll(ObjectInputStream* stream) {
 		return;
 	}
 
+	// The database keeps every tile, they are mapped from a tile store holding the same ones instead of copied
+	if (NavMeshTileStore::isEnabled()) {
+		int tilesOffset = stream->getOffset();
+		uint64 digest = 0;
+		bool validTiles = true;
+
+		for (int i = 0; i < header.numTiles && validTiles; ++i) {
+			NavMeshTileHeader tileHeader;
+			stream->readStream((char*)&tileHeader, sizeof(tileHeader));
+
+			validTiles = tileHeader.tileRef && tileHeader.dataSize > 0 && stream->getOffset() + tileHeader.dataSize <= stream->size();
+
+			if (validTiles) {
+				const byte* data = reinterpret_cast<const byte*>(stream->getBuffer() + stream->getOffset());
+
+				digest = NavMeshTileStore::addToDigest(digest, tileHeader.tileRef, NavMeshTileStore::hashTileData(data, tileHeader.dataSize));
+				stream->shiftOffset(tileHeader.dataSize);
+			}
+		}
+
+		if (validTiles && loadFromTileStore(digest))
+			return;
+
+		stream->setOffset(tilesOffset);
+	}
+
 	dtNavMesh* mesh = dtAllocNavMesh();
 	if (!mesh) {
 		error("Failed to allocate RecastNavMesh " + name);
@@ -83,6 +109,42 @@ void RecastNavMesh::loadAll(ObjectInputStream* stream) {
 	navMesh = mesh;
 }
 
+bool RecastNavMesh::loadFromTileStore(uint64 digest) {
+	Reference<NavMeshTileStore*> store = new NavMeshTileStore();
+
+	if (!store->open(NavMeshTileStore::getStorePath(name)))
+		return false;
+
+	// A store written before or after the last database save doesn't hold the saved tiles
+	if (store->getNumTiles() != header.numTiles || memcmp(store->getParams(), &header.params, sizeof(dtNavMeshParams)) != 0
+			|| store->getDigest() != digest) {
+		info() << "tile store of " << name << " does not match the saved mesh";
+		return false;
+	}
+
+	dtNavMesh* mesh = store->createNavMesh();
+
+	if (mesh == nullptr) {
+		error() << "failed to create RecastNavMesh " << name << " from its tile store";
+		return false;
+	}
+
+	navMesh = mesh;
+	tileStore = store;
+
+	return true;
+}
+
+bool RecastNavMesh::saveToTileStore(uint64 inputSalt, const VectorMap<uint64, uint64>& tileHashes) {
+	if (!navMesh) {
+		error("trying to save a nullptr nav mesh to the tile store from RecastNavMesh " + name);
+		return false;
+	}
+
+	// The mapped file is replaced by rename, the current mapping stays valid
+	return NavMeshTileStore::write(NavMeshTileStore::getStorePath(name), navMesh, inputSalt, tileHashes);
+}
+
 void RecastNavMesh::saveAll(ObjectOutputStream* stream) {
 	name.toBinaryStream(stream);
 
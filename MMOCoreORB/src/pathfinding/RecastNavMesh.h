@@ -10,6 +10,7 @@
 
 #include "engine/engine.h"
 #include "pathfinding/RecastTileBuilder.h"
+#include "pathfinding/NavMeshTileStore.h"
 
 class dtNavMesh;
 
@@ -17,10 +18,15 @@ class RecastNavMesh : public Object, public Logger {
 	void loadAll(ObjectInputStream* stream);
 	void saveAll(ObjectOutputStream* stream);
 
+	bool loadFromTileStore(uint64 digest);
+
 	dtNavMesh *navMesh;
 	NavMeshSetHeader header;
 	String name;
 
+	// Tile store navMesh was loaded from, its mapping holds the tile data of navMesh
+	Reference<NavMeshTileStore*> tileStore;
+
 public:
 	RecastNavMesh() : Logger("RecastNavMesh"), header() {
 		navMesh = nullptr;
@@ -52,6 +58,17 @@ public:
 
 	void setDetourNavMesh(dtNavMesh* navMesh) {
 		this->navMesh = navMesh;
+
+		// The previous mesh was freed by the caller, so its tiles can be unmapped
+		tileStore = nullptr;
+	}
+
+	Reference<NavMeshTileStore*> getTileStore() const {
+		return tileStore;
+	}
+
+	const String& getName() const {
+		return name;
 	}
 
 	void setName(const String& name) {
@@ -64,5 +81,7 @@ public:
 	void copyMeshTo(dtNavMesh* mesh);
 
 	void saveToFile();
+
+	bool saveToTileStore(uint64 inputSalt, const VectorMap<uint64, uint64>& tileHashes);
 };
 #endif /* RECASTNAVMESH_H_ */
@@ -26,6 +26,7 @@
 #include "server/zone/managers/player/PlayerManager.h"
 #include "server/zone/managers/director/DirectorManager.h"
 #include "server/zone/managers/collision/NavMeshManager.h"
+#include "server/zone/managers/logging/AsyncLogManager.h"
 #include "server/zone/managers/name/NameManager.h"
 #include "server/zone/managers/frs/FrsManager.h"
 
@@ -970,6 +971,8 @@ void ServerCore::shutdown() {
 		zoneServer = nullptr;
 	}
 
+	AsyncLogManager::instance()->stop();
+
 	DistributedObjectDirectory* dir = objectManager->getLocalObjectDirectory();
 
 	HashTable<uint64, Reference<DistributedObject*> > tbl;
@@ -18,6 +18,7 @@
 
 #include "server/zone/packets/chat/ChatRoomList.h"
 #include "server/zone/packets/chat/ChatRoomMessage.h"
+#include "server/zone/packets/chat/ChatSystemMessage.h"
 #include "server/zone/packets/object/SpatialChat.h"
 #include "server/zone/packets/object/Emote.h"
 #include "server/zone/packets/chat/ChatInstantMessageToCharacter.h"
@@ -966,18 +967,9 @@ CreatureObject* ChatManagerImplementation::removePlayer(const String& name) {
 }
 
 void ChatManagerImplementation::broadcastGalaxy(const String& message, const String& faction) {
-	Locker locker(_this.getReferenceUnsafeStaticCast());
-
-	playerMap->resetIterator(false);
-
-	uint32 factionCRC = faction.hashCode();
+	UnicodeString unicodeMessage(message);
 
-	while (playerMap->hasNext(false)) {
-		ManagedReference<CreatureObject*> playerObject = playerMap->getNextValue(false);
-
-		if (playerObject->getFaction() == factionCRC || playerObject->getPlayerObject()->hasGodMode())
-			playerObject->sendSystemMessage(message);
-	}
+	broadcastToPlayers(new ChatSystemMessage(unicodeMessage), faction.hashCode());
 }
 
 void ChatManagerImplementation::broadcastGalaxy(CreatureObject* creature, const String& message) {
@@ -997,40 +989,80 @@ void ChatManagerImplementation::broadcastGalaxy(CreatureObject* creature, const
 
 	fullMessage << message;
 
-	const auto stringMessage = fullMessage.toString();
+	UnicodeString unicodeMessage(fullMessage.toString());
 
-	Locker locker(_this.getReferenceUnsafeStaticCast());
-	//playerMap->lock();
+	broadcastToPlayers(new ChatSystemMessage(unicodeMessage));
+}
 
-	playerMap->resetIterator(false);
+namespace {
+	// Takes over the reference or copy of message handed to the batch
+	void sendBroadcastBatch(PlayerMapSnapshot* recipients, int start, int end, BasePacket* message, uint32 factionCRC) {
+		for (int i = start; i < end; ++i) {
+			CreatureObject* player = recipients->get(i);
+
+			if (player == nullptr || !player->isOnline())
+				continue;
 
-	while (playerMap->hasNext(false)) {
-		ManagedReference<CreatureObject*> playerObject = playerMap->getNextValue(false);
+			if (factionCRC != 0 && player->getFaction() != factionCRC) {
+				PlayerObject* ghost = player->getPlayerObject();
+
+				if (ghost == nullptr || !ghost->hasGodMode())
+					continue;
+			}
+
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+			player->sendMessage(message);
+#else
+			player->sendMessage(message->clone());
+#endif
+		}
 
-		playerObject->sendSystemMessage(stringMessage);
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+		message->release();
+#else
+		delete message;
+#endif
 	}
 }
 
 void ChatManagerImplementation::broadcastMessage(BaseMessage* message) {
-	Locker _lock(_this.getReferenceUnsafeStaticCast());
-
-	playerMap->resetIterator(false);
+	Reference<PlayerMapSnapshot*> recipients = playerMap->getSnapshot();
 
 #ifdef LOCKFREE_BCLIENT_BUFFERS
 	message->acquire();
 #endif
 
-	while (playerMap->hasNext(false)) {
-		ManagedReference<CreatureObject*> player = playerMap->getNextValue(false);
+	// Deltas have to reach each player in the order they were sent, so no batches on other threads
+	sendBroadcastBatch(recipients, 0, recipients->size(), message, 0);
+}
+
+void ChatManagerImplementation::broadcastToPlayers(BaseMessage* message, uint32 factionCRC) {
+	Reference<PlayerMapSnapshot*> recipients = playerMap->getSnapshot();
+	int total = recipients->size();
 
-		if (player == nullptr || !player->isOnline())
-			continue;
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+	message->acquire();
+#endif
+
+	for (int start = 0; start < total; start += ChatManager::BROADCASTBATCHSIZE) {
+		int end = Math::min(start + ChatManager::BROADCASTBATCHSIZE, total);
 
 #ifdef LOCKFREE_BCLIENT_BUFFERS
-		player->sendMessage(message);
+		BasePacket* batchMessage = message;
+		batchMessage->acquire();
 #else
-		player->sendMessage(message->clone());
+		BasePacket* batchMessage = message->clone();
 #endif
+
+		// The calling thread sends the last batch itself
+		if (end == total) {
+			sendBroadcastBatch(recipients, start, end, batchMessage, factionCRC);
+			break;
+		}
+
+		Core::getTaskManager()->executeTask([recipients, start, end, batchMessage, factionCRC] () {
+			sendBroadcastBatch(recipients, start, end, batchMessage, factionCRC);
+		}, "BroadcastToPlayersLambda");
 	}
 
 #ifdef LOCKFREE_BCLIENT_BUFFERS
@@ -1038,7 +1070,6 @@ void ChatManagerImplementation::broadcastMessage(BaseMessage* message) {
 #else
 	delete message;
 #endif
-	message = nullptr;
 }
 
 // arg1 is preLocked
@@ -0,0 +1,79 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#include "AreaQuery.h"
+
+#include "server/zone/objects/scene/SceneObject.h"
+
+constexpr float AreaQuery::MAX_ENTRY_RADIUS;
+
+AreaQuery::AreaQuery(float x, float z, float y, float radius, uint32 receiverTypes) : x(x), y(y), z(z), radius(radius),
+		cone(false), coneX(0), coneY(0), directionX(0), directionY(0), coneAngle(0), receiverTypes(receiverTypes) {
+}
+
+void AreaQuery::setCone(float apexX, float apexY, float dirX, float dirY, float angle) {
+	cone = true;
+	coneX = apexX;
+	coneY = apexY;
+	directionX = dirX;
+	directionY = dirY;
+	coneAngle = angle;
+}
+
+bool AreaQuery::matches(SceneObject* object) const {
+	if (object == nullptr || !object->isTangibleObject())
+		return false;
+
+	uint32 type = TANGIBLES;
+
+	if (object->isPlayerCreature())
+		type = PLAYERS;
+	else if (object->isCreatureObject())
+		type = CREATURES;
+
+	if (!(receiverTypes & type))
+		return false;
+
+	Vector3 position = object->getWorldPosition();
+
+	float reach = radius + object->getTemplateRadius();
+
+	float deltaX = position.getX() - x;
+	float deltaY = position.getY() - y;
+	float deltaZ = position.getZ() - z;
+
+	if (deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ > reach * reach)
+		return false;
+
+	if (cone) {
+		float resAngle = atan2(object->getPositionY() - coneY, object->getPositionX() - coneX) - atan2(directionY, directionX);
+		float degrees = resAngle * 180 / M_PI;
+
+		if (degrees > coneAngle / 2 || degrees < -coneAngle / 2)
+			return false;
+	}
+
+	return true;
+}
+
+bool AreaQuery::isContainer(SceneObject* object) const {
+	return object != nullptr && (object->isBuildingObject() || object->isVehicleObject() || object->isMount());
+}
+
+bool AreaQuery::isCandidate(TreeEntry* entry) const {
+	SceneObject* object = static_cast<SceneObject*>(entry);
+
+	return isContainer(object) || matches(object);
+}
+
+bool AreaQuery::isOversizedCandidate(TreeEntry* entry) const {
+	SceneObject* object = static_cast<SceneObject*>(entry);
+
+	return object->isInRange(x, y, radius + object->getTemplateRadius()) && isCandidate(object);
+}
+
+bool AreaQuery::isOversized(TreeEntry* entry) {
+	return static_cast<SceneObject*>(entry)->getTemplateRadius() > MAX_ENTRY_RADIUS;
+}
@@ -0,0 +1,112 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#ifndef AREAQUERY_H_
+#define AREAQUERY_H_
+
+#include "engine/engine.h"
+
+namespace server {
+  namespace zone {
+	class TreeEntry;
+
+	namespace objects {
+	  namespace scene {
+		class SceneObject;
+	  }
+	}
+
+	/**
+	 * Sphere or cone of a zone to collect the tangibles of, tested while the
+	 * spatial index is walked so callers only get the entries they asked for.
+	 * The test is conservative: an entry is kept when any part of its template
+	 * radius reaches the area, exact per caller checks are left to the caller.
+	 */
+	class AreaQuery {
+	public:
+		enum ReceiverType : uint32 {
+			PLAYERS = 1 << 0,
+			CREATURES = 1 << 1, // Creature objects that aren't players
+			TANGIBLES = 1 << 2, // Any other tangible
+			ALL_TANGIBLES = PLAYERS | CREATURES | TANGIBLES
+		};
+
+		// Template radius the walk of the index is padded by, larger entries are kept in a list every query checks
+		static constexpr float MAX_ENTRY_RADIUS = 32.f;
+
+	private:
+		float x, y, z;
+		float radius;
+
+		bool cone;
+		float coneX, coneY;
+		float directionX, directionY;
+		float coneAngle;
+
+		uint32 receiverTypes;
+
+	public:
+		AreaQuery(float x, float z, float y, float radius, uint32 receiverTypes = ALL_TANGIBLES);
+
+		/**
+		 * Restricts the area to the cone of angle degrees starting at the apex, in the coordinates of
+		 * the positions of the entries like CombatManager::checkConeAngle.
+		 */
+		void setCone(float apexX, float apexY, float directionX, float directionY, float angle);
+
+		/**
+		 * @return true if the object is a receiver of the query inside the area
+		 */
+		bool matches(objects::scene::SceneObject* object) const;
+
+		/**
+		 * Buildings, vehicles and mounts near the area may hold receivers that aren't in the index.
+		 */
+		bool isContainer(objects::scene::SceneObject* object) const;
+
+		/**
+		 * Test of the spatial index walk.
+		 */
+		bool isCandidate(TreeEntry* entry) const;
+
+		/**
+		 * Test of the entries too large for the walk, which reach the area from farther than the search radius.
+		 */
+		bool isOversizedCandidate(TreeEntry* entry) const;
+
+		/**
+		 * @return true if the template radius of the entry is larger than the walk of the index is padded by
+		 */
+		static bool isOversized(TreeEntry* entry);
+
+		inline float getX() const {
+			return x;
+		}
+
+		inline float getY() const {
+			return y;
+		}
+
+		inline float getZ() const {
+			return z;
+		}
+
+		inline float getRadius() const {
+			return radius;
+		}
+
+		/**
+		 * Range of the walk of the spatial index around x, y.
+		 */
+		inline float getSearchRadius() const {
+			return radius + MAX_ENTRY_RADIUS;
+		}
+	};
+  }
+}
+
+using namespace server::zone;
+
+#endif /* AREAQUERY_H_ */
@@ -0,0 +1,90 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#include "CloseObjectsPositions.h"
+
+#include "server/zone/TreeEntry.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+void CloseObjectsPositions::getRootPosition(TreeEntry* entry, float& x, float& y, float& z) {
+	TreeEntry* rootParent = entry->getRootParentUnsafe();
+
+	if (rootParent != nullptr)
+		entry = rootParent;
+
+	x = entry->getPositionX();
+	y = entry->getPositionY();
+	z = entry->getPositionZ();
+}
+
+int CloseObjectsPositions::filterMovedAway(float x, float y, float z, float oldX, float oldY, float oldZ, Vector<int>& indexes) const {
+	int count = positionX.size();
+	int found = 0;
+	int i = 0;
+
+	if (count == 0)
+		return 0;
+
+	const float* xs = &positionX.getUnsafe(0);
+	const float* ys = &positionY.getUnsafe(0);
+	const float* zs = &positionZ.getUnsafe(0);
+
+#ifdef __SSE2__
+	const __m128 newX = _mm_set1_ps(x);
+	const __m128 newY = _mm_set1_ps(y);
+	const __m128 newZ = _mm_set1_ps(z);
+
+	const __m128 prevX = _mm_set1_ps(oldX);
+	const __m128 prevY = _mm_set1_ps(oldY);
+	const __m128 prevZ = _mm_set1_ps(oldZ);
+
+	for (; i + 4 <= count; i += 4) {
+		__m128 px = _mm_loadu_ps(xs + i);
+		__m128 py = _mm_loadu_ps(ys + i);
+		__m128 pz = _mm_loadu_ps(zs + i);
+
+		__m128 deltaX = _mm_sub_ps(newX, px);
+		__m128 deltaY = _mm_sub_ps(newY, py);
+		__m128 deltaZ = _mm_sub_ps(newZ, pz);
+
+		__m128 distanceSqr = _mm_add_ps(_mm_add_ps(_mm_mul_ps(deltaX, deltaX), _mm_mul_ps(deltaY, deltaY)), _mm_mul_ps(deltaZ, deltaZ));
+
+		__m128 oldDeltaX = _mm_sub_ps(prevX, px);
+		__m128 oldDeltaY = _mm_sub_ps(prevY, py);
+		__m128 oldDeltaZ = _mm_sub_ps(prevZ, pz);
+
+		__m128 oldDistanceSqr = _mm_add_ps(_mm_add_ps(_mm_mul_ps(oldDeltaX, oldDeltaX), _mm_mul_ps(oldDeltaY, oldDeltaY)), _mm_mul_ps(oldDeltaZ, oldDeltaZ));
+
+		int mask = _mm_movemask_ps(_mm_cmpgt_ps(distanceSqr, oldDistanceSqr));
+
+		for (int j = 0; mask != 0; ++j, mask >>= 1) {
+			if (mask & 1) {
+				indexes.add(i + j);
+				++found;
+			}
+		}
+	}
+#endif
+
+	for (; i < count; ++i) {
+		float deltaX = x - xs[i];
+		float deltaY = y - ys[i];
+		float deltaZ = z - zs[i];
+
+		float oldDeltaX = oldX - xs[i];
+		float oldDeltaY = oldY - ys[i];
+		float oldDeltaZ = oldZ - zs[i];
+
+		if (deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ > oldDeltaX * oldDeltaX + oldDeltaY * oldDeltaY + oldDeltaZ * oldDeltaZ) {
+			indexes.add(i);
+			++found;
+		}
+	}
+
+	return found;
+}
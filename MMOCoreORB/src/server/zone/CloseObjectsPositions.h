@@ -0,0 +1,89 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#ifndef CLOSEOBJECTSPOSITIONS_H_
+#define CLOSEOBJECTSPOSITIONS_H_
+
+#include "system/lang.h"
+
+namespace server {
+ namespace zone {
+class TreeEntry;
+
+/**
+ * Root parent positions of the entries of a CloseObjectsVector, stored as a
+ * structure of arrays in the order of its objects so distance sweeps over
+ * hundreds of close objects can be vectorized. The owning vector keeps the
+ * arrays in step with its objects under its own lock, and entries refresh
+ * their position in the vectors of their close objects when they move.
+ */
+class CloseObjectsPositions {
+	Vector<float> positionX;
+	Vector<float> positionY;
+	Vector<float> positionZ;
+
+public:
+	CloseObjectsPositions() {
+	}
+
+	/**
+	 * Reads the position of the root parent of entry, or of entry if it has none.
+	 */
+	static void getRootPosition(server::zone::TreeEntry* entry, float& x, float& y, float& z);
+
+	void removeAll(int newSize = 10, int newIncrement = 5) {
+		positionX.removeAll(newSize, newIncrement);
+		positionY.removeAll(newSize, newIncrement);
+		positionZ.removeAll(newSize, newIncrement);
+	}
+
+	void insert(int index, float x, float y, float z) {
+		positionX.add(index, x);
+		positionY.add(index, y);
+		positionZ.add(index, z);
+	}
+
+	void set(int index, float x, float y, float z) {
+		positionX.setElementAt(index, x);
+		positionY.setElementAt(index, y);
+		positionZ.setElementAt(index, z);
+	}
+
+	void remove(int index) {
+		positionX.remove(index);
+		positionY.remove(index);
+		positionZ.remove(index);
+	}
+
+	/**
+	 * Adds to indexes every entry that is farther from x, y, z than it was
+	 * from oldX, oldY, oldZ, the only ones that can have left the out of
+	 * range distance on this move.
+	 */
+	int filterMovedAway(float x, float y, float z, float oldX, float oldY, float oldZ, Vector<int>& indexes) const;
+
+	inline int size() const {
+		return positionX.size();
+	}
+
+	inline float getPositionX(int index) const {
+		return positionX.getUnsafe(index);
+	}
+
+	inline float getPositionY(int index) const {
+		return positionY.getUnsafe(index);
+	}
+
+	inline float getPositionZ(int index) const {
+		return positionZ.getUnsafe(index);
+	}
+};
+
+ }
+}
+
+using namespace server::zone;
+
+#endif /* CLOSEOBJECTSPOSITIONS_H_ */
@@ -6,11 +6,14 @@
 
 #include "server/zone/TreeEntry.h"
 
-CloseObjectsVector::CloseObjectsVector() : messageReceivers() {
+CloseObjectsVector::CloseObjectsVector() {
 	objects.setNoDuplicateInsertPlan();
 
-	messageReceivers.setNoDuplicateInsertPlan();
+	for (int i = 0; i < Types::SIZE; ++i) {
+		messageReceivers[i].setNoDuplicateInsertPlan();
+	}
 
+	receiverBuckets = 0;
 	count = 0;
 }
 
@@ -53,6 +56,41 @@ void CloseObjectsVector::safeCopyTo(HashSet<ManagedReference<TreeEntry*>>& set)
 	}
 }
 
+void CloseObjectsVector::safeCopyMovedAwayTo(float x, float y, float z, float oldX, float oldY, float oldZ,
+		Vector<Reference<TreeEntry*> >& entries, Vector<int>& movedAway) const {
+	ReadLocker locker(&mutex);
+
+	int first = entries.size();
+
+	for (int i = 0; i < objects.size(); ++i) {
+		entries.add(objects.getUnsafe(i));
+	}
+
+	int firstMoved = movedAway.size();
+
+	positions.filterMovedAway(x, y, z, oldX, oldY, oldZ, movedAway);
+
+	for (int i = firstMoved; i < movedAway.size(); ++i) {
+		movedAway.elementAt(i) += first;
+	}
+}
+
+bool CloseObjectsVector::updatePosition(TreeEntry* entry) {
+	float x, y, z;
+	CloseObjectsPositions::getRootPosition(entry, x, y, z);
+
+	Locker locker(&mutex);
+
+	int index = objects.find(entry);
+
+	if (index == -1)
+		return false;
+
+	positions.set(index, x, y, z);
+
+	return true;
+}
+
 SortedVector<ManagedReference<TreeEntry*> > CloseObjectsVector::getSafeCopy() const {
 	ReadLocker locker(&mutex);
 
@@ -89,27 +127,32 @@ void CloseObjectsVector::removeAll(int newSize, int newIncrement) {
 	Locker locker(&mutex);
 
 	objects.removeAll(newSize, newIncrement);
+	positions.removeAll(newSize, newIncrement);
 
-	messageReceivers.removeAll(newSize, newIncrement);
+	for (int i = 0; i < Types::SIZE; ++i) {
+		messageReceivers[i].removeAll(newSize, newIncrement);
+	}
 
+	receiverBuckets = 0;
 	count = 0;
 }
 
 void CloseObjectsVector::dropReceiver(TreeEntry* entry) {
 	uint32 receiverTypes = entry->registerToCloseObjectsReceivers();
 
-	if (receiverTypes && messageReceivers.size()) {
+	receiverTypes &= receiverBuckets;
+
+	if (receiverTypes) {
 		for (int i = 0; i < CloseObjectsVector::Types::SIZE; ++i) {
 			uint32 type = 1 << i;
 
 			if (receiverTypes & type) {
-				int idx = messageReceivers.find(type);
+				auto& receivers = messageReceivers[i];
 
-				if (idx != -1) {
-					auto& receivers = messageReceivers.elementAt(idx).getValue();
+				receivers.drop(entry);
 
-					receivers.drop(entry);
-				}
+				if (receivers.isEmpty())
+					receiverBuckets &= ~type;
 			}
 		}
 	}
@@ -123,6 +166,7 @@ Reference<TreeEntry*> CloseObjectsVector::remove(int index) {
 	dropReceiver(ref);
 
 	auto obj = objects.remove(index);
+	positions.remove(index);
 
 	count = objects.size();
 
@@ -134,74 +178,72 @@ bool CloseObjectsVector::drop(const Reference<TreeEntry*>& o) {
 
 	dropReceiver(o);
 
-	auto res = objects.drop(o);
+	int index = objects.find(o);
+
+	if (index == -1)
+		return false;
+
+	objects.remove(index);
+	positions.remove(index);
 
 	count = objects.size();
 
-	return res;
+	return true;
 }
 
 void CloseObjectsVector::safeCopyReceiversTo(Vector<TreeEntry*>& vec, uint32 receiverType) const {
 	ReadLocker locker(&mutex);
 
-	int i = messageReceivers.find(receiverType);
-
-	if (i != -1) {
-		const auto& receivers = messageReceivers.elementAt(i).getValue();
+	const auto receivers = getReceivers(receiverType);
 
-		vec.removeAll(receivers.size(), receivers.size() / 2);
+	if (receivers != nullptr) {
+		vec.removeAll(receivers->size(), receivers->size() / 2);
 
-		vec.addAll(receivers);
+		vec.addAll(*receivers);
 	}
 }
 
 void CloseObjectsVector::safeRunForEach(const Function<void(TreeEntry* const&)>& lambda, uint32 receiverType) const {
 	ReadLocker locker(&mutex);
 
-	int i = messageReceivers.find(receiverType);
-
-	if (i != -1) {
-		const auto& receivers = messageReceivers.elementAt(i).getValue();
+	const auto receivers = getReceivers(receiverType);
 
-		receivers.forEach(lambda);
+	if (receivers != nullptr) {
+		receivers->forEach(lambda);
 	}
 }
 
 void CloseObjectsVector::safeCopyReceiversTo(Vector<ManagedReference<TreeEntry*> >& vec, uint32 receiverType) const {
 	ReadLocker locker(&mutex);
 
-	int i = messageReceivers.find(receiverType);
+	const auto receivers = getReceivers(receiverType);
 
-	if (i != -1) {
-		const auto& receivers = messageReceivers.elementAt(i).getValue();
+	if (receivers != nullptr) {
+		vec.removeAll(receivers->size(), receivers->size() / 2);
 
-		vec.removeAll(receivers.size(), receivers.size() / 2);
-
-		for (int i = 0; i < receivers.size(); ++i)
-			vec.emplace(receivers.getUnsafe(i));
+		for (int i = 0; i < receivers->size(); ++i)
+			vec.emplace(receivers->getUnsafe(i));
 	}
 }
 
 void CloseObjectsVector::safeAppendReceiversTo(Vector<TreeEntry*>& vec, uint32 receiverType) const {
 	ReadLocker locker(&mutex);
 
-	int i = messageReceivers.find(receiverType);
+	const auto receivers = getReceivers(receiverType);
 
-	if (i != -1) {
-		const auto& receivers = messageReceivers.elementAt(i).getValue();
-		vec.addAll(receivers);
+	if (receivers != nullptr) {
+		vec.addAll(*receivers);
 	}
 }
 
 void CloseObjectsVector::safeAppendReceiversTo(Vector<ManagedReference<TreeEntry*> >& vec, uint32 receiverType) const {
 	ReadLocker locker(&mutex);
 
-	int i = messageReceivers.find(receiverType);
+	const auto receivers = getReceivers(receiverType);
 
-	if (i != -1) {
-		const auto& receivers = messageReceivers.elementAt(i).getValue();
-		for (int i = 0; i < receivers.size(); ++i)
-			vec.emplace(receivers.getUnsafe(i));
+	if (receivers != nullptr) {
+		for (int i = 0; i < receivers->size(); ++i)
+			vec.emplace(receivers->getUnsafe(i));
 	}
 }
 
@@ -215,20 +257,9 @@ void CloseObjectsVector::putReceiver(TreeEntry* entry, uint32 receiverTypes) {
 			uint32 type = 1 << i;
 
 			if (receiverTypes & type) {
-				int idx = messageReceivers.find(type);
-
-				if (idx != -1) {
-					auto& receivers = messageReceivers.elementAt(idx).getValue();
-
-					receivers.put(entry);
-				} else {
-					SortedVector<TreeEntry*> vec;
-					vec.setNoDuplicateInsertPlan();
+				messageReceivers[i].put(entry);
 
-					vec.put(entry);
-
-					messageReceivers.put(std::move(type), std::move(vec));
-				}
+				receiverBuckets |= type;
 			}
 		}
 	}
@@ -237,12 +268,17 @@ void CloseObjectsVector::putReceiver(TreeEntry* entry, uint32 receiverTypes) {
 int CloseObjectsVector::put(const Reference<TreeEntry*>& o) {
 	uint32 receiverTypes = o->registerToCloseObjectsReceivers();
 
+	float x, y, z;
+	CloseObjectsPositions::getRootPosition(o, x, y, z);
+
 	Locker locker(&mutex);
 
 	putReceiver(o.get(), receiverTypes);
 
 	auto res = objects.put(o);
 
+	putPosition(res, o.get(), x, y, z);
+
 	count = objects.size();
 
 	return res;
@@ -251,12 +287,33 @@ int CloseObjectsVector::put(const Reference<TreeEntry*>& o) {
 int CloseObjectsVector::put(Reference<TreeEntry*>&& o) {
 	uint32 receiverTypes = o->registerToCloseObjectsReceivers();
 
+	float x, y, z;
+	CloseObjectsPositions::getRootPosition(o, x, y, z);
+
+	TreeEntry* entry = o.get();
+
 	Locker locker(&mutex);
-	putReceiver(o.get(), receiverTypes);
+	putReceiver(entry, receiverTypes);
 
 	auto res = objects.put(std::move(o));
 
+	putPosition(res, entry, x, y, z);
+
 	count = objects.size();
 
 	return res;
 }
+
+void CloseObjectsVector::putPosition(int index, TreeEntry* entry, float x, float y, float z) {
+	if (index != -1) {
+		positions.insert(index, x, y, z);
+
+		return;
+	}
+
+	// Already a close object, its position is refreshed
+	index = objects.find(entry);
+
+	if (index != -1)
+		positions.set(index, x, y, z);
+}
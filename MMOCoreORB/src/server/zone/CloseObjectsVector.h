@@ -13,15 +13,38 @@
 #include "system/thread/ReadWriteLock.h"
 
 #include "engine/core/ManagedReference.h"
+#include "server/zone/CloseObjectsPositions.h"
+
 namespace server {
  namespace zone {
 class TreeEntry;
 
 class CloseObjectsVector : public Object {
+public:
+	enum Types : uint32 {
+		PLAYERTYPE = 1 << 0,
+		CREOTYPE = 1 << 1,
+		COLLIDABLETYPE = 1 << 2,
+		INSTALLATIONTYPE = 1 << 3,
+		STRUCTURETYPE = 1 << 4,
+		SHIPTYPE = 1 << 5,
+		PLAYERSHIPTYPE = 1 << 6,
+		//MAXTYPES = 1 << 31,
+		SIZE = 7
+	};
+
+private:
 	mutable ReadWriteLock mutex;
 	SortedVector<Reference<server::zone::TreeEntry*> > objects;
 
-	VectorMap<uint32, SortedVector<server::zone::TreeEntry*> > messageReceivers;
+	// Root parent position of each entry of objects, at the same index
+	CloseObjectsPositions positions;
+
+	// One receiver bucket per Types flag, indexed by the flag bit
+	SortedVector<server::zone::TreeEntry*> messageReceivers[Types::SIZE];
+
+	// Bitset of the non empty receiver buckets
+	uint32 receiverBuckets;
 
 	uint32 count;
 
@@ -32,19 +55,35 @@ class CloseObjectsVector : public Object {
 protected:
 	void dropReceiver(server::zone::TreeEntry* entry);
 	void putReceiver(server::zone::TreeEntry* entry, uint32 receiverTypes);
-public:
-	enum Types : uint32 {
-		PLAYERTYPE = 1 << 0,
-		CREOTYPE = 1 << 1,
-		COLLIDABLETYPE = 1 << 2,
-		INSTALLATIONTYPE = 1 << 3,
-		STRUCTURETYPE = 1 << 4,
-		SHIPTYPE = 1 << 5,
-		PLAYERSHIPTYPE = 1 << 6,
-		//MAXTYPES = 1 << 31,
-		SIZE = 7
-	};
 
+	// pre: mutex is write locked, index is the result of objects.put
+	void putPosition(int index, server::zone::TreeEntry* entry, float x, float y, float z);
+
+	/**
+	 * Returns the receiver bucket for a single Types flag, or nullptr if it is empty.
+	 */
+	const SortedVector<server::zone::TreeEntry*>* getReceivers(uint32 receiverType) const {
+		if (!(receiverBuckets & receiverType))
+			return nullptr;
+
+		int index = getReceiverIndex(receiverType);
+
+		if (index == -1)
+			return nullptr;
+
+		return &messageReceivers[index];
+	}
+
+	static int getReceiverIndex(uint32 receiverType) {
+		for (int i = 0; i < Types::SIZE; ++i) {
+			if (receiverType == (1u << i))
+				return i;
+		}
+
+		return -1;
+	}
+
+public:
 	CloseObjectsVector();
 
 	Reference<server::zone::TreeEntry*> remove(int index);
@@ -68,6 +107,19 @@ public:
 
 	SortedVector<ManagedReference<server::zone::TreeEntry*> > getSafeCopy() const;
 
+	/**
+	 * Appends the close objects to entries, and to movedAway the indexes in
+	 * entries of the ones x, y, z is farther from than oldX, oldY, oldZ.
+	 */
+	void safeCopyMovedAwayTo(float x, float y, float z, float oldX, float oldY, float oldZ,
+			Vector<Reference<server::zone::TreeEntry*> >& entries, Vector<int>& movedAway) const;
+
+	/**
+	 * Refreshes the stored position of entry after it moved.
+	 * @return false if entry is not a close object
+	 */
+	bool updatePosition(server::zone::TreeEntry* entry);
+
 	const Reference<server::zone::TreeEntry*>& get(int idx) const;
 
 	int put(const Reference<server::zone::TreeEntry*>& o);
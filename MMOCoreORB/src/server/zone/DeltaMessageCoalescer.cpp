@@ -0,0 +1,221 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#include "DeltaMessageCoalescer.h"
+
+#include "conf/ConfigManager.h"
+
+constexpr int DeltaMessageCoalescer::DEFAULT_WINDOW;
+constexpr int DeltaMessageCoalescer::MAX_PENDING_DELTAS;
+
+DeltaMessageFlushTask* DeltaMessageFlushTask::instance() {
+	static Reference<DeltaMessageFlushTask*> flushTask = new DeltaMessageFlushTask(ConfigManager::instance()->getInt("Core3.ZoneServer.DeltaCoalescingWindow", DeltaMessageCoalescer::DEFAULT_WINDOW));
+
+	return flushTask;
+}
+
+void DeltaMessageFlushTask::queue(DeltaMessageCoalescer* coalescer) {
+	Locker locker(&mutex);
+
+	queuedCoalescers.add(coalescer);
+
+	if (!isScheduled())
+		schedule(window);
+}
+
+void DeltaMessageFlushTask::run() {
+	Vector<Reference<DeltaMessageCoalescer*> > coalescers;
+
+	Locker locker(&mutex);
+
+	coalescers.addAll(queuedCoalescers);
+	queuedCoalescers.removeAll();
+
+	locker.release();
+
+	for (int i = 0; i < coalescers.size(); ++i) {
+		coalescers.getUnsafe(i)->flush();
+	}
+}
+
+DeltaMessageCoalescer::~DeltaMessageCoalescer() {
+	for (int i = 0; i < pendingDeltas.size(); ++i) {
+		discardDelta(pendingDeltas.get(i));
+	}
+}
+
+void DeltaMessageCoalescer::sendPacket(BasePacket* packet) {
+	DeltaMessage* delta = DeltaMessage::hasDeltaOpcode(packet) ? dynamic_cast<DeltaMessage*>(packet) : nullptr;
+
+	Locker locker(&mutex);
+
+	if (delta == nullptr) {
+		flushPending();
+
+		if (session != nullptr)
+			session->sendPacket(packet);
+#ifndef LOCKFREE_BCLIENT_BUFFERS
+		else
+			delete packet;
+#endif
+
+		return;
+	}
+
+	pendingDeltas.add(delta);
+
+	if (pendingDeltas.size() >= MAX_PENDING_DELTAS) {
+		flushPending();
+	} else if (!queued) {
+		queued = true;
+
+		DeltaMessageFlushTask::instance()->queue(this);
+	}
+}
+
+void DeltaMessageCoalescer::flush() {
+	Locker locker(&mutex);
+
+	queued = false;
+
+	flushPending();
+}
+
+void DeltaMessageCoalescer::clearSession() {
+	Locker locker(&mutex);
+
+	for (int i = 0; i < pendingDeltas.size(); ++i) {
+		discardDelta(pendingDeltas.get(i));
+	}
+
+	pendingDeltas.removeAll();
+
+	session = nullptr;
+}
+
+void DeltaMessageCoalescer::flushPending() {
+	int count = pendingDeltas.size();
+
+	if (count == 0)
+		return;
+
+	if (session == nullptr) {
+		for (int i = 0; i < count; ++i) {
+			discardDelta(pendingDeltas.get(i));
+		}
+
+		pendingDeltas.removeAll();
+
+		return;
+	}
+
+	Vector<bool> sent(count, 1);
+	Vector<int> group(10, 10);
+	Vector<DeltaMessage*> groupDeltas(10, 10);
+
+	for (int i = 0; i < count; ++i) {
+		sent.add(false);
+	}
+
+	for (int i = 0; i < count; ++i) {
+		if (sent.get(i))
+			continue;
+
+		DeltaMessage* delta = pendingDeltas.get(i);
+
+		group.removeAll(10, 10);
+		group.add(i);
+
+		if (delta->isMergeable()) {
+			for (int j = i + 1; j < count; ++j) {
+				DeltaMessage* other = pendingDeltas.get(j);
+
+				if (sent.get(j) || other->getObjectID() != delta->getObjectID() || other->getObjectName() != delta->getObjectName()
+						|| other->getPackageType() != delta->getPackageType())
+					continue;
+
+				// Merging past a delta that can't be merged would reorder the updates of this package
+				if (!other->isMergeable())
+					break;
+
+				group.add(j);
+				sent.set(j, true);
+			}
+		}
+
+		sent.set(i, true);
+
+		if (group.size() == 1) {
+			session->sendPacket(delta);
+			continue;
+		}
+
+		groupDeltas.removeAll(10, 10);
+
+		for (int j = 0; j < group.size(); ++j) {
+			groupDeltas.add(pendingDeltas.get(group.get(j)));
+		}
+
+		session->sendPacket(mergeDeltas(groupDeltas));
+
+		for (int j = 0; j < group.size(); ++j) {
+			discardDelta(pendingDeltas.get(group.get(j)));
+		}
+	}
+
+	pendingDeltas.removeAll();
+}
+
+DeltaMessage* DeltaMessageCoalescer::mergeDeltas(const Vector<DeltaMessage*>& deltas) {
+	DeltaMessage* first = deltas.get(0);
+
+	// Walk the updates backwards to find the scalar values that get overwritten later on
+	SortedVector<uint16> replacedTypes;
+	replacedTypes.setNoDuplicateInsertPlan();
+
+	Vector<bool> superseded;
+
+	for (int i = deltas.size() - 1; i >= 0; --i) {
+		DeltaMessage* delta = deltas.get(i);
+
+		for (int j = delta->getUpdateCount() - 1; j >= 0; --j) {
+			bool skip = false;
+
+			if (delta->isReplaceableUpdate(j)) {
+				uint16 type = delta->getUpdateType(j);
+
+				skip = replacedTypes.contains(type);
+				replacedTypes.put(type);
+			}
+
+			superseded.add(skip);
+		}
+	}
+
+	DeltaMessage* merged = new DeltaMessage(first->getObjectID(), first->getObjectName(), first->getPackageType());
+
+	int position = superseded.size() - 1;
+
+	for (int i = 0; i < deltas.size(); ++i) {
+		DeltaMessage* delta = deltas.get(i);
+
+		for (int j = 0; j < delta->getUpdateCount(); ++j, --position) {
+			if (!superseded.get(position))
+				merged->appendUpdate(delta, j);
+		}
+	}
+
+	merged->close();
+
+	return merged;
+}
+
+void DeltaMessageCoalescer::discardDelta(PendingDelta& delta) {
+#ifndef LOCKFREE_BCLIENT_BUFFERS
+	delete delta;
+#endif
+
+	delta = nullptr;
+}
@@ -0,0 +1,113 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#ifndef DELTAMESSAGECOALESCER_H_
+#define DELTAMESSAGECOALESCER_H_
+
+#include "engine/engine.h"
+
+#include "server/zone/packets/DeltaMessage.h"
+
+namespace server {
+ namespace zone {
+
+class DeltaMessageCoalescer;
+
+/**
+ * Flushes the coalescers of every session that queued deltas during the
+ * last window. A single task is shared by all the sessions, so sending a
+ * delta never schedules anything on its own.
+ */
+class DeltaMessageFlushTask : public Task {
+	Vector<Reference<DeltaMessageCoalescer*> > queuedCoalescers;
+
+	int window;
+
+	Mutex mutex;
+
+	DeltaMessageFlushTask(int flushWindow) : Task() {
+		window = flushWindow;
+	}
+
+public:
+	static DeltaMessageFlushTask* instance();
+
+	/**
+	 * Flushes coalescer at the end of the current window.
+	 */
+	void queue(DeltaMessageCoalescer* coalescer);
+
+	void run();
+};
+
+/**
+ * Outbound stage of a client session that holds delta messages for a short
+ * window and merges the ones of the same object and package into a single
+ * delta, dropping scalar updates superseded by a later value. Any other
+ * packet flushes the pending deltas first so the client sees the same order.
+ */
+class DeltaMessageCoalescer : public Object {
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+	typedef Reference<DeltaMessage*> PendingDelta;
+#else
+	typedef DeltaMessage* PendingDelta;
+#endif
+
+	Reference<BaseClientProxy*> session;
+
+	Vector<PendingDelta> pendingDeltas;
+
+	// Set while this coalescer waits in the flush task queue
+	bool queued;
+
+	Mutex mutex;
+
+public:
+	static constexpr int DEFAULT_WINDOW = 10;
+
+	// Pending deltas are flushed before the window ends when reaching this count
+	static constexpr int MAX_PENDING_DELTAS = 64;
+
+	DeltaMessageCoalescer(BaseClientProxy* client) {
+		session = client;
+		queued = false;
+	}
+
+	~DeltaMessageCoalescer();
+
+	/**
+	 * Sends the packet through the session, queueing it if it is a delta message.
+	 */
+	void sendPacket(BasePacket* packet);
+
+	/**
+	 * Drops the pending deltas and the session reference.
+	 */
+	void clearSession();
+
+	/**
+	 * Sends the pending deltas, called by the flush task when the window ends.
+	 */
+	void flush();
+
+	/**
+	 * Builds a closed delta with the updates of deltas in order, leaving out
+	 * the replaceable updates that a later one of the same variable supersedes.
+	 * The deltas must be closed, mergeable and of the same object and package.
+	 */
+	static DeltaMessage* mergeDeltas(const Vector<DeltaMessage*>& deltas);
+
+private:
+	void flushPending();
+
+	static void discardDelta(PendingDelta& delta);
+};
+
+ }
+}
+
+using namespace server::zone;
+
+#endif /* DELTAMESSAGECOALESCER_H_ */
@@ -41,6 +41,11 @@ bool GroundZoneContainerComponent::insertActiveArea(Zone* newZone, ActiveArea* a
 
 	areaTree->insert(activeArea);
 
+	PlanetManager* planetManager = newZone->getPlanetManager();
+
+	if (planetManager != nullptr && planetManager->getSpawnPermissionMask() != nullptr)
+		planetManager->getSpawnPermissionMask()->updateArea(activeArea);
+
 	//regionTree->inRange(activeArea, 512);
 
 	// lets update area to the in range players
@@ -104,6 +109,11 @@ bool GroundZoneContainerComponent::removeActiveArea(Zone* zone, ActiveArea* acti
 
 	areaTree->remove(activeArea);
 
+	PlanetManager* planetManager = zone->getPlanetManager();
+
+	if (planetManager != nullptr && planetManager->getSpawnPermissionMask() != nullptr)
+		planetManager->getSpawnPermissionMask()->removeArea(activeArea);
+
 	// Remove active area from in range objects
 	SortedVector<TreeEntry*> objects;
 	float range = activeArea->getRadius() + 64;
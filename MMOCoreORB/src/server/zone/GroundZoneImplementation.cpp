@@ -23,15 +23,35 @@
 #include "terrain/ProceduralTerrainAppearance.h"
 #include "server/zone/managers/collision/NavMeshManager.h"
 #include "server/zone/ActiveAreaQuadTree.h"
+#include "server/zone/ShardedQuadTree.h"
+#include "server/zone/InRangeUpdateTask.h"
+#include "server/zone/objects/creature/ai/events/AiBehaviorScheduler.h"
 
 GroundZoneImplementation::GroundZoneImplementation(ZoneProcessServer* serv, const String& name) : ZoneImplementation(serv, name) {
+	String capName = name;
+	capName[0] = toupper(name[0]);
+
+	int shardGridSize = ConfigManager::instance()->getInt("Core3.Zone.SpatialIndexGridSize", server::zone::ShardedQuadTree::DEFAULT_GRID_SIZE);
+	shardGridSize = ConfigManager::instance()->getInt("Core3.Zone.SpatialIndexGridSize" + capName, shardGridSize);
+
 	areaTree = new server::zone::ActiveAreaQuadTree(-8192, -8192, 8192, 8192);
-	quadTree = new server::zone::QuadTree(-8192, -8192, 8192, 8192);
+	quadTree = new server::zone::ShardedQuadTree(-8192, -8192, 8192, 8192, shardGridSize);
 
-	planetManager = nullptr;
+	int inRangeInterval = ConfigManager::instance()->getInt("Core3.Zone.InRangeUpdateInterval", InRangeUpdateTask::DEFAULT_INTERVAL);
 
-	String capName = name;
-	capName[0] = toupper(name[0]);
+	if (inRangeInterval > 0)
+		inRangeUpdateTask = new InRangeUpdateTask(quadTree, name, inRangeInterval);
+	else
+		inRangeUpdateTask = nullptr;
+
+	int aiTickInterval = ConfigManager::instance()->getInt("Core3.Zone.AiSchedulerTickInterval", AiBehaviorScheduler::DEFAULT_TICK_INTERVAL);
+
+	if (aiTickInterval > 0)
+		aiBehaviorScheduler = new AiBehaviorScheduler(name, aiTickInterval);
+	else
+		aiBehaviorScheduler = nullptr;
+
+	planetManager = nullptr;
 
 	int numThreads = ConfigManager::instance()->getInt("Core3.Zone.ThreadsDefault", 1);
 	numThreads = ConfigManager::instance()->getInt("Core3.Zone.Threads" + capName, numThreads);
@@ -99,6 +119,18 @@ void GroundZoneImplementation::stopManagers() {
 	server = nullptr;
 	mapLocations = nullptr;
 	objectMap = nullptr;
+
+	if (inRangeUpdateTask != nullptr) {
+		inRangeUpdateTask->cancel();
+		inRangeUpdateTask->clearTree();
+		inRangeUpdateTask = nullptr;
+	}
+
+	if (aiBehaviorScheduler != nullptr) {
+		aiBehaviorScheduler->stop();
+		aiBehaviorScheduler = nullptr;
+	}
+
 	quadTree = nullptr;
 	areaTree = nullptr;
 }
@@ -155,8 +187,7 @@ void GroundZoneImplementation::insert(TreeEntry* entry) {
 	if (entry == nullptr)
 		return;
 
-	Locker locker(_this.getReferenceUnsafeStaticCast());
-
+	// The sharded quad tree locks the affected shard internally
 	quadTree->insert(entry);
 
 	/*
@@ -168,8 +199,6 @@ void GroundZoneImplementation::insert(TreeEntry* entry) {
 }
 
 void GroundZoneImplementation::remove(TreeEntry* entry) {
-	Locker locker(_this.getReferenceUnsafeStaticCast());
-
 	if (entry->isInQuadTree()) {
 		quadTree->remove(entry);
 
@@ -183,8 +212,6 @@ void GroundZoneImplementation::remove(TreeEntry* entry) {
 }
 
 void GroundZoneImplementation::update(TreeEntry* entry) {
-	Locker locker(_this.getReferenceUnsafeStaticCast());
-
 	quadTree->update(entry);
 
 	/*
@@ -199,6 +226,15 @@ void GroundZoneImplementation::inRange(TreeEntry* entry, float range) {
 	quadTree->safeInRange(entry, range);
 }
 
+void GroundZoneImplementation::enqueueInRangeUpdate(TreeEntry* entry, float range) {
+	if (inRangeUpdateTask == nullptr) {
+		quadTree->safeInRange(entry, range);
+		return;
+	}
+
+	inRangeUpdateTask->enqueue(entry, range);
+}
+
 void GroundZoneImplementation::updateActiveAreas(TangibleObject* tano) {
 	//Locker locker(_this.getReferenceUnsafeStaticCast());
 
@@ -514,6 +550,69 @@ int GroundZoneImplementation::getInRangePlayers(float x, float z, float y, float
 	return players->size();
 }
 
+int GroundZoneImplementation::getInRangeObjects(const AreaQuery& query, SortedVector<ManagedReference<TreeEntry*> >* objects, bool readLockZone) {
+	objects->setNoDuplicateInsertPlan();
+
+	bool readlock = readLockZone && !_this.getReferenceUnsafeStaticCast()->isLockedByCurrentThread();
+
+	try {
+		_this.getReferenceUnsafeStaticCast()->rlock(readlock);
+
+		quadTree->inRange(query, *objects);
+
+		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
+	} catch (...) {
+		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
+	}
+
+	Vector<ManagedReference<TreeEntry*> > containedObjects;
+
+	for (int i = objects->size() - 1; i >= 0; --i) {
+		SceneObject* sceneObject = static_cast<SceneObject*>(objects->getUnsafe(i).get());
+
+		if (!query.isContainer(sceneObject))
+			continue;
+
+		BuildingObject* building = sceneObject->asBuildingObject();
+
+		if (building != nullptr) {
+			for (int j = 1; j <= building->getMapCellSize(); ++j) {
+				CellObject* cell = building->getCell(j);
+
+				if (cell == nullptr || !cell->isContainerLoaded())
+					continue;
+
+				try {
+					ReadLocker rlocker(cell->getContainerLock());
+
+					for (int h = 0; h < cell->getContainerObjectsSize(); ++h) {
+						Reference<SceneObject*> obj = cell->getContainerObject(h);
+
+						if (query.matches(obj))
+							containedObjects.add(obj.get());
+					}
+				} catch (Exception& e) {
+					warning("exception in Zone::getInRangeObjects: " + e.getMessage());
+				}
+			}
+		} else {
+			Reference<SceneObject*> rider = sceneObject->getSlottedObject("rider");
+
+			if (rider != nullptr && query.matches(rider))
+				containedObjects.add(rider.get());
+		}
+
+		// Containers are only walked for their contents unless they match themselves
+		if (!query.matches(sceneObject))
+			objects->remove(i);
+	}
+
+	for (int i = 0; i < containedObjects.size(); ++i)
+		objects->put(std::move(containedObjects.getUnsafe(i)));
+
+	return objects->size();
+}
+
 int GroundZoneImplementation::getInRangeActiveAreas(float x, float z, float y, SortedVector<ManagedReference<ActiveArea*> >* objects, bool readLockZone) {
 	objects->setNoDuplicateInsertPlan();
 
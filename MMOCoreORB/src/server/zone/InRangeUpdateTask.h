@@ -0,0 +1,86 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#ifndef INRANGEUPDATETASK_H_
+#define INRANGEUPDATETASK_H_
+
+#include "engine/engine.h"
+
+#include "server/zone/ShardedQuadTree.h"
+
+/**
+ * Collects the moving entries of a ground zone during a tick and refreshes
+ * their close objects in a single batched pass over the spatial index.
+ */
+class InRangeUpdateTask : public Task, public Logger {
+	Reference<server::zone::ShardedQuadTree*> quadTree;
+
+	SortedVector<Reference<TreeEntry*> > pendingEntries;
+	float pendingRange;
+
+	int interval;
+
+	Mutex mutex;
+
+public:
+	static constexpr int DEFAULT_INTERVAL = 100;
+
+	InRangeUpdateTask(server::zone::ShardedQuadTree* tree, const String& zoneName, int tickInterval) : Task() {
+		setLoggingName("InRangeUpdateTask " + zoneName);
+		setCustomTaskQueue(zoneName);
+
+		quadTree = tree;
+		interval = tickInterval;
+		pendingRange = 0.f;
+
+		pendingEntries.setNoDuplicateInsertPlan();
+	}
+
+	void enqueue(TreeEntry* entry, float range) {
+		Locker locker(&mutex);
+
+		pendingEntries.put(entry);
+		pendingRange = Math::max(pendingRange, range);
+
+		if (!isScheduled())
+			schedule(interval);
+	}
+
+	void run() {
+		Vector<Reference<TreeEntry*> > entries;
+		float range = 0.f;
+
+		Locker locker(&mutex);
+
+		entries.addAll(pendingEntries);
+		pendingEntries.removeAll(entries.size(), 50);
+
+		range = pendingRange;
+		pendingRange = 0.f;
+
+		Reference<server::zone::ShardedQuadTree*> tree = quadTree;
+
+		locker.release();
+
+		if (tree == nullptr || entries.isEmpty())
+			return;
+
+		try {
+			tree->safeInRange(entries, range);
+		} catch (Exception& e) {
+			error() << "exception caught while updating " << entries.size() << " entries: " << e.getMessage();
+			e.printStackTrace();
+		}
+	}
+
+	void clearTree() {
+		Locker locker(&mutex);
+
+		pendingEntries.removeAll();
+		quadTree = nullptr;
+	}
+};
+
+#endif /* INRANGEUPDATETASK_H_ */
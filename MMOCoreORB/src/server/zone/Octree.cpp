@@ -151,43 +151,69 @@ void Octree::inRange(TreeEntry* obj, float range) {
 
 	try {
 		if (closeObjects != nullptr) {
-			for (int i = 0; i < closeObjects->size(); i++) {
-				TreeEntry* o = closeObjects->get(i).castTo<TreeEntry*>();
-				ManagedReference<TreeEntry*> objectToRemove = o;
-				ManagedReference<TreeEntry*> rootParent = o->getRootParent();
+			static thread_local Vector<Reference<TreeEntry*> > closeEntries;
+			static thread_local Vector<int> movedAway;
 
-				if (rootParent != nullptr)
-					o = rootParent;
+			closeEntries.removeRange(0, closeEntries.size());
+			movedAway.removeRange(0, movedAway.size());
 
-				if (o != obj) {
-					float nearEntryOutOfRange = Math::max(o->getOutOfRangeDistance(objectID), obj->getOutOfRangeDistance(o->getObjectID()));
-					float outOfRangeSqr = Math::sqr(nearEntryOutOfRange);
+			// Only entries we moved away from can have left the out of range distance
+			closeObjects->safeCopyMovedAwayTo(x, y, z, oldx, oldy, oldz, closeEntries, movedAway);
 
-					float deltaX = x - o->getPositionX();
-					float deltaY = y - o->getPositionY();
-					float deltaZ = z - o->getPositionZ();
+			for (int i = 0; i < movedAway.size(); i++) {
+				ManagedReference<TreeEntry*> objectToRemove = closeEntries.getUnsafe(movedAway.getUnsafe(i)).get();
+				TreeEntry* o = objectToRemove->getRootParentUnsafe();
 
-					float deltaCalc = deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ;
+				if (o == nullptr)
+					o = objectToRemove;
 
-					if (deltaCalc > outOfRangeSqr) {
-						float oldDeltaX = oldx - o->getPositionX();
-						float oldDeltaY = oldy - o->getPositionY();
-						float oldDeltaZ = oldz - o->getPositionZ();
+				if (o == obj)
+					continue;
+
+				float nearEntryOutOfRange = Math::max(o->getOutOfRangeDistance(objectID), obj->getOutOfRangeDistance(objectToRemove->getObjectID()));
+				float outOfRangeSqr = Math::sqr(nearEntryOutOfRange);
+
+				float deltaX = x - o->getPositionX();
+				float deltaY = y - o->getPositionY();
+				float deltaZ = z - o->getPositionZ();
 
-						float deltaCalc2 = oldDeltaX * oldDeltaX + oldDeltaY * oldDeltaY + oldDeltaZ * oldDeltaZ;
+				float deltaCalc = deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ;
 
-						if (deltaCalc2 < outOfRangeSqr) {
-							obj->removeInRangeObject(objectToRemove);
+				if (deltaCalc > outOfRangeSqr) {
+					float oldDeltaX = oldx - o->getPositionX();
+					float oldDeltaY = oldy - o->getPositionY();
+					float oldDeltaZ = oldz - o->getPositionZ();
 
-							CloseObjectsVector* objCloseObjects = objectToRemove->getCloseObjects();
+					float deltaCalc2 = oldDeltaX * oldDeltaX + oldDeltaY * oldDeltaY + oldDeltaZ * oldDeltaZ;
 
-							if (objCloseObjects != nullptr) {
-								objectToRemove->removeInRangeObject(obj);
-							}
+					if (deltaCalc2 < outOfRangeSqr) {
+						obj->removeInRangeObject(objectToRemove);
+
+						CloseObjectsVector* objCloseObjects = objectToRemove->getCloseObjects();
+
+						if (objCloseObjects != nullptr) {
+							objectToRemove->removeInRangeObject(obj);
 						}
 					}
 				}
 			}
+
+			// Our close objects sweep against our stored position when they move,
+			// updated outside of our own vector lock to keep the lock order flat
+			for (int i = 0; i < closeEntries.size(); i++) {
+				TreeEntry* entry = closeEntries.getUnsafe(i);
+
+				if (entry == obj)
+					continue;
+
+				CloseObjectsVector* entryCloseObjects = entry->getCloseObjects();
+
+				if (entryCloseObjects != nullptr)
+					entryCloseObjects->updatePosition(obj);
+			}
+
+			// Don't keep the close objects alive until the next query on this thread
+			closeEntries.removeRange(0, closeEntries.size());
 		}
 
 		_inRange(root, obj, range);
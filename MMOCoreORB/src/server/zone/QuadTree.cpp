@@ -147,8 +147,34 @@ void QuadTree::inRange(TreeEntry *obj, float range) {
 
 	ReadLocker locker(&mutex);
 
+	try {
+		_removeOutOfRange(obj, range);
+
+		//	try {
+			_inRange(root, obj, range);
+
+			if (QuadTree::doLog()) {
+				Logger::console.info(true) << hex << "object [" << obj->getObjectID() <<  "] in range (";
+
+				/*for (int i = 0; i < obj->inRangeObjectCount(); ++i) {
+				Logger::console.info(true) << hex << obj->getInRangeObject(i)->getObjectID() << ", ";
+			}*/
+
+				Logger::console.info(true) << "\n";
+			}
+
+	} catch (Exception& e) {
+		Logger::console.info(true) << "[QuadTree] " << e.getMessage() << "\n";
+		e.printStackTrace();
+	}
+}
+
+void QuadTree::_removeOutOfRange(TreeEntry* obj, float range) {
 	CloseObjectsVector* closeObjects = obj->getCloseObjects();
 
+	if (closeObjects == nullptr)
+		return;
+
 	float rangesq = range * range;
 
 	float x = obj->getPositionX();
@@ -157,58 +183,49 @@ void QuadTree::inRange(TreeEntry *obj, float range) {
 	float oldx = obj->getPreviousPositionX();
 	float oldy = obj->getPreviousPositionY();
 
-	try {
-		if (closeObjects != nullptr) {
-			for (int i = 0; i < closeObjects->size(); i++) {
-				TreeEntry* o = closeObjects->get(i);
-				ManagedReference<TreeEntry*> objectToRemove = o;
-				ManagedReference<TreeEntry*> rootParent = o->getRootParent();
+	for (int i = 0; i < closeObjects->size(); i++) {
+		TreeEntry* o = closeObjects->get(i);
+		ManagedReference<TreeEntry*> objectToRemove = o;
+		ManagedReference<TreeEntry*> rootParent = o->getRootParent();
 
-				if (rootParent != nullptr)
-					o = rootParent;
+		if (rootParent != nullptr)
+			o = rootParent;
 
-				if (o != obj) {
-					float deltaX = x - o->getPositionX();
-					float deltaY = y - o->getPositionY();
+		if (o != obj) {
+			float deltaX = x - o->getPositionX();
+			float deltaY = y - o->getPositionY();
 
-					if (deltaX * deltaX + deltaY * deltaY > rangesq) {
-						float oldDeltaX = oldx - o->getPositionX();
-						float oldDeltaY = oldy - o->getPositionY();
+			if (deltaX * deltaX + deltaY * deltaY > rangesq) {
+				float oldDeltaX = oldx - o->getPositionX();
+				float oldDeltaY = oldy - o->getPositionY();
 
-						if (oldDeltaX * oldDeltaX + oldDeltaY * oldDeltaY <= rangesq) {
-							obj->removeInRangeObject(objectToRemove);
+				if (oldDeltaX * oldDeltaX + oldDeltaY * oldDeltaY <= rangesq) {
+					obj->removeInRangeObject(objectToRemove);
 
-							CloseObjectsVector* objCloseObjects = objectToRemove->getCloseObjects();
+					CloseObjectsVector* objCloseObjects = objectToRemove->getCloseObjects();
 
-							if (objCloseObjects != nullptr)
-								objectToRemove->removeInRangeObject(obj);
-						}
-					}
+					if (objCloseObjects != nullptr)
+						objectToRemove->removeInRangeObject(obj);
 				}
 			}
 		}
+	}
+}
 
+int QuadTree::inRange(float x, float y, float range, SortedVector<ManagedReference<TreeEntry*> >& objects) const {
+	ReadLocker locker(&mutex);
 
-		//	try {
-			_inRange(root, obj, range);
-
-			if (QuadTree::doLog()) {
-				Logger::console.info(true) << hex << "object [" << obj->getObjectID() <<  "] in range (";
-
-				/*for (int i = 0; i < obj->inRangeObjectCount(); ++i) {
-				Logger::console.info(true) << hex << obj->getInRangeObject(i)->getObjectID() << ", ";
-			}*/
-
-				Logger::console.info(true) << "\n";
-			}
-
+	try {
+		return _inRange(root, x, y, range, objects);
 	} catch (Exception& e) {
 		Logger::console.info(true) << "[QuadTree] " << e.getMessage() << "\n";
 		e.printStackTrace();
 	}
+
+	return 0;
 }
 
-int QuadTree::inRange(float x, float y, float range, SortedVector<ManagedReference<TreeEntry*> >& objects) const {
+int QuadTree::inRange(float x, float y, float range, SortedVector<TreeEntry*>& objects) const {
 	ReadLocker locker(&mutex);
 
 	try {
@@ -221,11 +238,11 @@ int QuadTree::inRange(float x, float y, float range, SortedVector<ManagedReferen
 	return 0;
 }
 
-int QuadTree::inRange(float x, float y, float range, SortedVector<TreeEntry*>& objects) const {
+int QuadTree::inRange(const AreaQuery& query, SortedVector<ManagedReference<TreeEntry*> >& objects) const {
 	ReadLocker locker(&mutex);
 
 	try {
-		return _inRange(root, x, y, range, objects);
+		return _inRange(root, query, query.getSearchRadius(), objects);
 	} catch (Exception& e) {
 		Logger::console.info(true) << "[QuadTree] " << e.getMessage() << "\n";
 		e.printStackTrace();
@@ -464,16 +481,10 @@ void QuadTree::safeInRange(TreeEntry* obj, float range) {
 		closeObjectsVector->safeCopyTo(closeObjectsCopy);
 	}
 
-	float rangesq = range * range;
-
 	float x = obj->getPositionX();
 	float y = obj->getPositionY();
 
-#ifdef NO_ENTRY_REF_COUNTING
 	SortedVector<TreeEntry*> inRangeObjects(500, 250);
-#else
-	SortedVector<ManagedReference<TreeEntry*> > inRangeObjects(500, 250);
-#endif
 
 	ReadLocker locker(&mutex);
 
@@ -481,6 +492,16 @@ void QuadTree::safeInRange(TreeEntry* obj, float range) {
 
 	locker.release();
 
+	_addInRangeObjects(obj, range, inRangeObjects);
+}
+
+void QuadTree::_addInRangeObjects(TreeEntry* obj, float range, const SortedVector<TreeEntry*>& inRangeObjects, const SortedVector<TreeEntry*>* processedEntries) {
+	float x = obj->getPositionX();
+	float y = obj->getPositionY();
+
+	// An already processed entry of the same batch added obj to its close objects if within this range too
+	float processedRangeSqr = processedEntries != nullptr ? Math::sqr(Math::max(range, obj->getOutOfRangeDistance())) : 0.f;
+
 	for (int i = 0; i < inRangeObjects.size(); ++i) {
 		TreeEntry *o = inRangeObjects.getUnsafe(i);
 
@@ -489,12 +510,16 @@ void QuadTree::safeInRange(TreeEntry* obj, float range) {
 			float deltaY = y - o->getPositionY();
 
 			try {
+				float distanceSqr = deltaX * deltaX + deltaY * deltaY;
 				float outOfRangeSqr = Math::sqr(Math::max(range, o->getOutOfRangeDistance()));
 
-				if (deltaX * deltaX + deltaY * deltaY <= outOfRangeSqr) {
+				if (distanceSqr <= outOfRangeSqr) {
 					CloseObjectsVector* objCloseObjects = obj->getCloseObjects();
 
-					if (objCloseObjects != nullptr)
+					// The pass of o added o to the close objects of obj, o still has to be notified of the move of obj below
+					bool addedByProcessed = processedEntries != nullptr && distanceSqr <= processedRangeSqr && processedEntries->contains(o);
+
+					if (objCloseObjects != nullptr && !addedByProcessed)
 						obj->addInRangeObject(o, false);
 
 					CloseObjectsVector* oCloseObjects = o->getCloseObjects();
@@ -510,8 +535,6 @@ void QuadTree::safeInRange(TreeEntry* obj, float range) {
 				obj->addInRangeObject(obj, false);
 		}
 	}
-
-
 }
 
 void QuadTree::copyObjects(const Reference<TreeNode*>& node, float x, float y, float range, SortedVector<ManagedReference<server::zone::TreeEntry*> >& objects) {
@@ -744,6 +767,36 @@ int QuadTree::_inRange(const Reference<TreeNode*>& node, float x, float y, float
 	return count;
 }
 
+int QuadTree::_inRange(const Reference<TreeNode*>& node, const AreaQuery& query, float range,
+		SortedVector<ManagedReference<TreeEntry*> >& objects) const {
+	int count = 0;
+
+	float x = query.getX();
+	float y = query.getY();
+
+	for (int i = 0; i < node->objects.size(); i++) {
+		TreeEntry *o = node->objects.getUnsafe(i);
+
+		if (o->isInRange(x, y, range) && query.isCandidate(o)) {
+			++count;
+			objects.put(o);
+		}
+	}
+
+	if (node->hasSubNodes()) {
+		if (node->nwNode != nullptr && node->nwNode->testInRange(x, y, range))
+			count += _inRange(node->nwNode, query, range, objects);
+		if (node->neNode != nullptr && node->neNode->testInRange(x, y, range))
+			count += _inRange(node->neNode, query, range, objects);
+		if (node->swNode != nullptr && node->swNode->testInRange(x, y, range))
+			count += _inRange(node->swNode, query, range, objects);
+		if (node->seNode != nullptr && node->seNode->testInRange(x, y, range))
+			count += _inRange(node->seNode, query, range, objects);
+	}
+
+	return count;
+}
+
 int QuadTree::_inRange(const Reference<TreeNode*>& node, float x, float y, float range, SortedVector<TreeEntry* >& objects) const {
 	int count = 0;
 
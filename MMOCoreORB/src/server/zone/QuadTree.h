@@ -42,9 +42,13 @@ Distribution of this file for usage outside of Core3 is prohibited.
 
 #include "TreeNode.h"
 
+#include "server/zone/AreaQuery.h"
+
 namespace server {
   namespace zone {
 
+	class ShardedQuadTree;
+
 	class QuadTree : public Object {
 		Reference<TreeNode*> root;
 
@@ -120,6 +124,11 @@ namespace server {
 		int inRange(float x, float y, float range, SortedVector<ManagedReference<TreeEntry*> >& objects) const;
 		int inRange(float x, float y, float range, SortedVector<TreeEntry*>& objects) const;
 
+		/**
+		 * Adds the entries in the search radius of the query that are candidates of it.
+		 */
+		int inRange(const AreaQuery& query, SortedVector<ManagedReference<TreeEntry*> >& objects) const;
+
 	 	/**
 		 * Update object's position in the quad tree.
 	 	 * Must be called after every time object changes position.
@@ -143,10 +152,14 @@ namespace server {
 		int _inRange(const Reference<TreeNode*>& node, float x, float y, float range, SortedVector<TreeEntry* >& objects) const;
 		int _inRange(const Reference<TreeNode*>& node, float x, float y, SortedVector<ManagedReference<TreeEntry*> >& objects) const;
 		int _inRange(const Reference<TreeNode*>& node, float x, float y, SortedVector<TreeEntry*>& objects) const;
+		int _inRange(const Reference<TreeNode*>& node, const AreaQuery& query, float range, SortedVector<ManagedReference<TreeEntry*> >& objects) const;
 
 		void copyObjects(const Reference<TreeNode*>& node, float x, float y, float range, SortedVector<ManagedReference<TreeEntry*> >& objects);
 		void copyObjects(const Reference<TreeNode*>& node, float x, float y, float range, SortedVector<TreeEntry*>& objects);
 
+		void _removeOutOfRange(TreeEntry* obj, float range);
+		static void _addInRangeObjects(TreeEntry* obj, float range, const SortedVector<TreeEntry*>& inRangeObjects, const SortedVector<TreeEntry*>* processedEntries = nullptr);
+
 	public:
 		static void setLogging(bool doLog) {
 			logTree = doLog;
@@ -155,6 +168,8 @@ namespace server {
 		inline static bool doLog() {
 			return logTree;
 		}
+
+		friend class server::zone::ShardedQuadTree;
 	};
   } // namespace zone
 } // namespace server
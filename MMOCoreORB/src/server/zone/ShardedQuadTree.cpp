@@ -0,0 +1,403 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#include "ShardedQuadTree.h"
+
+#include "server/zone/objects/scene/SceneObject.h"
+
+using namespace server::zone;
+
+constexpr int ShardedQuadTree::DEFAULT_GRID_SIZE;
+constexpr int ShardedQuadTree::MAX_GRID_SIZE;
+constexpr float ShardedQuadTree::BATCH_CELL_SIZE;
+
+ShardedQuadTree::ShardedQuadTree(float minx, float miny, float maxx, float maxy, int size) {
+	minX = minx;
+	minY = miny;
+	maxX = maxx;
+	maxY = maxy;
+
+	gridSize = Math::clamp(1, size, MAX_GRID_SIZE);
+
+	shardWidth = (maxX - minX) / gridSize;
+	shardHeight = (maxY - minY) / gridSize;
+
+	shards.removeAll(gridSize * gridSize, 1);
+
+	for (int row = 0; row < gridSize; ++row) {
+		for (int column = 0; column < gridSize; ++column) {
+			float shardMinX = minX + column * shardWidth;
+			float shardMinY = minY + row * shardHeight;
+
+			shards.add(new QuadTree(shardMinX, shardMinY, shardMinX + shardWidth, shardMinY + shardHeight));
+		}
+	}
+
+	oversizedEntries.setNoDuplicateInsertPlan();
+}
+
+ShardedQuadTree::~ShardedQuadTree() {
+	shards.removeAll();
+}
+
+Object* ShardedQuadTree::clone() {
+	return ObjectCloner<ShardedQuadTree>::clone(this);
+}
+
+Object* ShardedQuadTree::clone(void* mem) {
+	return TransactionalObjectCloner<ShardedQuadTree>::clone(this);
+}
+
+void ShardedQuadTree::insert(TreeEntry* obj) {
+	if (AreaQuery::isOversized(obj)) {
+		Locker locker(&oversizedMutex);
+
+		oversizedEntries.put(obj);
+	}
+
+	int newIndex = getShardIndex(obj->getPositionX(), obj->getPositionY());
+
+	while (true) {
+		Reference<TreeNode*> node = obj->getNode();
+
+		if (node != nullptr && getShardIndex(node) != newIndex) {
+			if (migrate(obj, getShardIndex(node), newIndex) == MIGRATE_DONE)
+				return;
+
+			continue;
+		}
+
+		QuadTree* shard = getShard(newIndex);
+
+		Locker locker(&shard->mutex);
+
+		// The entry was inserted or moved by somebody else before we got the lock
+		Reference<TreeNode*> current = obj->getNode();
+
+		if ((current == nullptr) != (node == nullptr) || (current != nullptr && getShardIndex(current) != newIndex))
+			continue;
+
+		shard->insert(obj);
+
+		return;
+	}
+}
+
+void ShardedQuadTree::remove(TreeEntry* obj) {
+	if (AreaQuery::isOversized(obj)) {
+		Locker locker(&oversizedMutex);
+
+		oversizedEntries.drop(obj);
+	}
+
+	while (true) {
+		Reference<TreeNode*> node = obj->getNode();
+
+		if (node == nullptr) {
+			Logger::console.info(true) << hex << "object [" << obj->getObjectID() <<  "] ERROR - removing from sharded quad tree without a node\n";
+			return;
+		}
+
+		int index = getShardIndex(node);
+		QuadTree* shard = getShard(index);
+
+		Locker locker(&shard->mutex);
+
+		// The node might have been moved to another shard before we got the lock
+		Reference<TreeNode*> current = obj->getNode();
+
+		if (current != nullptr && getShardIndex(current) != index)
+			continue;
+
+		shard->remove(obj);
+
+		return;
+	}
+}
+
+void ShardedQuadTree::removeAll() {
+	for (int i = 0; i < shards.size(); ++i) {
+		getShard(i)->removeAll();
+	}
+
+	Locker locker(&oversizedMutex);
+
+	oversizedEntries.removeAll();
+}
+
+bool ShardedQuadTree::update(TreeEntry* obj) {
+	while (true) {
+		Reference<TreeNode*> node = obj->getNode();
+
+		if (node == nullptr)
+			return false;
+
+		int index = getShardIndex(node);
+		int newIndex = getShardIndex(obj->getPositionX(), obj->getPositionY());
+
+		if (newIndex != index) {
+			// Crossed a shard border, migrate the entry to its new shard
+			int result = migrate(obj, index, newIndex);
+
+			if (result == MIGRATE_RETRY)
+				continue;
+
+			return result == MIGRATE_DONE;
+		}
+
+		QuadTree* shard = getShard(index);
+
+		Locker locker(&shard->mutex);
+
+		Reference<TreeNode*> current = obj->getNode();
+
+		if (current == nullptr)
+			return false;
+
+		if (getShardIndex(current) != index)
+			continue;
+
+		return shard->update(obj);
+	}
+}
+
+int ShardedQuadTree::migrate(TreeEntry* obj, int index, int newIndex) {
+	QuadTree* shard = getShard(index);
+	QuadTree* newShard = getShard(newIndex);
+
+	// Both shards are locked in index order for the whole move, so a
+	// concurrent remove can't slip in between the remove and the insert
+	QuadTree* first = index < newIndex ? shard : newShard;
+	QuadTree* second = index < newIndex ? newShard : shard;
+
+	Locker firstLocker(&first->mutex);
+	Locker secondLocker(&second->mutex);
+
+	Reference<TreeNode*> current = obj->getNode();
+
+	if (current == nullptr)
+		return MIGRATE_REMOVED;
+
+	if (getShardIndex(current) != index)
+		return MIGRATE_RETRY;
+
+	shard->remove(obj);
+	newShard->insert(obj);
+
+	return MIGRATE_DONE;
+}
+
+void ShardedQuadTree::inRange(TreeEntry* obj, float range) {
+	float x = obj->getPositionX();
+	float y = obj->getPositionY();
+
+	int minColumn = getColumn(x - range);
+	int maxColumn = getColumn(x + range);
+	int minRow = getRow(y - range);
+	int maxRow = getRow(y + range);
+
+	try {
+		getShard(getShardIndex(x, y))->_removeOutOfRange(obj, range);
+
+		for (int row = minRow; row <= maxRow; ++row) {
+			for (int column = minColumn; column <= maxColumn; ++column) {
+				QuadTree* shard = getShard(row * gridSize + column);
+
+				ReadLocker locker(&shard->mutex);
+
+				shard->_inRange(shard->root, obj, range);
+			}
+		}
+	} catch (Exception& e) {
+		Logger::console.info(true) << "[ShardedQuadTree] " << e.getMessage() << "\n";
+		e.printStackTrace();
+	}
+}
+
+void ShardedQuadTree::safeInRange(TreeEntry* obj, float range) {
+	Locker objLocker(obj);
+
+	float x = obj->getPositionX();
+	float y = obj->getPositionY();
+
+	float copyRange = Math::min(range * 2.0f, 768.0f);
+
+	SortedVector<TreeEntry*> inRangeObjects(500, 250);
+
+	copyObjects(x, y, copyRange, inRangeObjects);
+
+	QuadTree::_addInRangeObjects(obj, range, inRangeObjects);
+}
+
+void ShardedQuadTree::safeInRange(const Vector<Reference<TreeEntry*> >& entries, float range) {
+	int cellsPerAxis = (int) ((maxX - minX) / BATCH_CELL_SIZE);
+
+	VectorMap<uint32, Vector<TreeEntry*> > cells;
+	cells.setNoDuplicateInsertPlan();
+
+	for (int i = 0; i < entries.size(); ++i) {
+		TreeEntry* entry = entries.getUnsafe(i).get();
+
+		int column = Math::clamp(0, (int) ((entry->getPositionX() - minX) / BATCH_CELL_SIZE), cellsPerAxis - 1);
+		int row = Math::clamp(0, (int) ((entry->getPositionY() - minY) / BATCH_CELL_SIZE), cellsPerAxis - 1);
+		uint32 cellKey = row * cellsPerAxis + column;
+
+		int index = cells.find(cellKey);
+
+		if (index == -1)
+			index = cells.put(cellKey, Vector<TreeEntry*>());
+
+		cells.elementAt(index).getValue().add(entry);
+	}
+
+	// Every entry of a cell is at most half a cell diagonal away from its center
+	float copyRange = Math::min(range * 2.0f, 768.0f) + BATCH_CELL_SIZE * 0.7072f;
+
+	SortedVector<TreeEntry*> processedEntries;
+	processedEntries.setNoDuplicateInsertPlan();
+
+	SortedVector<TreeEntry*> inRangeObjects(500, 250);
+
+	for (int i = 0; i < cells.size(); ++i) {
+		uint32 cellKey = cells.elementAt(i).getKey();
+		const Vector<TreeEntry*>& cellEntries = cells.elementAt(i).getValue();
+
+		float centerX = minX + ((cellKey % cellsPerAxis) + 0.5f) * BATCH_CELL_SIZE;
+		float centerY = minY + ((cellKey / cellsPerAxis) + 0.5f) * BATCH_CELL_SIZE;
+
+		inRangeObjects.removeAll(500, 250);
+
+		copyObjects(centerX, centerY, copyRange, inRangeObjects);
+
+		for (int j = 0; j < cellEntries.size(); ++j) {
+			TreeEntry* entry = cellEntries.getUnsafe(j);
+
+			Locker objLocker(entry);
+
+			// The entry might have left the zone or entered a cell since it was queued
+			if (entry->getNode() == nullptr)
+				continue;
+
+			QuadTree::_addInRangeObjects(entry, range, inRangeObjects, &processedEntries);
+
+			processedEntries.put(entry);
+		}
+	}
+}
+
+void ShardedQuadTree::copyObjects(float x, float y, float range, SortedVector<TreeEntry*>& objects) const {
+	int minColumn = getColumn(x - range);
+	int maxColumn = getColumn(x + range);
+	int minRow = getRow(y - range);
+	int maxRow = getRow(y + range);
+
+	for (int row = minRow; row <= maxRow; ++row) {
+		for (int column = minColumn; column <= maxColumn; ++column) {
+			QuadTree* shard = getShard(row * gridSize + column);
+
+			ReadLocker locker(&shard->mutex);
+
+			shard->copyObjects(shard->root, x, y, range, objects);
+		}
+	}
+}
+
+int ShardedQuadTree::inRange(float x, float y, SortedVector<ManagedReference<TreeEntry*> >& objects) const {
+	int count = 0;
+
+	// Entries that contain the point may be centered in a neighbour shard
+	int minColumn = Math::max(0, getColumn(x) - 1);
+	int maxColumn = Math::min(gridSize - 1, getColumn(x) + 1);
+	int minRow = Math::max(0, getRow(y) - 1);
+	int maxRow = Math::min(gridSize - 1, getRow(y) + 1);
+
+	for (int row = minRow; row <= maxRow; ++row) {
+		for (int column = minColumn; column <= maxColumn; ++column) {
+			count += getShard(row * gridSize + column)->inRange(x, y, objects);
+		}
+	}
+
+	return count;
+}
+
+int ShardedQuadTree::inRange(float x, float y, SortedVector<TreeEntry*>& objects) const {
+	int count = 0;
+
+	int minColumn = Math::max(0, getColumn(x) - 1);
+	int maxColumn = Math::min(gridSize - 1, getColumn(x) + 1);
+	int minRow = Math::max(0, getRow(y) - 1);
+	int maxRow = Math::min(gridSize - 1, getRow(y) + 1);
+
+	for (int row = minRow; row <= maxRow; ++row) {
+		for (int column = minColumn; column <= maxColumn; ++column) {
+			count += getShard(row * gridSize + column)->inRange(x, y, objects);
+		}
+	}
+
+	return count;
+}
+
+int ShardedQuadTree::inRange(float x, float y, float range, SortedVector<ManagedReference<TreeEntry*> >& objects) const {
+	int count = 0;
+
+	int minColumn = getColumn(x - range);
+	int maxColumn = getColumn(x + range);
+	int minRow = getRow(y - range);
+	int maxRow = getRow(y + range);
+
+	for (int row = minRow; row <= maxRow; ++row) {
+		for (int column = minColumn; column <= maxColumn; ++column) {
+			count += getShard(row * gridSize + column)->inRange(x, y, range, objects);
+		}
+	}
+
+	return count;
+}
+
+int ShardedQuadTree::inRange(float x, float y, float range, SortedVector<TreeEntry*>& objects) const {
+	int count = 0;
+
+	int minColumn = getColumn(x - range);
+	int maxColumn = getColumn(x + range);
+	int minRow = getRow(y - range);
+	int maxRow = getRow(y + range);
+
+	for (int row = minRow; row <= maxRow; ++row) {
+		for (int column = minColumn; column <= maxColumn; ++column) {
+			count += getShard(row * gridSize + column)->inRange(x, y, range, objects);
+		}
+	}
+
+	return count;
+}
+
+int ShardedQuadTree::inRange(const AreaQuery& query, SortedVector<ManagedReference<TreeEntry*> >& objects) const {
+	int count = 0;
+
+	float range = query.getSearchRadius();
+
+	int minColumn = getColumn(query.getX() - range);
+	int maxColumn = getColumn(query.getX() + range);
+	int minRow = getRow(query.getY() - range);
+	int maxRow = getRow(query.getY() + range);
+
+	for (int row = minRow; row <= maxRow; ++row) {
+		for (int column = minColumn; column <= maxColumn; ++column) {
+			count += getShard(row * gridSize + column)->inRange(query, objects);
+		}
+	}
+
+	ReadLocker locker(&oversizedMutex);
+
+	for (int i = 0; i < oversizedEntries.size(); ++i) {
+		TreeEntry* entry = oversizedEntries.getUnsafe(i);
+
+		// Already found by the walk when it is centered in the search radius
+		if (query.isOversizedCandidate(entry) && objects.put(entry) != -1)
+			++count;
+	}
+
+	return count;
+}
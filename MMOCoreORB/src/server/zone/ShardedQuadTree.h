@@ -0,0 +1,146 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#ifndef SHARDEDQUADTREE_H_
+#define SHARDEDQUADTREE_H_
+
+#include "system/lang.h"
+
+#include "engine/log/Logger.h"
+
+#include "server/zone/TreeEntry.h"
+#include "server/zone/QuadTree.h"
+
+namespace server {
+  namespace zone {
+
+	/**
+	 * Spatial index made of a fixed grid of independent quad trees (shards),
+	 * each guarded by its own lock. Entries live in the shard that contains
+	 * their position, so inserts, updates and range queries on different
+	 * parts of a planet no longer serialize behind a single tree lock.
+	 *
+	 * The public interface mirrors QuadTree so it can be used as a drop in
+	 * replacement by the ground zones.
+	 */
+	class ShardedQuadTree : public Object {
+		Vector<Reference<QuadTree*> > shards;
+
+		float minX, minY;
+		float maxX, maxY;
+
+		float shardWidth, shardHeight;
+
+		int gridSize;
+
+		// Entries that reach farther than the padding of the area query walks, see AreaQuery::isOversized
+		mutable ReadWriteLock oversizedMutex;
+		SortedVector<TreeEntry*> oversizedEntries;
+
+	public:
+		// Default number of shards per axis, 8x8 shards of 2048m on a 16km planet
+		static constexpr int DEFAULT_GRID_SIZE = 8;
+
+		static constexpr int MAX_GRID_SIZE = 64;
+
+		// Size of the cells used to share traversals in batched in range updates
+		static constexpr float BATCH_CELL_SIZE = 64.f;
+
+		ShardedQuadTree(float minx, float miny, float maxx, float maxy, int gridSize = DEFAULT_GRID_SIZE);
+		~ShardedQuadTree();
+
+		Object* clone();
+		Object* clone(void* object);
+
+		void free() {
+			TransactionalMemoryManager::instance()->destroy(this);
+		}
+
+		void insert(TreeEntry* obj);
+
+		void remove(TreeEntry* obj);
+
+		void removeAll();
+
+		/**
+		 * Moves the entry inside its shard or migrates it to the shard
+		 * that now contains its position.
+		 */
+		bool update(TreeEntry* obj);
+
+		void inRange(TreeEntry* obj, float range);
+
+		void safeInRange(TreeEntry* obj, float range);
+
+		/**
+		 * Updates the close objects of a batch of moved entries. Entries are
+		 * grouped by batch cell so each cell does a single traversal of the
+		 * shards. When two entries of the batch are in range of each other, the
+		 * second one doesn't add the first to its close objects again, but
+		 * still notifies it of its new position.
+		 */
+		void safeInRange(const Vector<Reference<TreeEntry*> >& entries, float range);
+
+		int inRange(float x, float y, SortedVector<ManagedReference<TreeEntry*> >& objects) const;
+		int inRange(float x, float y, SortedVector<TreeEntry*>& objects) const;
+
+		int inRange(float x, float y, float range, SortedVector<ManagedReference<TreeEntry*> >& objects) const;
+		int inRange(float x, float y, float range, SortedVector<TreeEntry*>& objects) const;
+
+		int inRange(const AreaQuery& query, SortedVector<ManagedReference<TreeEntry*> >& objects) const;
+
+		inline int getGridSize() const {
+			return gridSize;
+		}
+
+		inline int getShardCount() const {
+			return shards.size();
+		}
+
+	private:
+		inline int getColumn(float x) const {
+			int column = (int) ((x - minX) / shardWidth);
+
+			return Math::clamp(0, column, gridSize - 1);
+		}
+
+		inline int getRow(float y) const {
+			int row = (int) ((y - minY) / shardHeight);
+
+			return Math::clamp(0, row, gridSize - 1);
+		}
+
+		inline int getShardIndex(float x, float y) const {
+			return getRow(y) * gridSize + getColumn(x);
+		}
+
+		/**
+		 * Every node of a shard is contained in the shard bounds, so the node
+		 * divider point identifies the owning shard.
+		 */
+		inline int getShardIndex(const TreeNode* node) const {
+			return getShardIndex(node->dividerX, node->dividerY);
+		}
+
+		inline QuadTree* getShard(int index) const {
+			return shards.getUnsafe(index).get();
+		}
+
+		void copyObjects(float x, float y, float range, SortedVector<TreeEntry*>& objects) const;
+
+		enum { MIGRATE_DONE, MIGRATE_REMOVED, MIGRATE_RETRY };
+
+		/**
+		 * Moves the entry from the shard at index to the shard at newIndex
+		 * while holding both shard locks.
+		 * @return MIGRATE_REMOVED if the entry left the tree meanwhile,
+		 *   MIGRATE_RETRY if it is no longer in the shard at index
+		 */
+		int migrate(TreeEntry* obj, int index, int newIndex);
+	};
+  } // namespace zone
+} // namespace server
+
+#endif /* SHARDEDQUADTREE_H_ */
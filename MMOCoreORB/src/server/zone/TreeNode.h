@@ -45,6 +45,7 @@ namespace server {
 namespace zone {
 
 class QuadTree;
+class ShardedQuadTree;
 class Octree;
 class TreeEntry;
 class TreeEntryImplementation;
@@ -191,6 +192,7 @@ public:
 	String toStringData();
 
 	friend class server::zone::QuadTree;
+	friend class server::zone::ShardedQuadTree;
 	friend class server::zone::Octree;
 	friend class server::zone::TreeEntryImplementation;
 };
@@ -22,6 +22,11 @@ ZoneClientSessionImplementation::ZoneClientSessionImplementation(BaseClientProxy
 
 	pendingTasks = new PendingTasksMap();
 
+	int coalescingWindow = ConfigManager::instance()->getInt("Core3.ZoneServer.DeltaCoalescingWindow", DeltaMessageCoalescer::DEFAULT_WINDOW);
+
+	if (session != nullptr && coalescingWindow > 0)
+		deltaCoalescer = new DeltaMessageCoalescer(session);
+
 	accountID = 0;
 
 	disconnecting = false;
@@ -94,6 +99,11 @@ void ZoneClientSessionImplementation::disconnect() {
 }
 
 void ZoneClientSessionImplementation::sendMessage(BasePacket* msg) {
+	if (deltaCoalescer != nullptr) {
+		deltaCoalescer->sendPacket(msg);
+		return;
+	}
+
 	session->sendPacket(msg);
 }
 
@@ -218,6 +228,9 @@ void ZoneClientSessionImplementation::closeConnection(bool lockPlayer, bool doLo
 		setPlayer(nullptr); // we must call setPlayer to increase/decrease online player counter
 	}
 
+	if (deltaCoalescer != nullptr)
+		deltaCoalescer->clearSession();
+
 	session->disconnect();
 
 	if (server != nullptr) {
@@ -132,6 +132,11 @@ int ZoneImplementation::getInRangePlayers(float x, float z, float y, float range
 	return 0;
 }
 
+int ZoneImplementation::getInRangeObjects(const AreaQuery& query, SortedVector<ManagedReference<TreeEntry*> >* objects, bool readLockZone) {
+
+	return 0;
+}
+
 int ZoneImplementation::getInRangeActiveAreas(float x, float z, float y, SortedVector<ManagedReference<ActiveArea*> >* objects, bool readLockZone) {
 
 	return 0;
@@ -4,6 +4,8 @@
 #include "server/zone/managers/planet/PlanetManager.h"
 #include "terrain/manager/TerrainManager.h"
 #include "terrain/ProceduralTerrainAppearance.h"
+#include "PathFinderManager.h"
+#include "pathfinding/NavMeshTileStore.h"
 
 // Lower thread count, used during runtime
 const String NavMeshManager::TileQueue = "NavMeshWork";
@@ -222,7 +224,26 @@ void NavMeshManager::startJob(Reference<NavMeshJob*> job) {
         return;
     }
 
-    Core::getTaskManager()->executeTask([area, name, builder, initialBuild, this] {
+    VectorMap<uint64, uint64> tileHashes;
+    uint64 inputSalt = 0;
+
+    const dtNavMesh* builtMesh = builder->getNavMesh();
+
+    if (NavMeshTileStore::isEnabled() && builtMesh != nullptr) {
+        Vector<uint64> tileKeys;
+
+        for (int i = 0; i < builtMesh->getMaxTiles(); ++i) {
+            const dtMeshTile* tile = builtMesh->getTile(i);
+
+            if (tile && tile->header && tile->dataSize)
+                tileKeys.add(NavMeshTileStore::getTileKey(tile->header->x, tile->header->y, tile->header->layer));
+        }
+
+        inputSalt = getTileStoreSalt(name, area->getMeshBounds(), *builtMesh->getParams());
+        getTileInputHashes(*builtMesh->getParams(), tileKeys, closeObjects, tileHashes);
+    }
+
+    Core::getTaskManager()->executeTask([area, name, builder, initialBuild, inputSalt, tileHashes, this] {
     	if (stopped)
     		return;
 
@@ -249,9 +270,21 @@ void NavMeshManager::startJob(Reference<NavMeshJob*> job) {
     	navmesh->setupDetourNavMeshHeader();
     	area->_setUpdated(true);
 
+	// Paths found on the previous mesh might cross the new obstacles
+	PathFinderManager::instance()->clearPathCache();
+
 	info() <<
 		"Done building and setting navmesh for area: " << name << " on planet: "
 		<< zone->getZoneName() << " at: " << area->getPosition().toString();
+
+	if (NavMeshTileStore::isEnabled()) {
+		locker.release();
+
+		ReadLocker rlocker(area);
+
+		if (!navmesh->saveToTileStore(inputSalt, tileHashes))
+			error() << "Failed to save the tile store of navmesh " << name;
+	}
     }, "setNavMeshLambda");
 
     Locker locker(&jobQueueMutex);
@@ -272,6 +305,235 @@ void NavMeshManager::startJob(Reference<NavMeshJob*> job) {
     }, "checkNavJobs", 1000, TileQueue.toCharArray());
 }
 
+uint64 NavMeshManager::getTileStoreSalt(const String& meshName, const AABB& meshBounds, const dtNavMeshParams& params) {
+	uint64 salt = meshName.hashCode();
+
+	auto mix = [&salt] (uint64 value) {
+		salt = (salt ^ value) * 1099511628211ULL;
+	};
+
+	for (int i = 0; i < 3; ++i) {
+		mix((int64) ((*meshBounds.getMinBound())[i] * 100.f));
+		mix((int64) ((*meshBounds.getMaxBound())[i] * 100.f));
+		mix((int64) (params.orig[i] * 100.f));
+	}
+
+	mix((int64) (params.tileWidth * 100.f));
+	mix((int64) (params.tileHeight * 100.f));
+	mix(NAVMESHSET_VERSION);
+
+	return salt;
+}
+
+AABB NavMeshManager::getTileBounds(const dtNavMeshParams& params, int tileX, int tileY) {
+	// Recast z is the negated world y
+	float minX = params.orig[0] + tileX * params.tileWidth;
+	float minZ = params.orig[2] + tileY * params.tileHeight;
+
+	return AABB(Vector3(minX, -(minZ + params.tileHeight), -100000.f), Vector3(minX + params.tileWidth, -minZ, 100000.f));
+}
+
+void NavMeshManager::getTileInputHashes(const dtNavMeshParams& params, const Vector<uint64>& tileKeys, const SortedVector<ManagedReference<TreeEntry*> >& objects, VectorMap<uint64, uint64>& hashes) {
+	Vector<AABB> objectBounds;
+	Vector<uint64> objectHashes;
+
+	for (int i = 0; i < objects.size(); ++i) {
+		SceneObject* sceno = objects.getUnsafe(i).castTo<SceneObject*>();
+
+		if (sceno == nullptr)
+			continue;
+
+		Vector3 position = sceno->getWorldPosition();
+		float len = 0.f;
+
+		const BaseBoundingVolume* volume = sceno->getBoundingVolume();
+
+		if (volume != nullptr) {
+			AABB bbox = volume->getBoundingBox();
+			len = bbox.extents()[bbox.longestAxis()];
+		}
+
+		Vector3 extents(len, len, len);
+		objectBounds.add(AABB(position - extents, position + extents));
+
+		uint64 hash = sceno->getObjectID();
+		hash = (hash ^ sceno->getServerObjectCRC()) * 1099511628211ULL;
+		hash = (hash ^ (uint32) (int32) (position.getX() * 100.f)) * 1099511628211ULL;
+		hash = (hash ^ (uint32) (int32) (position.getY() * 100.f)) * 1099511628211ULL;
+		hash = (hash ^ (uint32) (int32) (position.getZ() * 100.f)) * 1099511628211ULL;
+		hash = (hash ^ (uint32) (int32) (sceno->getDirectionAngle() * 100.f)) * 1099511628211ULL;
+
+		objectHashes.add(hash);
+	}
+
+	hashes.setNoDuplicateInsertPlan();
+
+	for (int i = 0; i < tileKeys.size(); ++i) {
+		uint64 tileKey = tileKeys.get(i);
+		AABB tileBounds = getTileBounds(params, (int) (tileKey >> 32), (int) ((tileKey >> 16) & 0xFFFF));
+
+		// Summed so the order of the objects doesn't matter
+		uint64 tileHash = tileKey;
+
+		for (int j = 0; j < objectBounds.size(); ++j) {
+			const AABB& bounds = objectBounds.get(j);
+
+			if (bounds.getXMax() < tileBounds.getXMin() || bounds.getXMin() > tileBounds.getXMax()
+				|| bounds.getYMax() < tileBounds.getYMin() || bounds.getYMin() > tileBounds.getYMax())
+				continue;
+
+			tileHash += objectHashes.get(j);
+		}
+
+		// 0 means unknown in the store
+		hashes.put(tileKey, tileHash == 0 ? 1 : tileHash);
+	}
+}
+
+void NavMeshManager::checkTileStore(NavArea* area) {
+	if (stopped || zoneServer == nullptr)
+		return;
+
+	ManagedReference<NavArea*> strongArea = area;
+
+	if (zoneServer->isServerLoading()) {
+		Core::getTaskManager()->scheduleTask([this, strongArea] {
+			checkTileStore(strongArea);
+		}, "checkNavTileStore", 5000, TileQueue.toCharArray());
+
+		return;
+	}
+
+	Zone* zone = area->getZone();
+
+	if (zone == nullptr)
+		return;
+
+	RecastNavMesh* navmesh = area->getNavMesh();
+
+	ReadLocker rlocker(area);
+
+	// Keeps the tile table around even if the mesh gets rebuilt meanwhile
+	Reference<NavMeshTileStore*> store = navmesh->getTileStore();
+
+	const dtNavMesh* loadedMesh = navmesh->getNavMesh();
+
+	rlocker.release();
+
+	if (store == nullptr) {
+		// Copied from the database, write its tiles to the store for the next boot
+		if (loadedMesh != nullptr)
+			saveLoadedMesh(area, loadedMesh);
+
+		return;
+	}
+
+	const dtNavMeshParams& params = *store->getParams();
+	const String name = area->getMeshName();
+
+	static const RecastSettings settings;
+
+	if (store->getInputSalt() != getTileStoreSalt(name, area->getMeshBounds(), params)) {
+		info() << "Tile store of " << name << " was baked with different inputs, rebuilding the whole mesh";
+
+		enqueueJob(area, area->getBoundingBox(), settings, TileQueue);
+		return;
+	}
+
+	const AABB& bBox = area->getBoundingBox();
+	float range = bBox.extents()[bBox.longestAxis()];
+	const Vector3& center = bBox.center();
+
+	SortedVector<ManagedReference<TreeEntry*> > closeObjects;
+	zone->getInRangeSolidObjects(center.getX(), 0, center.getZ(), range, &closeObjects, true);
+
+	Vector<uint64> tileKeys;
+
+	for (int i = 0; i < store->getNumTiles(); ++i) {
+		const NavMeshTileStoreEntry& entry = store->getEntry(i);
+
+		tileKeys.add(NavMeshTileStore::getTileKey(entry.tileX, entry.tileY, entry.layer));
+	}
+
+	VectorMap<uint64, uint64> tileHashes;
+	getTileInputHashes(params, tileKeys, closeObjects, tileHashes);
+
+	int changedTiles = 0;
+	bool unknownTiles = false;
+
+	for (int i = 0; i < store->getNumTiles(); ++i) {
+		const NavMeshTileStoreEntry& entry = store->getEntry(i);
+
+		// Offline bakes have no input hashes, their tiles are trusted and stamped below
+		if (entry.inputHash == 0) {
+			unknownTiles = true;
+			continue;
+		}
+
+		if (entry.inputHash == tileHashes.get(NavMeshTileStore::getTileKey(entry.tileX, entry.tileY, entry.layer)))
+			continue;
+
+		AABB tileBounds = getTileBounds(params, entry.tileX, entry.tileY);
+		Vector3 tileCenter = tileBounds.center();
+		Vector3 extents(params.tileWidth * 0.5f, params.tileWidth * 0.5f, params.tileWidth * 0.5f);
+
+		enqueueJob(area, AABB(tileCenter - extents, tileCenter + extents), settings, TileQueue);
+		++changedTiles;
+	}
+
+	if (changedTiles > 0) {
+		info() << "Rebuilding " << changedTiles << " changed tiles of " << name;
+	} else if (unknownTiles) {
+		ReadLocker locker(area);
+
+		if (navmesh->getTileStore() == store)
+			navmesh->saveToTileStore(store->getInputSalt(), tileHashes);
+	}
+}
+
+void NavMeshManager::saveLoadedMesh(NavArea* area, const dtNavMesh* loadedMesh) {
+	Zone* zone = area->getZone();
+
+	if (zone == nullptr)
+		return;
+
+	RecastNavMesh* navmesh = area->getNavMesh();
+	const dtNavMeshParams& params = *loadedMesh->getParams();
+	const String name = area->getMeshName();
+
+	const AABB& bBox = area->getBoundingBox();
+	float range = bBox.extents()[bBox.longestAxis()];
+	const Vector3& center = bBox.center();
+
+	SortedVector<ManagedReference<TreeEntry*> > closeObjects;
+	zone->getInRangeSolidObjects(center.getX(), 0, center.getZ(), range, &closeObjects, true);
+
+	ReadLocker locker(area);
+
+	if (navmesh->getNavMesh() != loadedMesh)
+		return;
+
+	Vector<uint64> tileKeys;
+
+	for (int i = 0; i < loadedMesh->getMaxTiles(); ++i) {
+		const dtMeshTile* tile = loadedMesh->getTile(i);
+
+		if (tile && tile->header && tile->dataSize)
+			tileKeys.add(NavMeshTileStore::getTileKey(tile->header->x, tile->header->y, tile->header->layer));
+	}
+
+	// The saved mesh is trusted to match the current objects, as it did before the store existed
+	VectorMap<uint64, uint64> tileHashes;
+	getTileInputHashes(params, tileKeys, closeObjects, tileHashes);
+
+	if (!navmesh->saveToTileStore(getTileStoreSalt(name, area->getMeshBounds(), params), tileHashes)) {
+		error() << "Failed to save the tile store of navmesh " << name;
+		return;
+	}
+
+	info() << "Saved the tile store of navmesh " << name;
+}
+
 void NavMeshManager::cancelJobs(NavArea* area) {
     Locker locker(&jobQueueMutex);
 
@@ -365,3 +627,55 @@ void NavMeshManager::dumpMeshesToFiles() {
 		error("Could not load the navareas database.");
 	}
 }
+
+void NavMeshManager::bakeMeshesToTileStore() {
+	ObjectDatabaseManager* dbManager = ObjectDatabaseManager::instance();
+	dbManager->loadDatabases(false);
+	ObjectDatabase* navAreasDatabase = dbManager->loadObjectDatabase("navareas", false, 0xFFFF, false);
+
+	if (navAreasDatabase == nullptr) {
+		error("Could not load the navareas database.");
+		return;
+	}
+
+	int baked = 0;
+
+	try {
+		ObjectDatabaseIterator iterator(navAreasDatabase);
+
+		uint64 objectID;
+		ObjectInputStream* objectData = new ObjectInputStream(2000);
+
+		while (iterator.getNextKeyAndValue(objectID, objectData)) {
+			RecastNavMesh mesh;
+			AABB meshBounds;
+
+			if (!Serializable::getVariable<RecastNavMesh>(STRING_HASHCODE("NavArea.recastNavMesh"), &mesh, objectData)
+				|| !Serializable::getVariable<AABB>(STRING_HASHCODE("NavArea.meshBounds"), &meshBounds, objectData)) {
+				objectData->clear();
+				continue;
+			}
+
+			// Already mapped from a store holding the same tiles as the database
+			if (!mesh.isLoaded() || mesh.getTileStore() != nullptr) {
+				objectData->clear();
+				continue;
+			}
+
+			// No objects are loaded here, checkTileStore stamps the input hashes at boot
+			VectorMap<uint64, uint64> noHashes;
+			uint64 inputSalt = getTileStoreSalt(mesh.getName(), meshBounds, *mesh.getNavMesh()->getParams());
+
+			if (mesh.saveToTileStore(inputSalt, noHashes))
+				++baked;
+
+			objectData->clear();
+		}
+
+		delete objectData;
+	} catch (DatabaseException& e) {
+		error("Database exception in NavMeshManager::bakeMeshesToTileStore(): " + e.getMessage());
+	}
+
+	info(String::valueOf(baked) + " nav meshes baked to the tile store.", true);
+}
@@ -26,6 +26,15 @@ protected:
 	void startJob(Reference<NavMeshJob*> job);
     	void checkJobs();
 
+	void saveLoadedMesh(NavArea* area, const dtNavMesh* loadedMesh);
+
+	static AABB getTileBounds(const dtNavMeshParams& params, int tileX, int tileY);
+
+	/**
+	 * Hashes the objects overlapping each of the tiles, keyed by NavMeshTileStore::getTileKey
+	 */
+	static void getTileInputHashes(const dtNavMeshParams& params, const Vector<uint64>& tileKeys, const SortedVector<ManagedReference<TreeEntry*> >& objects, VectorMap<uint64, uint64>& hashes);
+
 public:
 	NavMeshManager();
 	~NavMeshManager() { }
@@ -43,6 +52,21 @@ public:
 
 	void dumpMeshesToFiles();
 
+	/**
+	 * Writes the tile store of every mesh in the navareas database that doesn't have a
+	 * matching one yet
+	 */
+	void bakeMeshesToTileStore();
+
+	/**
+	 * Once the server is loaded, queues rebuilds for the tiles of a mesh loaded from the
+	 * tile store whose objects changed since it was baked. A mesh copied from the
+	 * database gets its tiles written to the store for the next boot instead.
+	 */
+	void checkTileStore(NavArea* area);
+
+	static uint64 getTileStoreSalt(const String& meshName, const AABB& meshBounds, const dtNavMeshParams& params);
+
 	static bool AABBEncompasessAABB(const AABB& lhs, const AABB& rhs);
 
 	// Lower thread count, used during runtime
@@ -0,0 +1,149 @@
+/*
+ * PathCache.cpp
+ */
+
+#include "PathCache.h"
+#include "server/zone/Zone.h"
+
+constexpr float PathCacheKey::CELL_QUANTUM;
+
+PathCacheKey::PathCacheKey() : zoneCRC(0), cellA(0), cellB(0),
+		startX(0), startY(0), startZ(0), goalX(0), goalY(0), goalZ(0) {
+}
+
+PathCacheKey::PathCacheKey(const WorldCoordinates& pointA, const WorldCoordinates& pointB, Zone* zone, float worldQuantum) {
+	zoneCRC = zone != nullptr ? zone->getZoneCRC() : 0;
+
+	CellObject* cellObjectA = pointA.getCell();
+	CellObject* cellObjectB = pointB.getCell();
+
+	cellA = cellObjectA != nullptr ? cellObjectA->getObjectID() : 0;
+	cellB = cellObjectB != nullptr ? cellObjectB->getObjectID() : 0;
+
+	float quantumA = cellA != 0 ? CELL_QUANTUM : Math::max(CELL_QUANTUM, worldQuantum);
+	float quantumB = cellB != 0 ? CELL_QUANTUM : Math::max(CELL_QUANTUM, worldQuantum);
+
+	startX = (int32) floor(pointA.getX() / quantumA);
+	startY = (int32) floor(pointA.getY() / quantumA);
+	startZ = (int32) floor(pointA.getZ() / quantumA);
+
+	goalX = (int32) floor(pointB.getX() / quantumB);
+	goalY = (int32) floor(pointB.getY() / quantumB);
+	goalZ = (int32) floor(pointB.getZ() / quantumB);
+}
+
+bool PathCacheKey::operator==(const PathCacheKey& key) const {
+	return zoneCRC == key.zoneCRC && cellA == key.cellA && cellB == key.cellB
+		&& startX == key.startX && startY == key.startY && startZ == key.startZ
+		&& goalX == key.goalX && goalY == key.goalY && goalZ == key.goalZ;
+}
+
+uint64 PathCacheKey::hashCode() const {
+	uint64 hash = 14695981039346656037ULL;
+
+	auto mix = [&hash] (uint64 value) {
+		hash ^= value;
+		hash *= 1099511628211ULL;
+	};
+
+	mix(zoneCRC);
+	mix(cellA);
+	mix(cellB);
+	mix((uint32) startX);
+	mix((uint32) startY);
+	mix((uint32) startZ);
+	mix((uint32) goalX);
+	mix((uint32) goalY);
+	mix((uint32) goalZ);
+
+	return hash;
+}
+
+PathCache::PathCache(int maxEntries, uint64 maxAge) : maxEntries(maxEntries), maxAge(maxAge) {
+	entries.setNoDuplicateInsertPlan();
+}
+
+Vector<WorldCoordinates>* PathCache::get(const PathCacheKey& key) {
+	if (!isEnabled())
+		return nullptr;
+
+	uint64 now = System::getMiliTime();
+	uint64 hash = key.hashCode();
+
+	Locker locker(&mutex);
+
+	int index = entries.find(hash);
+
+	if (index == -1)
+		return nullptr;
+
+	Entry& entry = entries.elementAt(index).getValue();
+
+	if (entry.key != key)
+		return nullptr;
+
+	if (now - entry.createTime > maxAge) {
+		entries.remove(index);
+		return nullptr;
+	}
+
+	entry.lastUse = now;
+
+	return new Vector<WorldCoordinates>(*entry.path);
+}
+
+void PathCache::put(const PathCacheKey& key, const Vector<WorldCoordinates>* path) {
+	if (!isEnabled() || path == nullptr)
+		return;
+
+	uint64 now = System::getMiliTime();
+	uint64 hash = key.hashCode();
+
+	Entry entry;
+	entry.key = key;
+	entry.path = new Vector<WorldCoordinates>(*path);
+	entry.createTime = now;
+	entry.lastUse = now;
+
+	Locker locker(&mutex);
+
+	// A colliding key simply replaces the older entry
+	entries.drop(hash);
+
+	if (entries.size() >= maxEntries)
+		evictOldest(now);
+
+	entries.put(hash, entry);
+}
+
+void PathCache::clear() {
+	Locker locker(&mutex);
+
+	entries.removeAll();
+}
+
+void PathCache::evictOldest(uint64 now) {
+	int oldest = -1;
+	uint64 oldestUse = now;
+
+	for (int i = entries.size() - 1; i >= 0; --i) {
+		const Entry& entry = entries.elementAt(i).getValue();
+
+		if (now - entry.createTime > maxAge) {
+			entries.remove(i);
+
+			if (oldest > i)
+				--oldest;
+
+			continue;
+		}
+
+		if (oldest == -1 || entry.lastUse < oldestUse) {
+			oldest = i;
+			oldestUse = entry.lastUse;
+		}
+	}
+
+	if (entries.size() >= maxEntries && oldest != -1)
+		entries.remove(oldest);
+}
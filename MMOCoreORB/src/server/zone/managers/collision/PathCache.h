@@ -0,0 +1,92 @@
+/*
+ * PathCache.h
+ */
+
+#ifndef PATHCACHE_H_
+#define PATHCACHE_H_
+
+#include "engine/engine.h"
+
+#include "server/zone/objects/scene/WorldCoordinates.h"
+
+namespace server {
+ namespace zone {
+  class Zone;
+ }
+}
+
+using namespace server::zone;
+
+/**
+ * Identifies a path request by its zone, cells and start/goal positions
+ * snapped to a grid, so requests a few centimeters apart share a path.
+ */
+class PathCacheKey {
+	uint32 zoneCRC;
+	uint64 cellA;
+	uint64 cellB;
+
+	int32 startX, startY, startZ;
+	int32 goalX, goalY, goalZ;
+
+public:
+	// Cell positions need a finer grid than the world ones
+	static constexpr float CELL_QUANTUM = 0.5f;
+
+	PathCacheKey();
+	PathCacheKey(const WorldCoordinates& pointA, const WorldCoordinates& pointB, Zone* zone, float worldQuantum);
+
+	bool operator==(const PathCacheKey& key) const;
+
+	inline bool operator!=(const PathCacheKey& key) const {
+		return !(*this == key);
+	}
+
+	uint64 hashCode() const;
+};
+
+/**
+ * Small LRU of recently found paths. Entries expire after maxAge miliseconds
+ * as navmeshes and buildings change under them.
+ */
+class PathCache {
+	class Entry {
+	public:
+		PathCacheKey key;
+		Reference<Vector<WorldCoordinates>*> path;
+
+		uint64 createTime;
+		uint64 lastUse;
+
+		Entry() : createTime(0), lastUse(0) {
+		}
+	};
+
+	VectorMap<uint64, Entry> entries;
+
+	int maxEntries;
+	uint64 maxAge;
+
+	Mutex mutex;
+
+public:
+	PathCache(int maxEntries, uint64 maxAge);
+
+	/**
+	 * @return a copy of the cached path for key, or nullptr
+	 */
+	Vector<WorldCoordinates>* get(const PathCacheKey& key);
+
+	void put(const PathCacheKey& key, const Vector<WorldCoordinates>* path);
+
+	void clear();
+
+	inline bool isEnabled() const {
+		return maxEntries > 0;
+	}
+
+private:
+	void evictOldest(uint64 now);
+};
+
+#endif /* PATHCACHE_H_ */
@@ -24,11 +24,14 @@
 
 const static constexpr int MAX_QUERY_NODES = 2048 * 2;
 
+const String PathFinderManager::PathQueue = "PathFinder";
+
 void destroyNavMeshQuery(void* value) {
 	dtFreeNavMeshQuery(reinterpret_cast<dtNavMeshQuery*>(value));
 }
 
-PathFinderManager::PathFinderManager() : Logger("PathFinderManager"), m_navQuery(destroyNavMeshQuery) {
+PathFinderManager::PathFinderManager() : Logger("PathFinderManager"), m_navQuery(destroyNavMeshQuery),
+		pathCache(ConfigManager::instance()->getInt("Core3.PathFinder.CacheSize", 512), ConfigManager::instance()->getInt("Core3.PathFinder.CacheMaxAge", 5000)) {
 	setFileLogger("log/pathfinder.log", true, true);
 	setLogToConsole(false);
 	setGlobalLogging(false);
@@ -49,9 +52,90 @@ PathFinderManager::PathFinderManager() : Logger("PathFinderManager"), m_navQuery
 	m_spawnFilter.setAreaCost(SAMPLE_POLYAREA_GROUND, 1.0f);
 	m_spawnFilter.setExcludeFlags(0);
 
+	pathThreads = ConfigManager::instance()->getInt("Core3.PathFinder.Threads", 2);
+	pathCacheQuantum = ConfigManager::instance()->getFloat("Core3.PathFinder.CacheQuantum", 2.f);
+
+	pendingRequests.setNoDuplicateInsertPlan();
+
 	setLogging(true);
 }
 
+void PendingPathRequest::complete(const Vector<WorldCoordinates>* path) {
+	for (int i = 0; i < waiters.size(); ++i) {
+		PathRequestWaiter* waiter = waiters.get(i);
+		Reference<Vector<WorldCoordinates>*> copy = nullptr;
+
+		if (path != nullptr) {
+			copy = new Vector<WorldCoordinates>(*path);
+
+			if (copy->size() > 0)
+				copy->set(0, waiter->start);
+		}
+
+		waiter->callback(copy);
+	}
+}
+
+Reference<Vector<WorldCoordinates>*> PathFinderManager::findPathAsync(const WorldCoordinates& pointA, const WorldCoordinates& pointB, Zone* zone, const PathRequestCallback& callback) {
+	PathCacheKey key(pointA, pointB, zone, pathCacheQuantum);
+
+	Reference<Vector<WorldCoordinates>*> cached = pathCache.get(key);
+
+	if (cached != nullptr) {
+		if (cached->size() > 0)
+			cached->set(0, pointA);
+
+		return cached;
+	}
+
+	const auto static initialized = Core::getTaskManager()->initializeCustomQueue(PathQueue.toCharArray(), Math::max(1, pathThreads), false);
+
+	uint64 hash = key.hashCode();
+
+	Locker locker(&pendingMutex);
+
+	Reference<PendingPathRequest*> pending = pendingRequests.get(hash);
+
+	if (pending != nullptr && pending->getKey() == key) {
+		pending->addCallback(pointA, callback);
+
+		return nullptr;
+	}
+
+	Reference<PendingPathRequest*> request = new PendingPathRequest(key);
+	request->addCallback(pointA, callback);
+
+	// On a hash collision the request runs on its own
+	if (pending == nullptr)
+		pendingRequests.put(hash, request);
+
+	locker.release();
+
+	ManagedReference<Zone*> zoneRef = zone;
+
+	Core::getTaskManager()->executeTask([this, request, hash, pointA, pointB, zoneRef] () {
+		Reference<Vector<WorldCoordinates>*> path = findPath(pointA, pointB, zoneRef);
+
+		if (path != nullptr)
+			pathCache.put(request->getKey(), path);
+
+		Locker locker(&pendingMutex);
+
+		if (pendingRequests.get(hash) == request)
+			pendingRequests.drop(hash);
+
+		locker.release();
+
+		request->complete(path);
+	}, "FindPathAsyncLambda", PathQueue.toCharArray());
+
+	return nullptr;
+}
+
+void PathFinderManager::clearPathCache() {
+	pathCache.clear();
+}
+
 Vector<WorldCoordinates>* PathFinderManager::findPath(const WorldCoordinates& pointA, const WorldCoordinates& pointB, Zone *zone) {
 #ifdef PLATFORM_WIN
 #undef isnan
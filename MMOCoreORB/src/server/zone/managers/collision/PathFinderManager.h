@@ -11,6 +11,7 @@
 #include "server/zone/objects/scene/WorldCoordinates.h"
 #include "server/zone/objects/pathfinding/NavArea.h"
 #include "pathfinding/recast/DetourNavMeshQuery.h"
+#include "PathCache.h"
 
 namespace server {
  namespace zone {
@@ -49,12 +50,59 @@ public:
 	const Reference<NavArea*>& getNavArea() { return area; }
 };
 
+typedef std::function<void(Reference<Vector<WorldCoordinates>*> path)> PathRequestCallback;
+
+class PathRequestWaiter : public Object {
+public:
+	WorldCoordinates start;
+	PathRequestCallback callback;
+
+	PathRequestWaiter(const WorldCoordinates& start, const PathRequestCallback& callback) : start(start), callback(callback) {
+	}
+};
+
+class PendingPathRequest : public Object {
+	PathCacheKey key;
+
+	Vector<Reference<PathRequestWaiter*> > waiters;
+
+public:
+	PendingPathRequest(const PathCacheKey& key) : key(key) {
+	}
+
+	void addCallback(const WorldCoordinates& start, const PathRequestCallback& callback) {
+		waiters.add(new PathRequestWaiter(start, callback));
+	}
+
+	void complete(const Vector<WorldCoordinates>* path);
+
+	const PathCacheKey& getKey() const {
+		return key;
+	}
+};
+
 class PathFinderManager : public Singleton<PathFinderManager>, public Logger, public Object {
 public:
+	static const String PathQueue;
+
 	PathFinderManager();
 
 	Vector<WorldCoordinates>* findPath(const WorldCoordinates& pointA, const WorldCoordinates& pointB, Zone* zone);
 
+	/**
+	 * Finds a path on the pathfinding workers. A cached path is returned right away,
+	 * otherwise nullptr is returned and callback is invoked from a worker thread once
+	 * the path is found. Identical requests in flight share one query.
+	 * Callbacks receive their own copy of the path, nullptr when no path was found.
+	 */
+	Reference<Vector<WorldCoordinates>*> findPathAsync(const WorldCoordinates& pointA, const WorldCoordinates& pointB, Zone* zone, const PathRequestCallback& callback);
+
+	void clearPathCache();
+
+	inline bool isAsyncPathingEnabled() const {
+		return pathThreads > 0;
+	}
+
 	void filterPastPoints(Vector<WorldCoordinates>* path, SceneObject* object);
 
 	static Vector3 transformToModelSpace(const Vector3& point, SceneObject* building);
@@ -89,6 +137,14 @@ private:
 	dtQueryFilter m_filter;
 	dtQueryFilter m_spawnFilter;
 	ThreadLocal<dtNavMeshQuery*> m_navQuery;
+
+	int pathThreads;
+	float pathCacheQuantum;
+
+	PathCache pathCache;
+
+	VectorMap<uint64, Reference<PendingPathRequest*> > pendingRequests;
+	Mutex pendingMutex;
 };
 
 #endif /* PATHFINDERMANAGER_H_ */
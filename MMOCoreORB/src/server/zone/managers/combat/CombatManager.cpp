@@ -31,6 +31,8 @@
 #include "server/zone/managers/frs/FrsManager.h"
 #include "server/zone/objects/intangible/PetControlDevice.h"
 #include "server/zone/objects/installation/TurretObject.h"
+#include "server/zone/managers/skill/SkillModRegistry.h"
+#include "server/zone/AreaQuery.h"
 
 #define COMBAT_SPAM_RANGE 85 // Range at which players will see Combat Log Info
 
@@ -982,22 +984,37 @@ Reference<SortedVector<ManagedReference<TangibleObject*>>*> CombatManager::getAr
 	try {
 		// zone->rlock();
 
-		CloseObjectsVector* vec = (CloseObjectsVector*)attacker->getCloseObjects();
+		SortedVector<ManagedReference<TreeEntry*> > closeObjects;
 
-		SortedVector<TreeEntry*> closeObjects;
+		// Outdoors, ground zones return the tangibles in range and cone straight from their spatial index. Indoors
+		// the close objects are kept, as a building can reach farther than the index walk pads the range by.
+		bool indexedQuery = zone->isGroundZone() && attacker->getParentID() == 0;
 
-		if (vec != nullptr) {
-			closeObjects.removeAll(vec->size(), 10);
-			vec->safeCopyTo(closeObjects);
+		if (indexedQuery) {
+			Vector3 worldPos = attacker->getWorldPosition();
+
+			AreaQuery query(worldPos.getX(), worldPos.getZ(), worldPos.getY(), range + attacker->getTemplateRadius());
+
+			if (data.getCommand()->isConeAction())
+				query.setCone(attackerPos.getX(), attackerPos.getY(), dx, dy, data.getConeAngle());
+
+			zone->getInRangeObjects(query, &closeObjects, true);
 		} else {
+			CloseObjectsVector* vec = (CloseObjectsVector*)attacker->getCloseObjects();
+
+			if (vec != nullptr) {
+				closeObjects.removeAll(vec->size(), 10);
+				vec->safeCopyTo(closeObjects);
+			} else {
 #ifdef COV_DEBUG
-			attacker->info("Null closeobjects vector in CombatManager::getAreaTargets", true);
+				attacker->info("Null closeobjects vector in CombatManager::getAreaTargets", true);
 #endif
-			zone->getInRangeObjects(attackerPos.getX(), 0, attackerPos.getY(), 128, &closeObjects, true);
+				zone->getInRangeObjects(attackerPos.getX(), 0, attackerPos.getY(), 128, &closeObjects, true);
+			}
 		}
 
 		for (int i = 0; i < closeObjects.size(); ++i) {
-			SceneObject* object = static_cast<SceneObject*>(closeObjects.get(i));
+			SceneObject* object = static_cast<SceneObject*>(closeObjects.getUnsafe(i).get());
 
 			TangibleObject* tano = object->asTangibleObject();
 
@@ -1061,7 +1078,7 @@ Reference<SortedVector<ManagedReference<TangibleObject*>>*> CombatManager::getAr
 				continue;
 			}
 
-			if (data.getCommand()->isConeAction() && !checkConeAngle(tano, data.getConeAngle(), attackerPos.getX(), attackerPos.getY(), dx, dy)) {
+			if (!indexedQuery && data.getCommand()->isConeAction() && !checkConeAngle(tano, data.getConeAngle(), attackerPos.getX(), attackerPos.getY(), dx, dy)) {
 				// error("object is not in cone angle");
 				continue;
 			}
@@ -1135,7 +1152,7 @@ float CombatManager::calculateDamage(CreatureObject* attacker, WeaponObject* wea
 
 	damage = applyDamageModifiers(attacker, weapon, damage, data);
 
-	damage += defender->getSkillMod("private_damage_susceptibility");
+	damage += defender->getSkillMod(SkillModID::PRIVATE_DAMAGE_SUSCEPTIBILITY);
 
 	if (attacker->isPlayerCreature()) {
 		if (data.isForceAttack() && !defender->isPlayerCreature())
@@ -1164,7 +1181,7 @@ float CombatManager::calculateDamage(CreatureObject* attacker, WeaponObject* wea
 
 	// Force Defense skillmod damage reduction
 	if (data.isForceAttack()) {
-		int forceDefense = defender->getSkillMod("force_defense");
+		int forceDefense = defender->getSkillMod(SkillModID::FORCE_DEFENSE);
 
 		if (forceDefense > 0)
 			damage *= 1.f / (1.f + ((float)forceDefense / 100.f));
@@ -1247,7 +1264,7 @@ float CombatManager::calculateDamage(TangibleObject* attacker, WeaponObject* wea
 	if (diff > 0)
 		damage = System::random(diff) + (int)minDamage;
 
-	damage += defender->getSkillMod("private_damage_susceptibility");
+	damage += defender->getSkillMod(SkillModID::PRIVATE_DAMAGE_SUSCEPTIBILITY);
 
 	if (defender->isKnockedDown())
 		damage *= 1.5f;
@@ -1316,26 +1333,26 @@ float CombatManager::applyDamageModifiers(CreatureObject* attacker, WeaponObject
 		int attackType = weapon->getAttackType();
 
 		if (attackType == SharedWeaponObjectTemplate::MELEEATTACK) // Berserk Bonus
-			damage += attacker->getSkillMod("private_melee_damage_bonus");
+			damage += attacker->getSkillMod(SkillModID::PRIVATE_MELEE_DAMAGE_BONUS);
 		if (attackType == SharedWeaponObjectTemplate::RANGEDATTACK)
-			damage += attacker->getSkillMod("private_ranged_damage_bonus");
+			damage += attacker->getSkillMod(SkillModID::PRIVATE_RANGED_DAMAGE_BONUS);
 	}
 
-	damage += attacker->getSkillMod("private_damage_bonus");
+	damage += attacker->getSkillMod(SkillModID::PRIVATE_DAMAGE_BONUS);
 
-	int damageMultiplier = attacker->getSkillMod("private_damage_multiplier");
+	int damageMultiplier = attacker->getSkillMod(SkillModID::PRIVATE_DAMAGE_MULTIPLIER);
 
 	if (damageMultiplier != 0)
 		damage *= damageMultiplier;
 
-	int damageDivisor = attacker->getSkillMod("private_damage_divisor");
+	int damageDivisor = attacker->getSkillMod(SkillModID::PRIVATE_DAMAGE_DIVISOR);
 
 	if (damageDivisor != 0)
 		damage /= damageDivisor;
 
 	// States Damage Reduction
-	float intimidateMod = attacker->getSkillMod("private_damage_divisor_intimidate");
-	float stunMod = attacker->getSkillMod("private_damage_divisor_stun");
+	float intimidateMod = attacker->getSkillMod(SkillModID::PRIVATE_DAMAGE_DIVISOR_INTIMIDATE);
+	float stunMod = attacker->getSkillMod(SkillModID::PRIVATE_DAMAGE_DIVISOR_STUN);
 	float preDamage = damage;
 
 #ifdef DEBUG_STATE_REDUCTION
@@ -1380,11 +1397,11 @@ void CombatManager::getFrsModifiedForceAttackDamage(CreatureObject* attacker, fl
 	int powerModifier = 0;
 
 	if (councilType == FrsManager::COUNCIL_LIGHT) {
-		powerModifier = attacker->getSkillMod("force_power_light");
+		powerModifier = attacker->getSkillMod(SkillModID::FORCE_POWER_LIGHT);
 		minMod = data.getFrsLightMinDamageModifier();
 		maxMod = data.getFrsLightMaxDamageModifier();
 	} else if (councilType == FrsManager::COUNCIL_DARK) {
-		powerModifier = attacker->getSkillMod("force_power_dark");
+		powerModifier = attacker->getSkillMod(SkillModID::FORCE_POWER_DARK);
 		minMod = data.getFrsDarkMinDamageModifier();
 		maxMod = data.getFrsDarkMaxDamageModifier();
 	}
@@ -1459,7 +1476,7 @@ int CombatManager::applyDamage(TangibleObject* attacker, WeaponObject* weapon, C
 
 	// from screenshots, it appears that food mitigation and armor mitigation were independently calculated
 	// and then added together.
-	int foodBonus = defender->getSkillMod("mitigate_damage");
+	int foodBonus = defender->getSkillMod(SkillModID::MITIGATE_DAMAGE);
 	foodBonus > 100 ? foodBonus = 100 : foodBonus;
 
 	int totalFoodMit = 0;
@@ -1791,7 +1808,7 @@ void CombatManager::applyWeaponDots(CreatureObject* attacker, CreatureObject* de
 			break;
 		case 4: // BLEED
 			type = CreatureState::BLEEDING;
-			resist = defender->getSkillMod("combat_bleeding_defense");
+			resist = defender->getSkillMod(SkillModID::COMBAT_BLEEDING_DEFENSE);
 			break;
 		default:
 			break;
@@ -1979,13 +1996,13 @@ int CombatManager::getAttackerAccuracyModifier(TangibleObject* attacker, Creatur
 	if (attackerAccuracy == 0)
 		attackerAccuracy = -15; // unskilled penalty, TODO: this might be -50 or -125, do research
 
-	attackerAccuracy += creoAttacker->getSkillMod("attack_accuracy");
+	attackerAccuracy += creoAttacker->getSkillMod(SkillModID::ATTACK_ACCURACY);
 
 	// FS skill mods
 	if (weapon->getAttackType() == SharedWeaponObjectTemplate::MELEEATTACK)
-		attackerAccuracy += creoAttacker->getSkillMod("melee_accuracy");
+		attackerAccuracy += creoAttacker->getSkillMod(SkillModID::MELEE_ACCURACY);
 	else if (weapon->getAttackType() == SharedWeaponObjectTemplate::RANGEDATTACK)
-		attackerAccuracy += creoAttacker->getSkillMod("ranged_accuracy");
+		attackerAccuracy += creoAttacker->getSkillMod(SkillModID::RANGED_ACCURACY);
 
 	return attackerAccuracy;
 }
@@ -1993,13 +2010,13 @@ int CombatManager::getAttackerAccuracyModifier(TangibleObject* attacker, Creatur
 int CombatManager::getAttackerAccuracyBonus(CreatureObject* attacker, WeaponObject* weapon) const {
 	int bonus = 0;
 
-	bonus += attacker->getSkillMod("private_attack_accuracy");
-	bonus += attacker->getSkillMod("private_accuracy_bonus");
+	bonus += attacker->getSkillMod(SkillModID::PRIVATE_ATTACK_ACCURACY);
+	bonus += attacker->getSkillMod(SkillModID::PRIVATE_ACCURACY_BONUS);
 
 	if (weapon->getAttackType() == SharedWeaponObjectTemplate::MELEEATTACK)
-		bonus += attacker->getSkillMod("private_melee_accuracy_bonus");
+		bonus += attacker->getSkillMod(SkillModID::PRIVATE_MELEE_ACCURACY_BONUS);
 	if (weapon->getAttackType() == SharedWeaponObjectTemplate::RANGEDATTACK)
-		bonus += attacker->getSkillMod("private_ranged_accuracy_bonus");
+		bonus += attacker->getSkillMod(SkillModID::PRIVATE_RANGED_ACCURACY_BONUS);
 
 	return bonus;
 }
@@ -2027,7 +2044,7 @@ int CombatManager::getDefenderDefenseModifier(CreatureObject* defender, WeaponOb
 		targetDefense = 125;
 
 	if (attacker->isPlayerCreature())
-		targetDefense += defender->getSkillMod("private_defense");
+		targetDefense += defender->getSkillMod(SkillModID::PRIVATE_DEFENSE);
 
 	// SL bonuses go on top of hardcap
 	for (int i = 0; i < defenseAccMods->size(); ++i) {
@@ -2036,8 +2053,8 @@ int CombatManager::getDefenderDefenseModifier(CreatureObject* defender, WeaponOb
 	}
 
 	// food bonus goes on top as well
-	targetDefense += defender->getSkillMod("dodge_attack");
-	targetDefense += defender->getSkillMod("private_dodge_attack");
+	targetDefense += defender->getSkillMod(SkillModID::DODGE_ATTACK);
+	targetDefense += defender->getSkillMod(SkillModID::PRIVATE_DODGE_ATTACK);
 
 	debug() << "Target defense after state affects and cap is " << targetDefense;
 
@@ -2101,7 +2118,7 @@ int CombatManager::getHitChance(TangibleObject* attacker, CreatureObject* creoDe
 			accuracySkill = creoAttacker->getSkillMod(data.getCommand()->getAccuracySkillMod());
 		}
 
-		defenseSkill = creoDefender->getSkillMod("force_defense");
+		defenseSkill = creoDefender->getSkillMod(SkillModID::FORCE_DEFENSE);
 	} else {
 		const Vector3& attackPosition = attacker->getWorldPosition();
 		const Vector3& defendPosition = creoDefender->getWorldPosition();
@@ -2119,11 +2136,11 @@ int CombatManager::getHitChance(TangibleObject* attacker, CreatureObject* creoDe
 			accuracyPosture = calculatePostureModifier(creoAttacker, weapon);
 
 			if (weapon->getAttackType() == SharedWeaponObjectTemplate::RANGEDATTACK) {
-				accuracyWeapon += creoAttacker->getSkillMod("private_aim");
+				accuracyWeapon += creoAttacker->getSkillMod(SkillModID::PRIVATE_AIM);
 			}
 
 			if (creoDefender->isCreature()) {
-				accuracyBonus += creoAttacker->getSkillMod("creature_hit_bonus");
+				accuracyBonus += creoAttacker->getSkillMod(SkillModID::CREATURE_HIT_BONUS);
 			}
 		}
 
@@ -2157,7 +2174,7 @@ int CombatManager::getHitChance(TangibleObject* attacker, CreatureObject* creoDe
 			int attackType = weapon->getAttackType();
 
 			if ((!attacker->isTurret() && attackMask != WeaponType::GRENADEWEAPON) && (attackType == SharedWeaponObjectTemplate::RANGEDATTACK || attackMask == WeaponType::HEAVYWEAPON)) {
-				evadeTotal = evadeSkill = creoDefender->getSkillMod("saber_block");
+				evadeTotal = evadeSkill = creoDefender->getSkillMod(SkillModID::SABER_BLOCK);
 
 				if (evadeTotal > 0 && System::random(100) <= evadeTotal) {
 					hitResult = HitStatus::RICOCHET;
@@ -2170,7 +2187,7 @@ int CombatManager::getHitChance(TangibleObject* attacker, CreatureObject* creoDe
 				int attackRoll = System::random(499) + 1;
 				int defendRoll = System::random(199) + 1;
 
-				evadeCenter = creoDefender->getSkillMod("private_center_of_being");
+				evadeCenter = creoDefender->getSkillMod(SkillModID::PRIVATE_CENTER_OF_BEING);
 				evadeTotal = evadeSkill + evadeCenter + defensePosture;
 
 				if (accuracyTotal + attackRoll <= evadeTotal + defendRoll) {
@@ -2270,14 +2287,14 @@ int CombatManager::getSpeedModifier(CreatureObject* attacker, WeaponObject* weap
 		}
 	}
 
-	speedMods += attacker->getSkillMod("private_speed_bonus");
+	speedMods += attacker->getSkillMod(SkillModID::PRIVATE_SPEED_BONUS);
 
 	if (weapon->getAttackType() == SharedWeaponObjectTemplate::MELEEATTACK) {
-		speedMods += attacker->getSkillMod("private_melee_speed_bonus");
-		speedMods += attacker->getSkillMod("melee_speed");
+		speedMods += attacker->getSkillMod(SkillModID::PRIVATE_MELEE_SPEED_BONUS);
+		speedMods += attacker->getSkillMod(SkillModID::MELEE_SPEED);
 	} else if (weapon->getAttackType() == SharedWeaponObjectTemplate::RANGEDATTACK) {
-		speedMods += attacker->getSkillMod("private_ranged_speed_bonus");
-		speedMods += attacker->getSkillMod("ranged_speed");
+		speedMods += attacker->getSkillMod(SkillModID::PRIVATE_RANGED_SPEED_BONUS);
+		speedMods += attacker->getSkillMod(SkillModID::RANGED_SPEED);
 	}
 
 	return speedMods;
@@ -2298,7 +2315,7 @@ float CombatManager::getDefenderToughnessModifier(CreatureObject* defender, int
 		}
 	}
 
-	int jediToughness = defender->getSkillMod("jedi_toughness");
+	int jediToughness = defender->getSkillMod(SkillModID::JEDI_TOUGHNESS);
 	if (damType != SharedWeaponObjectTemplate::LIGHTSABER && jediToughness > 0)
 		damage *= 1.f - (jediToughness / 100.f);
 
@@ -2488,7 +2505,7 @@ int CombatManager::getArmorReduction(TangibleObject* attacker, WeaponObject* wea
 		// Force Armor
 		float rawDamage = damage;
 
-		int forceArmor = defender->getSkillMod("force_armor");
+		int forceArmor = defender->getSkillMod(SkillModID::FORCE_ARMOR);
 		if (forceArmor > 0) {
 			float dmgAbsorbed = rawDamage - (damage *= 1.f - (forceArmor / 100.f));
 			defender->notifyObservers(ObserverEventType::FORCEARMOR, attacker, dmgAbsorbed);
@@ -2501,7 +2518,7 @@ int CombatManager::getArmorReduction(TangibleObject* attacker, WeaponObject* wea
 		float rawDamage = damage;
 
 		// Force Shield
-		int forceShield = defender->getSkillMod("force_shield");
+		int forceShield = defender->getSkillMod(SkillModID::FORCE_SHIELD);
 		if (forceShield > 0) {
 			jediBuffDamage = rawDamage - (damage *= 1.f - (forceShield / 100.f));
 			defender->notifyObservers(ObserverEventType::FORCESHIELD, attacker, jediBuffDamage);
@@ -2511,12 +2528,12 @@ int CombatManager::getArmorReduction(TangibleObject* attacker, WeaponObject* wea
 		}
 
 		// Force Feedback
-		int forceFeedback = defender->getSkillMod("force_feedback");
+		int forceFeedback = defender->getSkillMod(SkillModID::FORCE_FEEDBACK);
 
 		if (forceFeedback > 0 && (defender->hasBuff(BuffCRC::JEDI_FORCE_FEEDBACK_1) || defender->hasBuff(BuffCRC::JEDI_FORCE_FEEDBACK_2))) {
 			float feedbackDmg = rawDamage * (forceFeedback / 100.f);
 
-			int forceDefense = defender->getSkillMod("force_defense");
+			int forceDefense = defender->getSkillMod(SkillModID::FORCE_DEFENSE);
 
 			if (forceDefense > 0)
 				feedbackDmg *= 1.f / (1.f + ((float)forceDefense / 100.f));
@@ -2532,7 +2549,7 @@ int CombatManager::getArmorReduction(TangibleObject* attacker, WeaponObject* wea
 		}
 
 		// Force Absorb
-		if (defender->getSkillMod("force_absorb") > 0 && defender->isPlayerCreature()) {
+		if (defender->getSkillMod(SkillModID::FORCE_ABSORB) > 0 && defender->isPlayerCreature()) {
 			float absorbDam = damage * 0.4f;
 
 			defender->notifyObservers(ObserverEventType::FORCEABSORB, attacker, absorbDam);
@@ -2832,7 +2849,7 @@ float CombatManager::calculateWeaponAttackSpeed(CreatureObject* attacker, Weapon
 	}
 
 	int speedMod = getSpeedModifier(attacker, weapon);
-	float jediSpeed = attacker->getSkillMod("combat_haste") / 100.0f;
+	float jediSpeed = attacker->getSkillMod(SkillModID::COMBAT_HASTE) / 100.0f;
 
 	float attackSpeed = (1.0f - ((float)speedMod / 100.0f)) * skillSpeedRatio * weapon->getAttackSpeed();
 
@@ -3161,7 +3178,7 @@ void CombatManager::applyStates(CreatureObject* creature, CreatureObject* target
 
 		// now check combat equilibrium
 		if (!failed && (effectType == CommandEffect::KNOCKDOWN || effectType == CommandEffect::POSTUREDOWN || effectType == CommandEffect::POSTUREUP)) {
-			int combatEquil = targetCreature->getSkillMod("combat_equillibrium");
+			int combatEquil = targetCreature->getSkillMod(SkillModID::COMBAT_EQUILLIBRIUM);
 
 			if (combatEquil > 100) {
 				combatEquil = 100;
@@ -13,6 +13,7 @@
 
 #include "server/zone/objects/creature/ai/bt/Behavior.h"
 #include "server/zone/objects/creature/ai/bt/BehaviorTreeSlot.h"
+#include "server/zone/objects/creature/ai/bt/BlackboardKey.h"
 #include "templates/params/creature/ObjectFlag.h"
 #include "templates/params/creature/CreaturePosture.h"
 #include "templates/params/creature/CreatureState.h"
@@ -92,6 +93,7 @@ public:
 	AtomicInteger behaviorsWithFollowObject;
 	AtomicInteger behaviorsRetreating;
 	AtomicInteger activeRecoveryEvents;
+	AtomicInteger dormantRecoveries;
 
 	Mutex guard;
 
@@ -333,11 +335,37 @@ public:
 		return factory.create(name, id, args);
 	}
 
+	/**
+	 * Interns the blackboard key a behavior names before it is created, so
+	 * the slots are only assigned while the templates load.
+	 * @return false if the key doesn't fit in BlackboardKey::MAX_KEYS
+	 */
+	bool internBlackboardKey(const String& className, LuaObject& args) {
+		String field;
+
+		if (className == "WriteBlackboard")
+			field = "key";
+		else if (className == "EraseBlackboard")
+			field = "param";
+		else
+			return true;
+
+		String key = args.getStringField(field);
+
+		if (BlackboardKeyRegistry::instance()->intern(key) == BlackboardKey::INVALID) {
+			error() << className << " uses blackboard key " << key << " past the " << (int) BlackboardKey::MAX_KEYS << " available slots";
+			return false;
+		}
+
+		return true;
+	}
+
 	const JSONSerializationType getStatsAsJSON() const {
 		JSONSerializationType json;
 
 		json["activeBehaviorEvents"] = activeBehaviorEvents.get();
 		json["activeRecoveryEvents"] = activeRecoveryEvents.get();
+		json["dormantRecoveries"] = dormantRecoveries.get();
 		json["countExceptions"] = countExceptions.get();
 		json["behaviorsRetreating"] = behaviorsRetreating.get();
 		json["behaviorsWithFollowObject"] = behaviorsWithFollowObject.get();
@@ -623,6 +651,8 @@ private:
 		VectorMap<uint32, Behavior*> loadMap;
 		VectorMap<uint32, uint32> parentMap;
 
+		bool validKeys = true;
+
 		for (int i = 1; i <= obj.getTableSize(); ++i) {
 			lua_rawgeti(L, -1, i);
 			LuaObject behavior(L);
@@ -636,6 +666,9 @@ private:
 				//if (DEBUG_MODE)
 				//	AiMap::instance()->info("Read Behavior: " + className, true);
 
+				if (!AiMap::instance()->internBlackboardKey(className, args))
+					validKeys = false;
+
 				Behavior* b = AiMap::instance()->createBehavior(className, id, args);
 				args.pop();
 
@@ -650,6 +683,12 @@ private:
 			behavior.pop();
 		}
 
+		if (!validKeys) {
+			AiMap::instance()->error("Lua AI template " + name + " not loaded, it uses too many blackboard keys");
+			obj.pop();
+			return 0;
+		}
+
 		for (int idx = 0; idx < loadVec.size(); ++idx) {
 			Reference<Behavior*> child = loadVec.get(idx);
 			if (child == nullptr)
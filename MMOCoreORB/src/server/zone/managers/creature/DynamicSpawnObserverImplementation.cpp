@@ -205,7 +205,7 @@ void DynamicSpawnObserverImplementation::spawnInitialMobiles(SceneObject* buildi
 
 						Vector3 formationOffset(x, y, 0);
 
-						agent->writeBlackboard("formationOffset", formationOffset);
+						agent->writeBlackboard(BlackboardKey::FORMATIONOFFSET, formationOffset);
 
 						//info(true) << "Agent " << agent->getDisplayedName() << " - " << agent->getObjectID() << " following leader: " << herdLeader->getDisplayedName() << " - " << herdLeader->getObjectID() << " Offset: " << formationOffset.toString() << " Template Radius: " << templateRad;
 					}
@@ -362,7 +362,7 @@ void LairObserverImplementation::checkForHeal(TangibleObject* lair, bool forceNe
 	ManagedReference<TangibleObject*> lairRef = lair;
 
 	// Set the agent to heal the lair
-	healerAgent->writeBlackboard("healTarget", lairRef);
+	healerAgent->writeBlackboard(BlackboardKey::HEALTARGET, lairRef);
 	healerAgent->setMovementState(AiAgent::LAIR_HEALING);
 
 #ifdef DEBUG_LAIR_HEALING
@@ -760,7 +760,7 @@ void LairObserverImplementation::spawnLairMobile(LairObject* lair, int spawnNumb
 
 				Vector3 formationOffset;
 				formationOffset.setX(2.0);
-				agent->writeBlackboard("formationOffset", formationOffset);
+				agent->writeBlackboard(BlackboardKey::FORMATIONOFFSET, formationOffset);
 			}
 		}
 	}
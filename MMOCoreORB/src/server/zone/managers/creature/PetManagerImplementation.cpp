@@ -269,8 +269,8 @@ void PetManagerImplementation::handleChat(CreatureObject* speaker, AiAgent* pet,
 	}
 
 	if (command > 0) {
-		if (command == (FOLLOW || FOLLOWOTHER) && pet->peekBlackboard("formationOffset")) {
-			pet->eraseBlackboard("formationOffset");
+		if (command == (FOLLOW || FOLLOWOTHER) && pet->peekBlackboard(BlackboardKey::FORMATIONOFFSET)) {
+			pet->eraseBlackboard(BlackboardKey::FORMATIONOFFSET);
 		}
 
 		Locker plocker(pcd, speaker);
@@ -527,8 +527,8 @@ int PetManagerImplementation::notifyDestruction(TangibleObject* destructor, AiAg
 
 		destructedObject->setFollowObject(nullptr);
 
-		if (destructedObject->peekBlackboard("targetProspect"))
-			destructedObject->eraseBlackboard("targetProspect");
+		if (destructedObject->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+			destructedObject->eraseBlackboard(BlackboardKey::TARGETPROSPECT);
 
 		uint32 incapTime = calculateIncapacitationTimer(destructedObject, condition);
 
@@ -0,0 +1,260 @@
+#include "GCWBaseIndex.h"
+#include "server/zone/ZoneServer.h"
+#include "server/zone/objects/building/components/DestructibleBuildingDataComponent.h"
+#include "server/zone/objects/scene/components/DataObjectComponentReference.h"
+
+GCWBaseIndexEntry::GCWBaseIndexEntry(BuildingObject* base, int points) : Object() {
+	building = base;
+	positionX = base->getPositionX();
+	positionY = base->getPositionY();
+	factionBaseType = base->getFactionBaseType();
+	pointsValue = points;
+	dirty = true;
+}
+
+bool GCWBaseIndexEntry::hasDefensesInZone() const {
+	for (int i = 0; i < defenses.size(); ++i) {
+		ManagedReference<SceneObject*> defense = defenses.getUnsafe(i).get();
+
+		if (defense == nullptr || defense->getZone() == nullptr) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void GCWBaseIndexEntry::updateDefenses(ZoneServer* zoneServer) {
+	dirty = false;
+	defenses.removeAll();
+
+	DataObjectComponentReference* data = building->getDataObjectComponent();
+	DestructibleBuildingDataComponent* baseData = data == nullptr ? nullptr : cast<DestructibleBuildingDataComponent*>(data->get());
+
+	if (baseData == nullptr || zoneServer == nullptr) {
+		return;
+	}
+
+	Vector<uint64> defenseIDs;
+
+	for (int i = 0; i < baseData->getTotalMinefieldCount(); ++i) {
+		defenseIDs.add(baseData->getMinefieldID(i));
+	}
+
+	for (int i = 0; i < baseData->getTotalScannerCount(); ++i) {
+		defenseIDs.add(baseData->getScannerID(i));
+	}
+
+	for (int i = 0; i < baseData->getTotalTurretCount(); ++i) {
+		defenseIDs.add(baseData->getTurretID(i));
+	}
+
+	for (int i = 0; i < defenseIDs.size(); ++i) {
+		uint64 defenseID = defenseIDs.get(i);
+
+		if (defenseID == 0) {
+			continue;
+		}
+
+		ManagedReference<SceneObject*> defense = zoneServer->getObject(defenseID);
+
+		if (defense != nullptr) {
+			defenses.add(defense);
+		}
+	}
+}
+
+GCWBaseIndex::GCWBaseIndex() {
+	entries.setNoDuplicateInsertPlan();
+	entries.setNullValue(nullptr);
+
+	cells.setNoDuplicateInsertPlan();
+
+	baseTypeCounts.setNoDuplicateInsertPlan();
+	baseTypeCounts.setNullValue(0);
+}
+
+bool GCWBaseIndex::add(BuildingObject* building, int pointsValue) {
+	Locker lock(&sync);
+
+	uint64 objectID = building->getObjectID();
+
+	if (entries.contains(objectID)) {
+		return false;
+	}
+
+	Reference<GCWBaseIndexEntry*> entry = new GCWBaseIndexEntry(building, pointsValue);
+
+	entries.put(objectID, entry);
+
+	uint64 cellKey = getCellKey(getCell(entry->getPositionX()), getCell(entry->getPositionY()));
+	int index = cells.find(cellKey);
+
+	if (index == -1) {
+		Vector<Reference<GCWBaseIndexEntry*>> cell;
+		cell.add(entry);
+
+		cells.put(cellKey, cell);
+	} else {
+		cells.elementAt(index).getValue().add(entry);
+	}
+
+	int factionBaseType = entry->getFactionBaseType();
+	baseTypeCounts.put(factionBaseType, baseTypeCounts.get(factionBaseType) + 1);
+
+	// The construction of the base is over
+	dropPendingPlacement(entry->getPositionX(), entry->getPositionY());
+
+	return true;
+}
+
+bool GCWBaseIndex::drop(BuildingObject* building) {
+	Locker lock(&sync);
+
+	Reference<GCWBaseIndexEntry*> entry = entries.get(building->getObjectID());
+
+	if (entry == nullptr) {
+		return false;
+	}
+
+	entries.drop(building->getObjectID());
+
+	uint64 cellKey = getCellKey(getCell(entry->getPositionX()), getCell(entry->getPositionY()));
+	int index = cells.find(cellKey);
+
+	if (index != -1) {
+		auto& cell = cells.elementAt(index).getValue();
+
+		cell.removeElement(entry);
+
+		if (cell.size() == 0) {
+			cells.remove(index);
+		}
+	}
+
+	int factionBaseType = entry->getFactionBaseType();
+	baseTypeCounts.put(factionBaseType, baseTypeCounts.get(factionBaseType) - 1);
+
+	return true;
+}
+
+bool GCWBaseIndex::contains(BuildingObject* building) const {
+	ReadLocker lock(&sync);
+
+	return entries.contains(building->getObjectID());
+}
+
+void GCWBaseIndex::markDirty(uint64 buildingID) {
+	ReadLocker lock(&sync);
+
+	auto entry = entries.get(buildingID);
+
+	if (entry != nullptr) {
+		entry->setDirty();
+	}
+}
+
+void GCWBaseIndex::getEntries(Vector<Reference<GCWBaseIndexEntry*>>& result) const {
+	ReadLocker lock(&sync);
+
+	for (int i = 0; i < entries.size(); ++i) {
+		result.add(entries.elementAt(i).getValue());
+	}
+}
+
+int GCWBaseIndex::countNearby(float x, float y, float range, int max) const {
+	ReadLocker lock(&sync);
+
+	float sqrRange = range * range;
+	int count = 0;
+
+	int minCellX = getCell(x - range);
+	int maxCellX = getCell(x + range);
+	int minCellY = getCell(y - range);
+	int maxCellY = getCell(y + range);
+
+	for (int cellX = minCellX; cellX <= maxCellX; ++cellX) {
+		for (int cellY = minCellY; cellY <= maxCellY; ++cellY) {
+			int index = cells.find(getCellKey(cellX, cellY));
+
+			if (index == -1) {
+				continue;
+			}
+
+			const auto& cell = cells.elementAt(index).getValue();
+
+			for (int i = 0; i < cell.size(); ++i) {
+				const auto& entry = cell.getUnsafe(i);
+				float deltaX = entry->getPositionX() - x;
+				float deltaY = entry->getPositionY() - y;
+
+				if (deltaX * deltaX + deltaY * deltaY <= sqrRange && ++count >= max) {
+					return count;
+				}
+			}
+		}
+	}
+
+	uint64 now = System::getMiliTime();
+
+	for (int i = 0; i < pendingPlacements.size(); ++i) {
+		const auto& pending = pendingPlacements.get(i);
+		float deltaX = pending.positionX - x;
+		float deltaY = pending.positionY - y;
+
+		if (pending.expireTime > now && deltaX * deltaX + deltaY * deltaY <= sqrRange && ++count >= max) {
+			return count;
+		}
+	}
+
+	return count;
+}
+
+bool GCWBaseIndex::dropPendingPlacement(float x, float y) {
+	for (int i = pendingPlacements.size() - 1; i >= 0; --i) {
+		const auto& pending = pendingPlacements.get(i);
+		float deltaX = pending.positionX - x;
+		float deltaY = pending.positionY - y;
+
+		if (deltaX * deltaX + deltaY * deltaY < 1.f) {
+			pendingPlacements.remove(i);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void GCWBaseIndex::addPendingPlacement(float x, float y, uint64 constructionTime) {
+	Locker lock(&sync);
+
+	uint64 now = System::getMiliTime();
+
+	for (int i = pendingPlacements.size() - 1; i >= 0; --i) {
+		if (pendingPlacements.get(i).expireTime <= now) {
+			pendingPlacements.remove(i);
+		}
+	}
+
+	PendingPlacement pending;
+	pending.positionX = x;
+	pending.positionY = y;
+	pending.expireTime = now + constructionTime + PENDINGPLACEMENTGRACE;
+
+	pendingPlacements.add(pending);
+}
+
+void GCWBaseIndex::removePendingPlacement(float x, float y) {
+	Locker lock(&sync);
+
+	dropPendingPlacement(x, y);
+}
+
+void GCWBaseIndex::removeAll() {
+	Locker lock(&sync);
+
+	entries.removeAll();
+	cells.removeAll();
+	pendingPlacements.removeAll();
+	baseTypeCounts.removeAll();
+}
@@ -0,0 +1,167 @@
+#ifndef GCWBASEINDEX_H_
+#define GCWBASEINDEX_H_
+
+#include <atomic>
+
+#include "engine/engine.h"
+#include "server/zone/objects/building/BuildingObject.h"
+
+namespace server {
+namespace zone {
+
+class ZoneServer;
+
+}
+}
+
+using namespace server::zone;
+
+namespace server {
+namespace zone {
+namespace managers {
+namespace gcw {
+
+class GCWBaseIndexEntry : public Object {
+protected:
+	ManagedReference<BuildingObject*> building;
+	float positionX;
+	float positionY;
+	int factionBaseType;
+	int pointsValue;
+
+	// Minefields, scanners and turrets of the base as of the last verification, weak so the index doesn't keep them loaded
+	Vector<ManagedWeakReference<SceneObject*>> defenses;
+	std::atomic<bool> dirty;
+
+public:
+	GCWBaseIndexEntry(BuildingObject* base, int points);
+
+	inline BuildingObject* getBuilding() const {
+		return building;
+	}
+
+	inline float getPositionX() const {
+		return positionX;
+	}
+
+	inline float getPositionY() const {
+		return positionY;
+	}
+
+	inline int getFactionBaseType() const {
+		return factionBaseType;
+	}
+
+	inline int getPointsValue() const {
+		return pointsValue;
+	}
+
+	inline bool isDirty() const {
+		return dirty.load(std::memory_order_acquire);
+	}
+
+	inline void setDirty() {
+		dirty.store(true, std::memory_order_release);
+	}
+
+	/**
+	 * @return false if a cached defense was removed from the zone or unloaded since the last verification
+	 */
+	bool hasDefensesInZone() const;
+
+	/**
+	 * Caches the defenses the base data lists and clears the dirty flag.
+	 * pre: building is locked
+	 */
+	void updateDefenses(ZoneServer* zoneServer);
+};
+
+/**
+ * GCW bases of one zone, with a grid over their positions for placement
+ * checks. Lookups go through here instead of the zone's generic range
+ * queries and the object directory.
+ */
+class GCWBaseIndex {
+public:
+	const static int CELLSIZE = 512;
+
+	// Added to the construction time, for the construction task to register the base
+	const static int PENDINGPLACEMENTGRACE = 60000;
+
+protected:
+	struct PendingPlacement {
+		float positionX;
+		float positionY;
+		uint64 expireTime;
+	};
+
+	VectorMap<uint64, Reference<GCWBaseIndexEntry*>> entries;
+	VectorMap<uint64, Vector<Reference<GCWBaseIndexEntry*>>> cells;
+	Vector<PendingPlacement> pendingPlacements;
+	VectorMap<int, int> baseTypeCounts;
+
+	mutable ReadWriteLock sync;
+
+	static uint64 getCellKey(int cellX, int cellY) {
+		return ((uint64)(uint32)cellX << 32) | (uint32)cellY;
+	}
+
+	static int getCell(float position) {
+		return (int)floor(position / CELLSIZE);
+	}
+
+	// pre: sync is write locked
+	bool dropPendingPlacement(float x, float y);
+
+public:
+	GCWBaseIndex();
+
+	bool add(BuildingObject* building, int pointsValue);
+
+	bool drop(BuildingObject* building);
+
+	bool contains(BuildingObject* building) const;
+
+	void markDirty(uint64 buildingID);
+
+	void getEntries(Vector<Reference<GCWBaseIndexEntry*>>& result) const;
+
+	/**
+	 * Counts bases and base placements in progress in range, stopping at max.
+	 */
+	int countNearby(float x, float y, float range, int max) const;
+
+	/**
+	 * Registers a base being constructed at x, y until it is added, its placement is
+	 * removed or constructionTime plus PENDINGPLACEMENTGRACE ms pass.
+	 */
+	void addPendingPlacement(float x, float y, uint64 constructionTime);
+
+	/**
+	 * Drops the placement at x, y when its construction failed.
+	 */
+	void removePendingPlacement(float x, float y);
+
+	void removeAll();
+
+	int size() const {
+		ReadLocker lock(&sync);
+
+		return entries.size();
+	}
+
+	int getBaseCount(int factionBaseType) const {
+		ReadLocker lock(&sync);
+
+		return baseTypeCounts.get(factionBaseType);
+	}
+};
+
+}
+}
+}
+}
+
+using namespace server::zone::managers::gcw;
+
+#endif /* GCWBASEINDEX_H_ */
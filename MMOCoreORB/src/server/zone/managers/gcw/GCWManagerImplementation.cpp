@@ -32,6 +32,7 @@
 #include "server/zone/managers/gcw/tasks/UplinkTerminalResetTask.h"
 #include "server/zone/managers/gcw/GCWBaseShutdownObserver.h"
 #include "server/zone/managers/gcw/TerminalSpawn.h"
+#include "server/zone/managers/gcw/GCWBaseIndex.h"
 
 #include "server/zone/objects/player/FactionStatus.h"
 #include "server/zone/objects/player/sui/messagebox/SuiMessageBox.h"
@@ -323,7 +324,7 @@ void GCWManagerImplementation::loadLuaConfig() {
 }
 
 void GCWManagerImplementation::stop() {
-	gcwBaseList.removeAll();
+	gcwBaseIndex.removeAll();
 	gcwStartTasks.removeAll();
 	gcwEndTasks.removeAll();
 	gcwDestroyTasks.removeAll();
@@ -332,24 +333,28 @@ void GCWManagerImplementation::stop() {
 void GCWManagerImplementation::performGCWTasks() {
 	Locker locker(_this.getReferenceUnsafeStaticCast());
 
-	int totalBase = gcwBaseList.size();
+	Vector<Reference<GCWBaseIndexEntry*>> bases;
+	gcwBaseIndex.getEntries(bases);
+
+	int totalBase = bases.size();
 
 	info("Checking " + String::valueOf(totalBase) + " bases", true);
 
-	uint64 thisOid;
+	ZoneServer* zoneServer = zone->getZoneServer();
+
 	int rebelCheck = 0, rebelsScore = 0;
 	int imperialCheck = 0, imperialsScore = 0;
 	int totalPlayerBases = 0;
+	int verifiedBases = 0;
 
-	for (int i = 0; i < gcwBaseList.size(); i++) {
-		thisOid = getBase(i)->getObjectID();
+	for (int i = 0; i < bases.size(); i++) {
+		const auto& entry = bases.get(i);
+		BuildingObject* building = entry->getBuilding();
 
-		Reference<BuildingObject*> building = zone->getZoneServer()->getObject(thisOid).castTo<BuildingObject*>();
-
-		if (building == nullptr)
+		if (building == nullptr || building->getZone() == nullptr)
 			continue;
 
-		if (building->getFactionBaseType() == PLAYERFACTIONBASE) {
+		if (entry->getFactionBaseType() == PLAYERFACTIONBASE) {
 			// If PvE Bases are disallowed, schedule for destruct and do not add to count
 			if (!allowPveBases && !(building->getPvpStatusBitmask() & ObjectFlag::OVERT)) {
 				building->info(true) << " GCW PvE Base scheduled for destruction -- Base ID: " << building->getObjectID();
@@ -370,8 +375,7 @@ void GCWManagerImplementation::performGCWTasks() {
 			}
 		}
 
-		String templateString = building->getObjectTemplate()->getFullTemplateString();
-		int pointsValue = getPointValue(templateString);
+		int pointsValue = entry->getPointsValue();
 
 		if (building->getFaction() == Factions::FACTIONREBEL) {
 			rebelCheck++;
@@ -385,11 +389,22 @@ void GCWManagerImplementation::performGCWTasks() {
 				imperialsScore += pointsValue;
 		}
 
+		// Defenses of bases unchanged since the last check are still in place
+		if (!entry->isDirty() && entry->hasDefensesInZone())
+			continue;
+
 		verifyMinefields(building);
 		verifyScanners(building);
 		verifyTurrets(building);
+
+		Locker blocker(building);
+		entry->updateDefenses(zoneServer);
+
+		verifiedBases++;
 	}
 
+	debug() << "Verified defenses of " << verifiedBases << " changed bases";
+
 	setRebelBaseCount(rebelCheck);
 	setImperialBaseCount(imperialCheck);
 	setRebelScore(rebelsScore);
@@ -575,31 +590,24 @@ bool GCWManagerImplementation::hasTooManyBasesNearby(float x, float y) {
 	if (zone == nullptr)
 		return true;
 
-	SortedVector<TreeEntry* > closeEntryObjects;
-	zone->getInRangeObjects(x, 0, y, nearbyBaseDistance, &closeEntryObjects, true, false);
+	// Other bases and bases still being constructed
+	int maxCount = allowBaseComplex ? baseComplexSize : 1;
 
-	int count = 0;
-	uint32 tempStrucHash = STRING_HASHCODE("temporary_structure");
-
-	for (int i = 0; i < closeEntryObjects.size(); ++i) {
-		SceneObject* scene = cast<SceneObject*>(closeEntryObjects.get(i));
+	return gcwBaseIndex.countNearby(x, y, nearbyBaseDistance, maxCount) >= maxCount;
+}
 
-		if (scene == nullptr)
-			continue;
+void GCWManagerImplementation::addPendingBasePlacement(float x, float y) {
+	gcwBaseIndex.addPendingPlacement(x, y, basePlacementDelay * 1000ULL);
+}
 
-		// Check for other bases or structures being placed
-		if (scene->isGCWBase() || (scene->isInstallationObject() && (scene->getObjectNameStringIdName().hashCode() == tempStrucHash)))
-			count++;
+void GCWManagerImplementation::removePendingBasePlacement(float x, float y) {
+	gcwBaseIndex.removePendingPlacement(x, y);
+}
 
-		// Stop iteration if the count breaks the config options
-		if (!allowBaseComplex && count > 0) {
-			return true;
-		} else if (allowBaseComplex && count >= baseComplexSize) {
-			return true;
-		}
-	}
+void GCWManagerImplementation::addBase(BuildingObject* building) {
+	String templateString = building->getObjectTemplate()->getFullTemplateString();
 
-	return false;
+	gcwBaseIndex.add(building, getPointValue(templateString));
 }
 
 void GCWManagerImplementation::registerGCWBase(BuildingObject* building, bool initializeBase) {
@@ -648,7 +656,7 @@ void GCWManagerImplementation::registerGCWBase(BuildingObject* building, bool in
 			checkVulnerabilityData(building);
 		}
 	} else {
-		error("Building already in gcwBaseList");
+		error("Building already in gcwBaseIndex");
 	}
 }
 
@@ -752,6 +760,8 @@ void GCWManagerImplementation::addMinefield(BuildingObject* building, SceneObjec
 	}
 
 	verifyMinefields(building);
+
+	gcwBaseIndex.markDirty(building->getObjectID());
 }
 
 void GCWManagerImplementation::addScanner(BuildingObject* building, SceneObject* scanner) {
@@ -771,6 +781,8 @@ void GCWManagerImplementation::addScanner(BuildingObject* building, SceneObject*
 		baseData->addScanner(baseData->getTotalScannerCount(), 0);
 
 	verifyScanners(building);
+
+	gcwBaseIndex.markDirty(building->getObjectID());
 }
 
 void GCWManagerImplementation::addTurret(BuildingObject* building, SceneObject* turret) {
@@ -791,6 +803,8 @@ void GCWManagerImplementation::addTurret(BuildingObject* building, SceneObject*
 	}
 
 	verifyTurrets(building);
+
+	gcwBaseIndex.markDirty(building->getObjectID());
 }
 
 void GCWManagerImplementation::addBaseAlarm(BuildingObject* building, SceneObject* alarm) {
@@ -926,7 +940,7 @@ uint64 GCWManagerImplementation::spawnSecurityPatrol(BuildingObject* building, S
 			Vector3 formationOffset;
 			formationOffset.setX(xOffset);
 			formationOffset.setY(yOffset);
-			agent->writeBlackboard("formationOffset", formationOffset);
+			agent->writeBlackboard(BlackboardKey::FORMATIONOFFSET, formationOffset);
 
 			if (!stationary && squadLeader != nullptr) {
 				Locker sLocker(squadLeader, agent);
@@ -1358,24 +1372,7 @@ bool GCWManagerImplementation::isFacilityRebooting(BuildingObject* building) {
 }
 
 bool GCWManagerImplementation::isPlanetCapped() {
-	Locker locker(_this.getReferenceUnsafeStaticCast());
-
-	int totalBases = gcwBaseList.size();
-	int totalPlayerBases = 0;
-
-	for (int i = 0; i < totalBases; i++) {
-		Reference<BuildingObject*> base = getBase(i);
-
-		if (base == nullptr)
-			continue;
-
-		if (!(base->getFactionBaseType() == PLAYERFACTIONBASE))
-			continue;
-
-		totalPlayerBases++;
-	}
-
-	return maxBasesPerPlanet <= totalPlayerBases;
+	return maxBasesPerPlanet <= gcwBaseIndex.getBaseCount(PLAYERFACTIONBASE);
 }
 
 DestructibleBuildingDataComponent* GCWManagerImplementation::getDestructibleBuildingData(BuildingObject* building) {
@@ -2592,6 +2589,8 @@ void GCWManagerImplementation::notifyTurretDestruction(BuildingObject* building,
 	turret->destroyObjectFromDatabase(true);
 
 	verifyTurrets(building);
+
+	gcwBaseIndex.markDirty(building->getObjectID());
 }
 
 void GCWManagerImplementation::notifyMinefieldDestruction(BuildingObject* building, InstallationObject* minefield) {
@@ -2614,6 +2613,8 @@ void GCWManagerImplementation::notifyMinefieldDestruction(BuildingObject* buildi
 	minefield->destroyObjectFromDatabase(true);
 
 	verifyMinefields(building);
+
+	gcwBaseIndex.markDirty(building->getObjectID());
 }
 
 void GCWManagerImplementation::notifyScannerDestruction(BuildingObject* building, InstallationObject* scanner) {
@@ -2636,6 +2637,8 @@ void GCWManagerImplementation::notifyScannerDestruction(BuildingObject* building
 	scanner->destroyObjectFromDatabase(true);
 
 	verifyScanners(building);
+
+	gcwBaseIndex.markDirty(building->getObjectID());
 }
 
 void GCWManagerImplementation::sendSelectDeedToDonate(BuildingObject* building, CreatureObject* creature) {
@@ -92,7 +92,7 @@ bool SquadObserverImplementation::despawnMembersCloseToLambdaShuttle(const Vecto
 
 		member->getCooldownTimerMap()->updateToCurrentAndAddMili("reaction_chat", 60000);
 
-		member->eraseBlackboard("formationOffset");
+		member->eraseBlackboard(BlackboardKey::FORMATIONOFFSET);
 		member->setFollowObject(nullptr);
 
 		member->clearPatrolPoints();
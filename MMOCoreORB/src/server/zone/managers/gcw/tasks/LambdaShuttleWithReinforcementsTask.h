@@ -163,7 +163,7 @@ private:
 				formationOffset.setX(xOffset);
 				formationOffset.setY(spawnNumber * -1);
 
-				npc->writeBlackboard("formationOffset", formationOffset);
+				npc->writeBlackboard(BlackboardKey::FORMATIONOFFSET, formationOffset);
 			} else {
 				npc->addObjectFlag(ObjectFlag::STATIONARY);
 			}
@@ -0,0 +1,143 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "AsyncLogManager.h"
+
+#include "conf/ConfigManager.h"
+#include "server/metrics/Metrics.h"
+
+AsyncLogManager::AsyncLogManager() : Logger("AsyncLogManager") {
+	thread = nullptr;
+	stopped = false;
+
+	auto config = ConfigManager::instance();
+
+	queueSize = Math::max(config->getInt("Core3.AsyncLog.QueueSize", 65536), 2);
+	batchBytes = config->getInt("Core3.AsyncLog.BatchBytes", 256 * 1024);
+	flushIntervalMs = Math::max(config->getInt("Core3.AsyncLog.FlushIntervalMs", 20), 1);
+	syncIntervalMs = config->getInt("Core3.AsyncLog.SyncIntervalMs", 1000);
+	metricsIntervalMs = config->getInt("Core3.AsyncLog.MetricsIntervalMs", 10000);
+}
+
+Reference<AsyncLogWriter*> AsyncLogManager::getWriter(const String& fileName) {
+	Locker lock(&writersMutex);
+
+	for (int i = 0; i < writers.size(); ++i) {
+		const auto& writer = writers.get(i);
+
+		if (writer->getFileName() == fileName) {
+			return writer;
+		}
+	}
+
+	Reference<AsyncLogWriter*> writer = new AsyncLogWriter(fileName, queueSize, batchBytes);
+
+	if (stopped) {
+		writer->close();
+	}
+
+	writers.add(writer);
+
+	if (thread == nullptr && !stopped) {
+		thread = new WriterThread(this);
+		thread->start();
+	}
+
+	return writer;
+}
+
+void AsyncLogManager::run() {
+	Vector<Reference<AsyncLogWriter*>> writersCopy;
+	uint64 lastMetricsTime = System::getMiliTime();
+
+	while (!stopped.load(std::memory_order_acquire)) {
+		uint64 now = System::getMiliTime();
+		int written = 0;
+
+		writersCopy.removeAll();
+
+		writersMutex.lock();
+
+		for (int i = 0; i < writers.size(); ++i) {
+			writersCopy.add(writers.getUnsafe(i));
+		}
+
+		writersMutex.unlock();
+
+		for (int i = 0; i < writersCopy.size(); ++i) {
+			written += writersCopy.getUnsafe(i)->flush(now, syncIntervalMs);
+		}
+
+		if (metricsIntervalMs > 0 && now - lastMetricsTime >= (uint64)metricsIntervalMs) {
+			lastMetricsTime = now;
+
+			publishMetrics();
+		}
+
+		if (written == 0) {
+			Thread::sleep(flushIntervalMs);
+		}
+	}
+}
+
+void AsyncLogManager::publishMetrics() {
+	static server::metrics::Metrics metrics("core3.asynclog");
+
+	Locker lock(&writersMutex);
+
+	for (int i = 0; i < writers.size(); ++i) {
+		const auto& writer = writers.get(i);
+		auto stats = writer->getStats();
+
+		const String& fileName = writer->getFileName();
+		String name = fileName.subString(fileName.lastIndexOf("/") + 1);
+
+		if (name.endsWith(".log")) {
+			name = name.subString(0, name.length() - 4);
+		}
+
+		metrics.publishGauge(name + ".depth", String::valueOf(stats.depth));
+		metrics.publishGauge(name + ".maxDepth", String::valueOf(stats.maxDepth));
+		metrics.publishGauge(name + ".lines", String::valueOf(stats.lines));
+		metrics.publishGauge(name + ".bytes", String::valueOf(stats.bytes));
+		metrics.publishGauge(name + ".stalls", String::valueOf(stats.stalls));
+		metrics.publishGauge(name + ".stallMs", String::valueOf(stats.stallMs));
+	}
+}
+
+void AsyncLogManager::stop() {
+	if (stopped.exchange(true)) {
+		return;
+	}
+
+	if (thread != nullptr) {
+		thread->join();
+
+		delete thread;
+		thread = nullptr;
+	}
+
+	writersMutex.lock();
+
+	for (int i = 0; i < writers.size(); ++i) {
+		writers.get(i)->close();
+	}
+
+	writersMutex.unlock();
+
+	logStats();
+}
+
+void AsyncLogManager::logStats() {
+	Locker lock(&writersMutex);
+
+	for (int i = 0; i < writers.size(); ++i) {
+		const auto& writer = writers.get(i);
+		auto stats = writer->getStats();
+
+		info(true) << writer->getFileName() << ": " << stats.lines << " lines, " << stats.bytes << " bytes in "
+			<< stats.batches << " writes, " << stats.syncs << " syncs, " << stats.rotations << " rotations, max queue depth "
+			<< stats.maxDepth << ", " << stats.stalls << " stalls for " << stats.stallMs << "ms";
+	}
+}
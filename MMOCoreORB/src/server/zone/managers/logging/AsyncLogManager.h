@@ -0,0 +1,64 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef ASYNCLOGMANAGER_H_
+#define ASYNCLOGMANAGER_H_
+
+#include <atomic>
+
+#include "engine/engine.h"
+#include "server/zone/managers/logging/AsyncLogWriter.h"
+
+/**
+ * Owns the async log writers and the thread draining them, so file I/O of the
+ * structured logs stays off the game worker threads.
+ */
+class AsyncLogManager : public Singleton<AsyncLogManager>, public Logger, public Object {
+	class WriterThread : public Thread {
+		AsyncLogManager* manager;
+
+	public:
+		WriterThread(AsyncLogManager* logManager) {
+			manager = logManager;
+		}
+
+		void run() {
+			manager->run();
+		}
+	};
+
+	Vector<Reference<AsyncLogWriter*>> writers;
+	Mutex writersMutex;
+
+	WriterThread* thread;
+	std::atomic<bool> stopped;
+
+	int queueSize;
+	int batchBytes;
+	int flushIntervalMs;
+	int syncIntervalMs;
+	int metricsIntervalMs;
+
+	void run();
+
+	void publishMetrics();
+
+public:
+	AsyncLogManager();
+
+	/**
+	 * Writer of fileName, created and started on first use.
+	 */
+	Reference<AsyncLogWriter*> getWriter(const String& fileName);
+
+	/**
+	 * Writes out everything queued and stops the writer thread. Lines written
+	 * after this go straight to the files from the calling thread.
+	 */
+	void stop();
+
+	void logStats();
+};
+
+#endif /* ASYNCLOGMANAGER_H_ */
@@ -0,0 +1,326 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "AsyncLogWriter.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <cerrno>
+#include <cstring>
+#include <cstdio>
+
+AsyncLogWriter::AsyncLogWriter(const String& name, int queueSize, int batchBytes) : Logger("AsyncLogWriter"), fileName(name) {
+	uint64 capacity = 2;
+
+	while (capacity < (uint64)queueSize) {
+		capacity <<= 1;
+	}
+
+	slots = new Slot[capacity];
+	mask = capacity - 1;
+
+	for (uint64 i = 0; i < capacity; ++i) {
+		slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	enqueuePos = 0;
+	dequeuePos = 0;
+	closed = false;
+
+	fd = -1;
+	fileSize = 0;
+	fileLines = 0;
+	fileOpenTime = System::getMiliTime();
+	lastSyncTime = fileOpenTime;
+	dirty = false;
+
+	rotateBytes = 0;
+	rotateLines = 0;
+	rotateMs = 0;
+
+	batchCapacity = Math::max(batchBytes, 4096);
+	batchBuffer = new char[batchCapacity];
+	batchSize = 0;
+
+	lines = 0;
+	bytes = 0;
+	batches = 0;
+	syncs = 0;
+	rotations = 0;
+	stalls = 0;
+	stallMs = 0;
+	maxDepth = 0;
+
+	openFile();
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+	close();
+	closeFile();
+
+	delete [] slots;
+	delete [] batchBuffer;
+}
+
+bool AsyncLogWriter::tryEnqueue(const String& line) {
+	uint64 pos = enqueuePos.load(std::memory_order_relaxed);
+	Slot* slot = nullptr;
+
+	for (;;) {
+		slot = &slots[pos & mask];
+
+		int64 diff = (int64)slot->sequence.load(std::memory_order_acquire) - (int64)pos;
+
+		if (diff == 0) {
+			if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			return false;
+		} else {
+			pos = enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	slot->line = line;
+	slot->sequence.store(pos + 1, std::memory_order_release);
+
+	return true;
+}
+
+void AsyncLogWriter::write(const String& line) {
+	if (!tryEnqueue(line)) {
+		uint64 start = System::getMiliTime();
+
+		stalls.fetch_add(1, std::memory_order_relaxed);
+
+		do {
+			if (drainMutex.tryLock()) {
+				drain();
+				drainMutex.unlock();
+			} else {
+				Thread::sleep(1);
+			}
+		} while (!tryEnqueue(line));
+
+		stallMs.fetch_add(System::getMiliTime() - start, std::memory_order_relaxed);
+	}
+
+	if (closed.load(std::memory_order_acquire)) {
+		Locker lock(&drainMutex);
+
+		drain();
+	}
+}
+
+bool AsyncLogWriter::dequeueToBatch() {
+	uint64 pos = dequeuePos.load(std::memory_order_relaxed);
+	Slot& slot = slots[pos & mask];
+
+	if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+		return false;
+	}
+
+	int length = slot.line.length();
+
+	if (batchSize + length + 1 > batchCapacity) {
+		writeBatch();
+	}
+
+	if (length + 1 > batchCapacity) {
+		writeToFile(slot.line.toCharArray(), length);
+		writeToFile("\n", 1);
+	} else {
+		memcpy(batchBuffer + batchSize, slot.line.toCharArray(), length);
+		batchSize += length;
+		batchBuffer[batchSize++] = '\n';
+	}
+
+	slot.line = "";
+	slot.sequence.store(pos + mask + 1, std::memory_order_release);
+	dequeuePos.store(pos + 1, std::memory_order_relaxed);
+
+	++fileLines;
+	lines.fetch_add(1, std::memory_order_relaxed);
+
+	return true;
+}
+
+int AsyncLogWriter::drain() {
+	int count = 0;
+
+	uint64 maxLines = rotateLines.load(std::memory_order_relaxed);
+	uint64 maxBytes = rotateBytes.load(std::memory_order_relaxed);
+
+	while (dequeueToBatch()) {
+		++count;
+
+		if ((maxLines > 0 && fileLines >= maxLines) || (maxBytes > 0 && fileSize + batchSize >= maxBytes)) {
+			writeBatch();
+			rotateFile();
+		}
+	}
+
+	writeBatch();
+
+	return count;
+}
+
+void AsyncLogWriter::writeBatch() {
+	if (batchSize == 0) {
+		return;
+	}
+
+	writeToFile(batchBuffer, batchSize);
+	batchSize = 0;
+
+	batches.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AsyncLogWriter::writeToFile(const char* data, int length) {
+	if (fd < 0 && !openFile()) {
+		return;
+	}
+
+	int offset = 0;
+
+	while (offset < length) {
+		ssize_t written = ::write(fd, data + offset, length - offset);
+
+		if (written < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			error() << "Failed to write " << (length - offset) << " bytes to " << fileName << ": " << strerror(errno);
+			break;
+		}
+
+		offset += written;
+	}
+
+	fileSize += offset;
+	bytes.fetch_add(offset, std::memory_order_relaxed);
+	dirty = true;
+}
+
+bool AsyncLogWriter::openFile() {
+	fd = ::open(fileName.toCharArray(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+
+	if (fd < 0) {
+		error() << "Failed to open " << fileName << ": " << strerror(errno);
+		return false;
+	}
+
+	struct stat fileStat;
+
+	fileSize = fstat(fd, &fileStat) == 0 ? fileStat.st_size : 0;
+	fileLines = 0;
+	fileOpenTime = System::getMiliTime();
+
+	return true;
+}
+
+void AsyncLogWriter::closeFile() {
+	if (fd < 0) {
+		return;
+	}
+
+	::close(fd);
+	fd = -1;
+}
+
+void AsyncLogWriter::syncFile(uint64 now) {
+	lastSyncTime = now;
+
+	if (fd < 0 || !dirty) {
+		return;
+	}
+
+	::fsync(fd);
+	dirty = false;
+
+	syncs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AsyncLogWriter::rotateFile() {
+	syncFile(System::getMiliTime());
+	closeFile();
+
+	String baseName = fileName.endsWith(".log") ? fileName.subString(0, fileName.length() - 4) : fileName;
+
+	StringBuffer archiveFileName;
+	archiveFileName << baseName << "-" << System::getMiliTime() << ".log";
+
+	// If the rename failed its ok because the file is opened with append below
+	int err = std::rename(fileName.toCharArray(), archiveFileName.toString().toCharArray());
+
+	if (err != 0) {
+		error() << "Failed to archive " << fileName << " to " << archiveFileName.toString() << " err = " << err;
+	}
+
+	openFile();
+
+	rotations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AsyncLogWriter::rotateNow() {
+	Locker lock(&drainMutex);
+
+	drain();
+
+	if (fileSize > 0) {
+		rotateFile();
+	}
+}
+
+int AsyncLogWriter::flush(uint64 now, int syncIntervalMs) {
+	Locker lock(&drainMutex);
+
+	uint64 depth = enqueuePos.load(std::memory_order_relaxed) - dequeuePos.load(std::memory_order_relaxed);
+
+	if (depth > maxDepth.load(std::memory_order_relaxed)) {
+		maxDepth.store(depth, std::memory_order_relaxed);
+	}
+
+	int count = drain();
+
+	uint64 maxAgeMs = rotateMs.load(std::memory_order_relaxed);
+
+	if (maxAgeMs > 0 && fileSize > 0 && now - fileOpenTime >= maxAgeMs) {
+		rotateFile();
+	}
+
+	if (now - lastSyncTime >= (uint64)syncIntervalMs) {
+		syncFile(now);
+	}
+
+	return count;
+}
+
+void AsyncLogWriter::close() {
+	closed.store(true, std::memory_order_release);
+
+	Locker lock(&drainMutex);
+
+	drain();
+	syncFile(System::getMiliTime());
+}
+
+AsyncLogWriter::Stats AsyncLogWriter::getStats() const {
+	Stats stats;
+
+	stats.lines = lines.load(std::memory_order_relaxed);
+	stats.bytes = bytes.load(std::memory_order_relaxed);
+	stats.batches = batches.load(std::memory_order_relaxed);
+	stats.syncs = syncs.load(std::memory_order_relaxed);
+	stats.rotations = rotations.load(std::memory_order_relaxed);
+	stats.stalls = stalls.load(std::memory_order_relaxed);
+	stats.stallMs = stallMs.load(std::memory_order_relaxed);
+	stats.depth = enqueuePos.load(std::memory_order_relaxed) - dequeuePos.load(std::memory_order_relaxed);
+	stats.maxDepth = maxDepth.load(std::memory_order_relaxed);
+
+	return stats;
+}
@@ -0,0 +1,145 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef ASYNCLOGWRITER_H_
+#define ASYNCLOGWRITER_H_
+
+#include <atomic>
+
+#include "engine/engine.h"
+
+/**
+ * Append only log file fed through a bounded lock free queue. Any thread may
+ * write lines, the log manager thread drains them in batches into large file
+ * writes, syncs the file on an interval and rotates it by size, line count or
+ * age.
+ */
+class AsyncLogWriter : public Object, public Logger {
+public:
+	struct Stats {
+		uint64 lines;
+		uint64 bytes;
+		uint64 batches;
+		uint64 syncs;
+		uint64 rotations;
+		uint64 stalls;
+		uint64 stallMs;
+		uint64 depth;
+		uint64 maxDepth;
+	};
+
+private:
+	struct Slot {
+		std::atomic<uint64> sequence;
+		String line;
+	};
+
+	Slot* slots;
+	uint64 mask;
+
+	// Producers and the consumer on separate cache lines
+	std::atomic<uint64> enqueuePos;
+	char padding[64 - sizeof(std::atomic<uint64>)];
+	std::atomic<uint64> dequeuePos;
+
+	// Held by whoever drains the queue, the manager thread or a producer finding it full
+	Mutex drainMutex;
+	std::atomic<bool> closed;
+
+	String fileName;
+	int fd;
+	uint64 fileSize;
+	uint64 fileLines;
+	uint64 fileOpenTime;
+	uint64 lastSyncTime;
+	bool dirty;
+
+	// Set from any thread while the manager thread drains
+	std::atomic<uint64> rotateBytes;
+	std::atomic<uint64> rotateLines;
+	std::atomic<uint64> rotateMs;
+
+	char* batchBuffer;
+	int batchSize;
+	int batchCapacity;
+
+	std::atomic<uint64> lines;
+	std::atomic<uint64> bytes;
+	std::atomic<uint64> batches;
+	std::atomic<uint64> syncs;
+	std::atomic<uint64> rotations;
+	std::atomic<uint64> stalls;
+	std::atomic<uint64> stallMs;
+	std::atomic<uint64> maxDepth;
+
+	bool tryEnqueue(const String& line);
+
+	bool dequeueToBatch();
+
+	int drain();
+
+	void writeBatch();
+
+	void writeToFile(const char* data, int length);
+
+	bool openFile();
+
+	void closeFile();
+
+	void syncFile(uint64 now);
+
+	void rotateFile();
+
+public:
+	/**
+	 * @param queueSize rounded up to a power of two
+	 * @param batchBytes size of the writes the queue is drained in
+	 */
+	AsyncLogWriter(const String& fileName, int queueSize, int batchBytes);
+
+	~AsyncLogWriter();
+
+	/**
+	 * Queues one line, the new line is appended by the writer. Waits for the
+	 * manager thread, or drains the queue itself, while the queue is full.
+	 */
+	void write(const String& line);
+
+	/**
+	 * Drains the queue, syncs when syncIntervalMs elapsed since the last sync
+	 * and rotates the file if due. Only called by the log manager.
+	 * @return lines written
+	 */
+	int flush(uint64 now, int syncIntervalMs);
+
+	/**
+	 * Flushes and syncs what is queued, later writes are done on the calling thread.
+	 */
+	void close();
+
+	void setRotateSizeMB(int megabytes) {
+		rotateBytes.store(megabytes > 0 ? (uint64)megabytes * 1024 * 1024 : 0, std::memory_order_relaxed);
+	}
+
+	void setRotateLines(int count) {
+		rotateLines.store(count > 0 ? count : 0, std::memory_order_relaxed);
+	}
+
+	void setRotateSeconds(int seconds) {
+		rotateMs.store(seconds > 0 ? (uint64)seconds * 1000 : 0, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Archives the current file if it is not empty, used for rotate at start.
+	 */
+	void rotateNow();
+
+	const String& getFileName() const {
+		return fileName;
+	}
+
+	Stats getStats() const;
+};
+
+#endif /* ASYNCLOGWRITER_H_ */
@@ -287,7 +287,7 @@ void DestroyMissionLairObserverImplementation::spawnLairMobile(LairObject* lair,
 
 				Vector3 formationOffset;
 				formationOffset.setX(2.0);
-				agent->writeBlackboard("formationOffset", formationOffset);
+				agent->writeBlackboard(BlackboardKey::FORMATIONOFFSET, formationOffset);
 			}
 		}
 	}
@@ -80,6 +80,7 @@ ObjectManager::ObjectManager(bool initializeTemplates) : DOBObjectManager() {
 	if (initializeTemplates) {
 		templateManager = TemplateManager::instance();
 		templateManager->loadLuaTemplates();
+		templateManager->preloadAppearances();
 	}
 }
 
@@ -1316,33 +1316,40 @@ bool PlanetManagerImplementation::isSpawningPermittedAt(float x, float y, float
 	if (!zone->isWithinBoundaries(targetPos))
 		return false;
 
-	zone->getInRangeActiveAreas(x, 0, y, &activeAreas, true);
+	// Most of the planet is not under any area that could deny the spawn
+	if (spawnPermissionMask == nullptr || spawnPermissionMask->hasBlockingAreas(x, y, worldSpawnArea)) {
+		zone->getInRangeActiveAreas(x, 0, y, &activeAreas, true);
 
-	for (int i = 0; i < activeAreas.size(); ++i) {
-		ActiveArea* area = activeAreas.get(i);
+		for (int i = 0; i < activeAreas.size(); ++i) {
+			ActiveArea* area = activeAreas.get(i);
 
-		if (area == nullptr)
-			continue;
+			if (area == nullptr)
+				continue;
 
-		if (area->isCityRegion() || area->isNoSpawnArea()) {
-			return false;
-		}
+			if (area->isCityRegion() || area->isNoSpawnArea()) {
+				return false;
+			}
 
-		if (area->isRegion()) {
-			Region* region = cast<Region*>(area);
+			if (area->isRegion()) {
+				Region* region = cast<Region*>(area);
 
-			if (region != nullptr && region->isPlayerCity())
+				if (region != nullptr && region->isPlayerCity())
+					return false;
+			}
+
+			if (worldSpawnArea && area->isNoWorldSpawnArea())
 				return false;
 		}
-
-		if (worldSpawnArea && area->isNoWorldSpawnArea())
-			return false;
 	}
 
 	if (isInObjectsNoBuildZone(x, y, margin)) {
 		return false;
 	}
 
+	if (isClearSpawnTerrain(x, y)) {
+		return true;
+	}
+
 	if (isInWater(x, y)) {
 		return false;
 	}
@@ -1353,6 +1360,47 @@ bool PlanetManagerImplementation::isSpawningPermittedAt(float x, float y, float
 	return true;
 }
 
+bool PlanetManagerImplementation::isClearSpawnTerrain(float x, float y) {
+	if (spawnPermissionMask == nullptr || terrainManager == nullptr)
+		return false;
+
+	float cellX, cellY;
+	spawnPermissionMask->getCellOrigin(x, y, cellX, cellY);
+
+	// The slope check samples the heights up to 10m around a position
+	float minX = cellX - 11, minY = cellY - 11;
+	float maxX = cellX + SpawnPermissionMask::CELL_SIZE + 11, maxY = cellY + SpawnPermissionMask::CELL_SIZE + 11;
+
+	if (minX <= terrainManager->getMin() || minY <= terrainManager->getMin() || maxX >= terrainManager->getMax() || maxY >= terrainManager->getMax())
+		return false;
+
+	// Only the base terrain is cached, modifications are checked position by position
+	if (terrainManager->isModifiedArea(minX, minY, maxX, maxY))
+		return false;
+
+	SpawnPermissionMask::TerrainState state = spawnPermissionMask->getTerrainState(x, y);
+
+	if (state != SpawnPermissionMask::TERRAIN_UNKNOWN)
+		return state == SpawnPermissionMask::TERRAIN_CLEAR;
+
+	bool clear = !terrainManager->hasWaterBoundaries(cellX, cellY, cellX + SpawnPermissionMask::CELL_SIZE, cellY + SpawnPermissionMask::CELL_SIZE);
+
+	if (clear) {
+		float lowest = terrainManager->getLowestHeight(minX, minY, maxX, maxY);
+
+		clear = terrainManager->getHighestHeight(minX, minY, maxX, maxY) - lowest <= 15.0;
+
+		float waterHeight;
+
+		if (clear && terrainManager->getGlobalWaterHeight(waterHeight))
+			clear = lowest > waterHeight + 1.f;
+	}
+
+	spawnPermissionMask->setTerrainState(x, y, clear ? SpawnPermissionMask::TERRAIN_CLEAR : SpawnPermissionMask::TERRAIN_CHECK);
+
+	return clear;
+}
+
 bool PlanetManagerImplementation::isBuildingPermittedAt(float x, float y, SceneObject* object, float margin, bool checkFootprint) {
 	SortedVector<ActiveArea*> activeAreas;
 
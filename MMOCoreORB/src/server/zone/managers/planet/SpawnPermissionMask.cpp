@@ -0,0 +1,116 @@
+/*
+ * SpawnPermissionMask.cpp
+ */
+
+#include "SpawnPermissionMask.h"
+
+#include "server/zone/objects/area/ActiveArea.h"
+#include "server/zone/objects/region/Region.h"
+
+SpawnPermissionMask::SpawnPermissionMask(float min, float max) : min(min) {
+	cellsPerSide = Math::max(1, (int) ceil((max - min) / CELL_SIZE));
+
+	int totalCells = cellsPerSide * cellsPerSide;
+
+	cells = new Cell[totalCells];
+
+	for (int i = 0; i < totalCells; ++i) {
+		cells[i].blockers.store(0, std::memory_order_relaxed);
+		cells[i].worldBlockers.store(0, std::memory_order_relaxed);
+		cells[i].terrain.store(TERRAIN_UNKNOWN, std::memory_order_relaxed);
+	}
+
+	areas.setNoDuplicateInsertPlan();
+}
+
+SpawnPermissionMask::~SpawnPermissionMask() {
+	delete [] cells;
+}
+
+void SpawnPermissionMask::updateArea(ActiveArea* area) {
+	if (area == nullptr)
+		return;
+
+	bool blocker = area->isCityRegion() || area->isNoSpawnArea();
+
+	if (!blocker && area->isRegion()) {
+		Region* region = cast<Region*>(area);
+
+		blocker = region != nullptr && region->isPlayerCity();
+	}
+
+	bool worldBlocker = area->isNoWorldSpawnArea();
+
+	AreaCells areaCells = {0, 0, 0, 0, false};
+
+	if (blocker || worldBlocker) {
+		float minX, minY, maxX, maxY;
+
+		if (area->isRectangularAreaShape()) {
+			Vector4 bounds = area->getRectangularDimensions();
+
+			minX = bounds[0];
+			minY = bounds[1];
+			maxX = bounds[2];
+			maxY = bounds[3];
+		} else {
+			Vector3 center = area->getAreaCenter();
+			float radius = area->getRadius();
+
+			minX = center.getX() - radius;
+			minY = center.getY() - radius;
+			maxX = center.getX() + radius;
+			maxY = center.getY() + radius;
+		}
+
+		areaCells.firstX = getCellCoordinate(minX);
+		areaCells.firstY = getCellCoordinate(minY);
+		areaCells.lastX = getCellCoordinate(maxX);
+		areaCells.lastY = getCellCoordinate(maxY);
+		areaCells.worldOnly = !blocker;
+	}
+
+	uint64 objectID = area->getObjectID();
+
+	Locker locker(&mutex);
+
+	int index = areas.find(objectID);
+
+	if (index != -1) {
+		countArea(areas.elementAt(index).getValue(), -1);
+		areas.remove(index);
+	}
+
+	if (blocker || worldBlocker) {
+		countArea(areaCells, 1);
+		areas.put(objectID, areaCells);
+	}
+}
+
+void SpawnPermissionMask::removeArea(ActiveArea* area) {
+	if (area == nullptr)
+		return;
+
+	Locker locker(&mutex);
+
+	int index = areas.find(area->getObjectID());
+
+	if (index == -1)
+		return;
+
+	countArea(areas.elementAt(index).getValue(), -1);
+	areas.remove(index);
+}
+
+void SpawnPermissionMask::countArea(const AreaCells& area, int delta) {
+	for (int y = area.firstY; y <= area.lastY; ++y) {
+		for (int x = area.firstX; x <= area.lastX; ++x) {
+			Cell& cell = cells[y * cellsPerSide + x];
+
+			if (area.worldOnly)
+				cell.worldBlockers.fetch_add(delta, std::memory_order_release);
+			else
+				cell.blockers.fetch_add(delta, std::memory_order_release);
+		}
+	}
+}
@@ -0,0 +1,112 @@
+/*
+ * SpawnPermissionMask.h
+ */
+
+#ifndef SPAWNPERMISSIONMASK_H_
+#define SPAWNPERMISSIONMASK_H_
+
+#include <atomic>
+
+#include "engine/engine.h"
+
+namespace server {
+ namespace zone {
+  namespace objects {
+   namespace area {
+    class ActiveArea;
+   }
+  }
+ }
+}
+
+using namespace server::zone::objects::area;
+
+/**
+ * Coarse grid over a planet telling isSpawningPermittedAt which of its checks a
+ * position can skip. Every cell counts the areas blocking spawns whose bounds
+ * overlap it, kept up to date as areas enter and leave the zone or change their
+ * flags, and caches whether its base terrain is dry and flat enough for any
+ * position inside it.
+ */
+class SpawnPermissionMask : public Object {
+public:
+	static const int CELL_SIZE = 32;
+
+	enum TerrainState : byte { TERRAIN_UNKNOWN = 0, TERRAIN_CLEAR, TERRAIN_CHECK };
+
+private:
+	struct Cell {
+		// Cities, player cities and no spawn areas
+		std::atomic<uint16> blockers;
+		// Areas only blocking world spawns
+		std::atomic<uint16> worldBlockers;
+		std::atomic<byte> terrain;
+	};
+
+	struct AreaCells {
+		int firstX, firstY, lastX, lastY;
+		bool worldOnly;
+	};
+
+	Cell* cells;
+
+	float min;
+	int cellsPerSide;
+
+	VectorMap<uint64, AreaCells> areas;
+	Mutex mutex;
+
+	void countArea(const AreaCells& area, int delta);
+
+	inline int getCellCoordinate(float value) const {
+		return Math::clamp(0, (int) floor((value - min) / CELL_SIZE), cellsPerSide - 1);
+	}
+
+	inline const Cell& getCell(float x, float y) const {
+		return cells[getCellCoordinate(y) * cellsPerSide + getCellCoordinate(x)];
+	}
+
+	inline Cell& getCell(float x, float y) {
+		return cells[getCellCoordinate(y) * cellsPerSide + getCellCoordinate(x)];
+	}
+
+public:
+	SpawnPermissionMask(float min, float max);
+	~SpawnPermissionMask();
+
+	/**
+	 * Counts the area in the cells it overlaps if its flags block spawns, replacing
+	 * the cells it was counted in before. Called when it enters the zone or its flags change.
+	 */
+	void updateArea(ActiveArea* area);
+
+	void removeArea(ActiveArea* area);
+
+	/**
+	 * @return false when no area that could deny a spawn at the position overlaps its cell
+	 */
+	inline bool hasBlockingAreas(float x, float y, bool worldSpawnArea) const {
+		const Cell& cell = getCell(x, y);
+
+		return cell.blockers.load(std::memory_order_acquire) != 0
+				|| (worldSpawnArea && cell.worldBlockers.load(std::memory_order_acquire) != 0);
+	}
+
+	inline TerrainState getTerrainState(float x, float y) const {
+		return (TerrainState) getCell(x, y).terrain.load(std::memory_order_relaxed);
+	}
+
+	inline void setTerrainState(float x, float y, TerrainState state) {
+		getCell(x, y).terrain.store(state, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Lower corner of the cell holding the position.
+	 */
+	inline void getCellOrigin(float x, float y, float& originX, float& originY) const {
+		originX = min + getCellCoordinate(x) * CELL_SIZE;
+		originY = min + getCellCoordinate(y) * CELL_SIZE;
+	}
+};
+
+#endif /* SPAWNPERMISSIONMASK_H_ */
@@ -124,14 +124,16 @@
 #include "server/zone/packets/object/transform/Transform.h"
 
 #include "server/zone/managers/statistics/StatisticsManager.h"
+#include "server/zone/managers/logging/AsyncLogManager.h"
 
 // #define DEBUG_SPEED_HACK
 
 PlayerManagerImplementation::PlayerManagerImplementation(ZoneServer* zoneServer, ZoneProcessServer* impl, bool trackOnlineUsers) : Logger("PlayerManager") {
-	playerLoggerFilename = "log/player.log";
-	playerLoggerLines = ConfigManager::instance()->getMaxLogLines();
 	playerLogger.setLoggingName("PlayerLogger");
-	playerLogger.setFileLogger(playerLoggerFilename, true);
+
+	playerLogWriter = AsyncLogManager::instance()->getWriter("log/player.log");
+	playerLogWriter->setRotateLines(ConfigManager::instance()->getMaxLogLines());
+	playerLogWriter->setRotateSeconds(ConfigManager::instance()->getInt("Core3.PlayerLog.RotateLogSeconds", 0));
 
 	server = zoneServer;
 	processor = impl;
@@ -483,34 +485,7 @@ void PlayerManagerImplementation::loadNameMap() {
 }
 
 void PlayerManagerImplementation::writePlayerLogEntry(JSONSerializationType& logEntry) {
-	FileWriter* logFile = playerLogger.getFileLogger();
-	StringBuffer logLine;
-
-	logLine << logEntry.dump().c_str() << "\n";
-
-	Locker lock(&playerLoggerMutex);
-
-	(*logFile) << logLine;
-
-	logFile->flush();
-
-	// Check for log rotation
-	if (--playerLoggerLines <= 0) {
-		playerLoggerLines = ConfigManager::instance()->getMaxLogLines();
-
-		Time now;
-		StringBuffer archiveFilename;
-		archiveFilename << "log/player-" << now.getMiliTime() << ".log";
-
-		// If the rename failed its ok because we open with append below
-		int err = std::rename(playerLoggerFilename.toCharArray(), archiveFilename.toString().toCharArray());
-
-		// report failure if any
-		if (err != 0)
-			error() << "Failed to archive player log to " << archiveFilename.toString() << " err = " << err;
-
-		playerLogger.setFileLogger(playerLoggerFilename, true);
-	}
+	playerLogWriter->write(logEntry.dump().c_str());
 }
 
 JSONSerializationType PlayerManagerImplementation::basePlayerLogEntry(CreatureObject* creature, PlayerObject* ghost) {
@@ -5150,8 +5125,7 @@ void PlayerManagerImplementation::fixBuffSkillMods(CreatureObject* player) {
 
 		Locker smodsGuard(player->getSkillModMutex());
 
-		SkillModGroup* smodGroup = player->getSkillModList()->getSkillModGroup(SkillModManager::BUFF);
-		smodGroup->removeAll();
+		player->getSkillModList()->clearSkillModGroup(SkillModManager::BUFF);
 
 		smodsGuard.release();
 
@@ -1,7 +1,43 @@
 #include "server/zone/objects/creature/CreatureObject.h"
 #include "PlayerMap.h"
 
+PlayerMapSnapshot::PlayerMapSnapshot(int initsize) : players(initsize > 0 ? initsize : 1, 1) {
+}
+
+void PlayerMapSnapshot::add(CreatureObject* player) {
+	players.add(player);
+}
+
+CreatureObject* PlayerMapSnapshot::get(int index) const {
+	return players.get(index).get();
+}
+
+int PlayerMapSnapshot::size() const {
+	return players.size();
+}
+
 PlayerMap::PlayerMap(int initsize) : Mutex("PlayerMap"), players(initsize), iter(&players) {
+	snapshot = new PlayerMapSnapshot(0);
+}
+
+void PlayerMap::updateSnapshot() {
+	Reference<PlayerMapSnapshot*> newSnapshot = new PlayerMapSnapshot(players.size());
+
+	HashTableIterator<String, Reference<CreatureObject*> > playerIterator(&players);
+
+	while (playerIterator.hasNext()) {
+		newSnapshot->add(playerIterator.getNextValue());
+	}
+
+	Locker locker(&snapshotLock);
+
+	snapshot = newSnapshot;
+}
+
+Reference<PlayerMapSnapshot*> PlayerMap::getSnapshot() {
+	ReadLocker locker(&snapshotLock);
+
+	return snapshot;
 }
 
 void PlayerMap::put(const String& name, CreatureObject* player, bool doLock) {
@@ -9,6 +45,8 @@ void PlayerMap::put(const String& name, CreatureObject* player, bool doLock) {
 
 	try {
 		players.put(name.toLowerCase(), player);
+
+		updateSnapshot();
 	}
 	catch (Exception & e) {
 		System::out << e.getMessage();
@@ -57,6 +95,8 @@ CreatureObject* PlayerMap::remove(const String& name, bool doLock) {
 
 		player = players.remove(name.toLowerCase());
 
+		updateSnapshot();
+
 	}
 	catch (Exception & e) {
 		System::out << e.getMessage();
@@ -19,13 +19,41 @@ namespace player {
 
 using namespace server::zone::objects::creature;
 
+/**
+ * Copy of the players of a PlayerMap, replaced as a whole on every change so
+ * broadcasts can walk it without holding the lock of the map owner.
+ */
+class PlayerMapSnapshot : public Object {
+	Vector<Reference<CreatureObject*> > players;
+
+public:
+	PlayerMapSnapshot(int initsize);
+
+	void add(CreatureObject* player);
+
+	CreatureObject* get(int index) const;
+
+	int size() const;
+};
+
 class PlayerMap : public Mutex, public Object {
 	HashTable<String, Reference<CreatureObject*> > players;
 	HashTableIterator<String, Reference<CreatureObject*> > iter;
 
+	ReadWriteLock snapshotLock;
+	Reference<PlayerMapSnapshot*> snapshot;
+
+	// Called with the map locked after players changed
+	void updateSnapshot();
+
 public:
 	PlayerMap(int initsize);
 
+	/**
+	 * Players of the map as of the last put or remove, safe to read from any thread.
+	 */
+	Reference<PlayerMapSnapshot*> getSnapshot();
+
 	void put(const String& name, CreatureObject* player, bool doLock = true);
 
 	CreatureObject* get(const String& name, bool doLock = true);
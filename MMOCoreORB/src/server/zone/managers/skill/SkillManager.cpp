@@ -5,6 +5,7 @@
 
 #include "SkillManager.h"
 #include "SkillModManager.h"
+#include "SkillModRegistry.h"
 #include "PerformanceManager.h"
 #include "server/zone/objects/creature/variables/Skill.h"
 #include "server/zone/objects/creature/CreatureObject.h"
@@ -102,6 +103,8 @@ void SkillManager::loadClientData() {
 			fatal("overwriting skill name");
 		}
 
+		internSkillMods(skill);
+
 		//Load the abilities of the skill into the ability map.
 		const auto& commands = skill->commands;
 
@@ -197,6 +200,8 @@ void SkillManager::loadSkill(LuaObject* luaSkill) {
 	parent->addChild(skill);
 	skillMap.put(skill->getSkillName().hashCode(), skill);
 
+	internSkillMods(skill);
+
 	Vector<String> commands = skill->commands;
 
 	for(int i = 0; i < commands.size(); ++i) {
@@ -209,6 +214,13 @@ void SkillManager::loadSkill(LuaObject* luaSkill) {
 
 }
 
+void SkillManager::internSkillMods(const Skill* skill) {
+	const auto skillModifiers = skill->getSkillModifiers();
+
+	for (int i = 0; i < skillModifiers->size(); ++i)
+		SkillModRegistry::instance()->intern(skillModifiers->elementAt(i).getKey());
+}
+
 void SkillManager::loadXpLimits() {
 	IffStream* iffStream = TemplateManager::instance()->openIffFile("datatables/skill/xp_limits.iff");
 
@@ -56,6 +56,8 @@ class SkillManager : public Singleton<SkillManager>, public Logger, public Objec
 
 	bool apprenticeshipEnabled;
 
+	void internSkillMods(const Skill* skill);
+
 public:
 	static int TOTAL_SKILL_POINTS;
 	SkillManager();
@@ -0,0 +1,111 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#include "SkillModRegistry.h"
+
+SkillModRegistry::SkillModRegistry() : Logger("SkillModRegistry") {
+	SkillModTable* builtinTable = new SkillModTable();
+
+	// Must follow the order of SkillModID
+	const char* builtinNames[] = {
+		"attack_accuracy",
+		"combat_bleeding_defense",
+		"combat_equillibrium",
+		"combat_haste",
+		"creature_hit_bonus",
+		"dodge_attack",
+		"force_absorb",
+		"force_armor",
+		"force_defense",
+		"force_feedback",
+		"force_power_dark",
+		"force_power_light",
+		"force_shield",
+		"jedi_toughness",
+		"melee_accuracy",
+		"melee_speed",
+		"mitigate_damage",
+		"private_accuracy_bonus",
+		"private_aim",
+		"private_attack_accuracy",
+		"private_center_of_being",
+		"private_damage_bonus",
+		"private_damage_divisor",
+		"private_damage_divisor_intimidate",
+		"private_damage_divisor_stun",
+		"private_damage_multiplier",
+		"private_damage_susceptibility",
+		"private_defense",
+		"private_dodge_attack",
+		"private_melee_accuracy_bonus",
+		"private_melee_damage_bonus",
+		"private_melee_speed_bonus",
+		"private_ranged_accuracy_bonus",
+		"private_ranged_damage_bonus",
+		"private_ranged_speed_bonus",
+		"private_speed_bonus",
+		"ranged_accuracy",
+		"ranged_speed",
+		"saber_block",
+	};
+
+	static_assert(sizeof(builtinNames) / sizeof(builtinNames[0]) == SkillModID::BUILTIN_COUNT, "missing built-in skill mod name");
+
+	for (uint32 i = 0; i < SkillModID::BUILTIN_COUNT; ++i) {
+		builtinTable->ids.put(builtinNames[i], i);
+		builtinTable->names.add(builtinNames[i]);
+	}
+
+	table.store(builtinTable, std::memory_order_release);
+}
+
+SkillModRegistry::~SkillModRegistry() {
+	delete table.load(std::memory_order_acquire);
+}
+
+uint32 SkillModRegistry::intern(const String& name) {
+	uint32 id = find(name);
+
+	if (id != SkillModID::INVALID)
+		return id;
+
+	Locker locker(&mutex);
+
+	const SkillModTable* currentTable = table.load(std::memory_order_acquire);
+
+	id = currentTable->ids.get(name);
+
+	if (id != SkillModID::INVALID)
+		return id;
+
+	SkillModTable* newTable = new SkillModTable();
+
+	for (int i = 0; i < currentTable->ids.size(); ++i) {
+		const auto& entry = currentTable->ids.elementAt(i);
+
+		newTable->ids.put(entry.getKey(), entry.getValue());
+	}
+
+	newTable->names.addAll(currentTable->names);
+
+	id = newTable->names.size();
+
+	newTable->ids.put(name, id);
+	newTable->names.add(name);
+
+	table.store(newTable, std::memory_order_seq_cst);
+	retiredTables.retire(currentTable);
+
+	return id;
+}
+
+String SkillModRegistry::getName(uint32 id) const {
+	conf::HazardGuard<const SkillModTable> currentTable(table);
+
+	if (id >= (uint32) currentTable->names.size())
+		return "";
+
+	return currentTable->names.get(id);
+}
@@ -0,0 +1,130 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#ifndef SKILLMODREGISTRY_H_
+#define SKILLMODREGISTRY_H_
+
+#include "engine/engine.h"
+
+#include "conf/HazardPointers.h"
+
+namespace server {
+namespace zone {
+namespace managers {
+namespace skill {
+
+/**
+ * Ids of the skill mods read by name in the combat formulas. Every other
+ * skill mod gets the ids after BUILTIN_COUNT when skills are loaded or
+ * the first time it is added to a creature.
+ */
+namespace SkillModID {
+enum : uint32 {
+	ATTACK_ACCURACY,
+	COMBAT_BLEEDING_DEFENSE,
+	COMBAT_EQUILLIBRIUM,
+	COMBAT_HASTE,
+	CREATURE_HIT_BONUS,
+	DODGE_ATTACK,
+	FORCE_ABSORB,
+	FORCE_ARMOR,
+	FORCE_DEFENSE,
+	FORCE_FEEDBACK,
+	FORCE_POWER_DARK,
+	FORCE_POWER_LIGHT,
+	FORCE_SHIELD,
+	JEDI_TOUGHNESS,
+	MELEE_ACCURACY,
+	MELEE_SPEED,
+	MITIGATE_DAMAGE,
+	PRIVATE_ACCURACY_BONUS,
+	PRIVATE_AIM,
+	PRIVATE_ATTACK_ACCURACY,
+	PRIVATE_CENTER_OF_BEING,
+	PRIVATE_DAMAGE_BONUS,
+	PRIVATE_DAMAGE_DIVISOR,
+	PRIVATE_DAMAGE_DIVISOR_INTIMIDATE,
+	PRIVATE_DAMAGE_DIVISOR_STUN,
+	PRIVATE_DAMAGE_MULTIPLIER,
+	PRIVATE_DAMAGE_SUSCEPTIBILITY,
+	PRIVATE_DEFENSE,
+	PRIVATE_DODGE_ATTACK,
+	PRIVATE_MELEE_ACCURACY_BONUS,
+	PRIVATE_MELEE_DAMAGE_BONUS,
+	PRIVATE_MELEE_SPEED_BONUS,
+	PRIVATE_RANGED_ACCURACY_BONUS,
+	PRIVATE_RANGED_DAMAGE_BONUS,
+	PRIVATE_RANGED_SPEED_BONUS,
+	PRIVATE_SPEED_BONUS,
+	RANGED_ACCURACY,
+	RANGED_SPEED,
+	SABER_BLOCK,
+	BUILTIN_COUNT,
+
+	INVALID = 0xFFFFFFFF
+};
+}
+
+/**
+ * Maps skill mod names to dense ids, so skill mod lists can keep their totals
+ * in an array.
+ *
+ * Lookups read the current table without locking. Interning a new name
+ * publishes a copy of the table with the name added. Names are interned while
+ * skills load and only rarely afterwards.
+ */
+class SkillModRegistry : public Singleton<SkillModRegistry>, public Logger, public Object {
+	class SkillModTable {
+	public:
+		VectorMap<String, uint32> ids;
+		Vector<String> names;
+
+		SkillModTable() {
+			ids.setNoDuplicateInsertPlan();
+			ids.setNullValue(SkillModID::INVALID);
+		}
+	};
+
+	std::atomic<const SkillModTable*> table;
+
+	// Guards interning and retiredTables
+	Mutex mutex;
+	conf::RetireList<SkillModTable> retiredTables;
+
+public:
+	SkillModRegistry();
+	~SkillModRegistry();
+
+	/**
+	 * Returns the id of name, assigning it the next one if it is new.
+	 */
+	uint32 intern(const String& name);
+
+	/**
+	 * @return the id of name or SkillModID::INVALID if it was never interned
+	 */
+	uint32 find(const String& name) const {
+		conf::HazardGuard<const SkillModTable> currentTable(table);
+
+		return currentTable->ids.get(name);
+	}
+
+	String getName(uint32 id) const;
+
+	int size() const {
+		conf::HazardGuard<const SkillModTable> currentTable(table);
+
+		return currentTable->names.size();
+	}
+};
+
+}
+}
+}
+}
+
+using namespace server::zone::managers::skill;
+
+#endif /* SKILLMODREGISTRY_H_ */
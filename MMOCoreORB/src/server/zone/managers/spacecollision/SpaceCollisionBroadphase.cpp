@@ -0,0 +1,179 @@
+#include "SpaceCollisionBroadphase.h"
+#include "templates/appearance/AppearanceTemplate.h"
+
+SpaceCollisionBroadphase::SpaceCollisionBroadphase(const Vector<ManagedReference<SceneObject*>>& targetVectorCopy) {
+	segmentCount = 0;
+	segmentCapacity = 0;
+
+	startX = nullptr;
+	startY = nullptr;
+	startZ = nullptr;
+	deltaX = nullptr;
+	deltaY = nullptr;
+	deltaZ = nullptr;
+	sqrDistance = nullptr;
+	invSqrDistance = nullptr;
+	radius = nullptr;
+	hitMasks = nullptr;
+
+	for (int i = 0; i < targetVectorCopy.size() && targets.size() < TARGETSMAX; ++i) {
+		addTarget(targetVectorCopy.getUnsafe(i));
+	}
+}
+
+SpaceCollisionBroadphase::~SpaceCollisionBroadphase() {
+	setCapacity(0);
+}
+
+void SpaceCollisionBroadphase::setCapacity(int capacity) {
+	float** arrays[] = {&startX, &startY, &startZ, &deltaX, &deltaY, &deltaZ, &sqrDistance, &invSqrDistance, &radius};
+
+	for (auto array : arrays) {
+		float* resized = capacity > 0 ? new float[capacity] : nullptr;
+
+		for (int i = 0; i < segmentCount && i < capacity; ++i) {
+			resized[i] = (*array)[i];
+		}
+
+		delete [] *array;
+		*array = resized;
+	}
+
+	uint32* resizedMasks = capacity > 0 ? new uint32[capacity] : nullptr;
+
+	for (int i = 0; i < segmentCount && i < capacity; ++i) {
+		resizedMasks[i] = hitMasks[i];
+	}
+
+	delete [] hitMasks;
+	hitMasks = resizedMasks;
+
+	segmentCapacity = capacity;
+}
+
+bool SpaceCollisionBroadphase::addTarget(SceneObject* target) {
+	if (target == nullptr) {
+		return false;
+	}
+
+	Vector3 center;
+	float sphereRadius = 0.f;
+
+	if (target->isShipObject()) {
+		auto targetShip = target->asShipObject();
+
+		if (targetShip == nullptr) {
+			return false;
+		}
+
+		center = targetShip->getPosition();
+		sphereRadius = targetShip->getBoundingRadius();
+	} else {
+		auto appearance = target->getAppearanceTemplate();
+
+		if (appearance == nullptr) {
+			return false;
+		}
+
+		auto bounding = appearance->getBoundingVolume();
+
+		if (bounding == nullptr) {
+			return false;
+		}
+
+		const Sphere& sphere = bounding->getBoundingSphere();
+
+		center = target->getPosition() + sphere.getCenter();
+		sphereRadius = sphere.getRadius();
+	}
+
+	return addTarget(target, center, sphereRadius);
+}
+
+bool SpaceCollisionBroadphase::addTarget(SceneObject* target, const Vector3& center, float sphereRadius) {
+	if (targets.size() >= TARGETSMAX) {
+		return false;
+	}
+
+	int index = targets.size();
+
+	targetX[index] = center.getX();
+	targetY[index] = center.getY();
+	targetZ[index] = center.getZ();
+	targetRadius[index] = sphereRadius;
+
+	targets.add(target);
+
+	return true;
+}
+
+int SpaceCollisionBroadphase::addProjectile(const ShipProjectile* projectile) {
+	return addSegment(projectile->getLastPosition(), projectile->getThisPosition(), projectile->getDistance(), projectile->getRadius());
+}
+
+int SpaceCollisionBroadphase::addSegment(const Vector3& rayStart, const Vector3& rayEnd, float distance, float segmentRadius) {
+	if (segmentCount == segmentCapacity) {
+		setCapacity(Math::max(segmentCapacity * 2, 16));
+	}
+
+	int index = segmentCount++;
+
+	startX[index] = rayStart.getX();
+	startY[index] = rayStart.getY();
+	startZ[index] = rayStart.getZ();
+	deltaX[index] = rayEnd.getX() - rayStart.getX();
+	deltaY[index] = rayEnd.getY() - rayStart.getY();
+	deltaZ[index] = rayEnd.getZ() - rayStart.getZ();
+	sqrDistance[index] = distance * distance;
+	invSqrDistance[index] = distance > 0.f ? 1.f / (distance * distance) : 0.f;
+	radius[index] = segmentRadius;
+	hitMasks[index] = 0;
+
+	return index;
+}
+
+void SpaceCollisionBroadphase::run() {
+	const int count = segmentCount;
+
+	const float* __restrict sx = startX;
+	const float* __restrict sy = startY;
+	const float* __restrict sz = startZ;
+	const float* __restrict dx = deltaX;
+	const float* __restrict dy = deltaY;
+	const float* __restrict dz = deltaZ;
+	const float* __restrict sqrDist = sqrDistance;
+	const float* __restrict invSqrDist = invSqrDistance;
+	const float* __restrict rad = radius;
+	uint32* __restrict masks = hitMasks;
+
+	// Same test as SpaceCollisionManager::getPointIntersection, written branch free
+	for (int t = 0; t < targets.size(); ++t) {
+		const float tx = targetX[t];
+		const float ty = targetY[t];
+		const float tz = targetZ[t];
+		const float tr = targetRadius[t];
+		const uint32 bit = 1u << t;
+
+		for (int i = 0; i < count; ++i) {
+			float diffX = tx - sx[i];
+			float diffY = ty - sy[i];
+			float diffZ = tz - sz[i];
+
+			float sqrRadius = (tr + rad[i]) * (tr + rad[i]);
+			float dotProduct = diffX * dx[i] + diffY * dy[i] + diffZ * dz[i];
+
+			float fraction = dotProduct * invSqrDist[i];
+			fraction = fraction < 0.f ? 0.f : fraction;
+			fraction = fraction > 1.f ? 1.f : fraction;
+
+			float closeX = diffX - dx[i] * fraction;
+			float closeY = diffY - dy[i] * fraction;
+			float closeZ = diffZ - dz[i] * fraction;
+			float sqrDifference = closeX * closeX + closeY * closeY + closeZ * closeZ;
+
+			uint32 hit = (dotProduct >= -sqrRadius) & (dotProduct <= sqrRadius + sqrDist[i]) & (sqrDifference <= sqrRadius);
+
+			masks[i] |= bit & (0u - hit);
+		}
+	}
+}
@@ -0,0 +1,88 @@
+#ifndef SPACECOLLISIONBROADPHASE_H_
+#define SPACECOLLISIONBROADPHASE_H_
+
+#include "server/zone/objects/ship/ShipObject.h"
+#include "server/zone/objects/ship/ShipTargetVector.h"
+#include "server/zone/managers/spacecombat/projectile/ShipProjectile.h"
+
+/**
+ * Bounding sphere test of every projectile segment of one ship update against
+ * every target of the ship in a single pass. Segments are kept as separate
+ * arrays per component so the inner loop over segments can be vectorized, and
+ * the targets each segment may hit are returned as a bit mask in target order
+ * for the narrow phase.
+ */
+class SpaceCollisionBroadphase {
+public:
+	const static int TARGETSMAX = ShipTargetVector::TARGETVECTORMAX;
+
+	static_assert(TARGETSMAX <= 32, "target hit mask is 32 bits");
+
+private:
+	Vector<ManagedReference<SceneObject*>> targets;
+
+	float targetX[TARGETSMAX];
+	float targetY[TARGETSMAX];
+	float targetZ[TARGETSMAX];
+	float targetRadius[TARGETSMAX];
+
+	int segmentCount;
+	int segmentCapacity;
+
+	float* startX;
+	float* startY;
+	float* startZ;
+	float* deltaX;
+	float* deltaY;
+	float* deltaZ;
+	float* sqrDistance;
+	float* invSqrDistance;
+	float* radius;
+	uint32* hitMasks;
+
+	void setCapacity(int capacity);
+
+	bool addTarget(SceneObject* target);
+
+public:
+	SpaceCollisionBroadphase(const Vector<ManagedReference<SceneObject*>>& targetVectorCopy);
+	~SpaceCollisionBroadphase();
+
+	/**
+	 * Queues the segment of the projectile from its last to its current position.
+	 * @return index of the segment
+	 */
+	int addProjectile(const ShipProjectile* projectile);
+
+	/**
+	 * Adds a target by its bounding sphere.
+	 * @return false once TARGETSMAX targets were added
+	 */
+	bool addTarget(SceneObject* target, const Vector3& center, float sphereRadius);
+
+	/**
+	 * Queues the segment from rayStart to rayEnd, distance being its length.
+	 * @return index of the segment
+	 */
+	int addSegment(const Vector3& rayStart, const Vector3& rayEnd, float distance, float segmentRadius);
+
+	void run();
+
+	inline uint32 getHitMask(int segment) const {
+		return hitMasks[segment];
+	}
+
+	inline SceneObject* getTarget(int index) const {
+		return targets.getUnsafe(index);
+	}
+
+	inline int getTargetCount() const {
+		return targets.size();
+	}
+
+	inline int getSegmentCount() const {
+		return segmentCount;
+	}
+};
+
+#endif // SPACECOLLISIONBROADPHASE_H_
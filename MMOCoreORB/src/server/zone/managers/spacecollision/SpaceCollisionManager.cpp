@@ -3,111 +3,86 @@
 #include "server/zone/objects/ship/ShipChassisData.h"
 #include "server/zone/objects/ship/ComponentSlots.h"
 
-float SpaceCollisionManager::getProjectileCollision(ShipObject* ship, const ShipProjectile* projectile, SpaceCollisionResult& result, Vector<ManagedReference<SceneObject*>>& targetVectorCopy) {
-	if (ship == nullptr || projectile == nullptr || targetVectorCopy.size() == 0) {
+float SpaceCollisionManager::getProjectileCollision(ShipObject* ship, const ShipProjectile* projectile, SpaceCollisionResult& result, const SpaceCollisionBroadphase& broadphase, int segment) {
+	if (ship == nullptr || projectile == nullptr) {
 		return MISS;
 	}
 
-	const Vector3& rayStart = projectile->getLastPosition();
-	const Vector3& rayEnd =  projectile->getThisPosition();
-
-	float rayDistance = projectile->getDistance();
-	float rayRadius = projectile->getRadius();
+	uint32 hitMask = broadphase.getHitMask(segment);
 
-	Vector3 direction = rayEnd - rayStart;
-
-	for (int i = 0; i < targetVectorCopy.size(); ++i) {
-		auto target = targetVectorCopy.get(i);
-
-		if (target == nullptr) {
+	for (int i = 0; hitMask != 0; ++i, hitMask >>= 1) {
+		if ((hitMask & 1) == 0) {
 			continue;
 		}
 
-		if (target->isShipObject()) {
-			auto targetShip = target->asShipObject();
-
-			if (targetShip == nullptr) {
-				continue;
-			}
-
-			Vector3 difference = targetShip->getPosition() - rayStart;
-			float targetRadius = targetShip->getBoundingRadius() + rayRadius;
+		if (getTargetCollision(broadphase.getTarget(i), projectile, result) != MISS) {
+			break;
+		}
+	}
 
-			float intersection = getPointIntersection(direction, difference, targetRadius, rayDistance);
+	return result.getDistance();
+}
 
-			if (intersection == MISS) {
-				continue;
-			}
+float SpaceCollisionManager::getTargetCollision(SceneObject* target, const ShipProjectile* projectile, SpaceCollisionResult& result) {
+	if (target == nullptr || projectile == nullptr) {
+		return MISS;
+	}
 
-			auto data = ShipManager::instance()->getCollisionData(targetShip);
+	if (target->isShipObject()) {
+		auto targetShip = target->asShipObject();
 
-			if (data == nullptr) {
-				continue;
-			}
+		if (targetShip == nullptr) {
+			return MISS;
+		}
 
-			auto type = data->getVolumeType();
+		auto data = ShipManager::instance()->getCollisionData(targetShip);
 
-			switch (type) {
-				case ShipCollisionData::CollisionVolumeType::SPHERE: {
-					getChassisRadiusCollision(targetShip, data, projectile, result);
-					break;
-				}
+		if (data == nullptr) {
+			return MISS;
+		}
 
-				case ShipCollisionData::CollisionVolumeType::BOX: {
-					getChassisBoxCollision(targetShip, data, projectile, result);
-					break;
-				}
+		auto type = data->getVolumeType();
 
-				case ShipCollisionData::CollisionVolumeType::MESH: {
-					getChassisAppearanceCollision(targetShip, data, projectile, result);
-					break;
-				}
+		switch (type) {
+			case ShipCollisionData::CollisionVolumeType::SPHERE: {
+				getChassisRadiusCollision(targetShip, data, projectile, result);
+				break;
 			}
 
-			if (data->getTargetableSlots().size() > 0) {
-				getComponentHardpointCollision(targetShip, data, projectile, result);
+			case ShipCollisionData::CollisionVolumeType::BOX: {
+				getChassisBoxCollision(targetShip, data, projectile, result);
+				break;
 			}
-		} else {
-			auto appearance = target->getAppearanceTemplate();
 
-			if (appearance == nullptr) {
-				continue;
+			case ShipCollisionData::CollisionVolumeType::MESH: {
+				getChassisAppearanceCollision(targetShip, data, projectile, result);
+				break;
 			}
+		}
 
-			auto bounding = appearance->getBoundingVolume();
-
-			if (bounding == nullptr) {
-				continue;
-			}
-
-			const Sphere& sphere = bounding->getBoundingSphere();
-
-			Vector3 difference = (target->getPosition() + sphere.getCenter()) - rayStart;
-			float targetRadius = sphere.getRadius() + rayRadius;
-
-			float intersection = getPointIntersection(direction, difference, targetRadius, rayDistance);
-
-			if (intersection == MISS) {
-				continue;
-			}
+		if (data->getTargetableSlots().size() > 0) {
+			getComponentHardpointCollision(targetShip, data, projectile, result);
+		}
+	} else {
+		auto appearance = target->getAppearanceTemplate();
+		auto bounding = appearance == nullptr ? nullptr : appearance->getBoundingVolume();
 
-			auto collision = appearance->getCollisionVolume();
+		if (bounding == nullptr) {
+			return MISS;
+		}
 
-			if (collision == nullptr) {
-				collision = bounding;
-			}
+		auto collision = appearance->getCollisionVolume();
 
-			if (collision->isBoundingSphere()) {
-				getRadiusCollision(target, collision->getBoundingSphere(), projectile, result);
-			} else if (collision->isBoundingBox()) {
-				getBoxCollision(target, collision->getBoundingBox(), projectile, result);
-			} else {
-				getAppearanceCollision(target, appearance, projectile, result);
-			}
+		if (collision == nullptr) {
+			collision = bounding;
 		}
 
-		if (result.getDistance() != MISS) {
-			break;
+		if (collision->isBoundingSphere()) {
+			getRadiusCollision(target, collision->getBoundingSphere(), projectile, result);
+		} else if (collision->isBoundingBox()) {
+			getBoxCollision(target, collision->getBoundingBox(), projectile, result);
+		} else {
+			getAppearanceCollision(target, appearance, projectile, result);
 		}
 	}
 
@@ -3,6 +3,7 @@
 
 #include "server/zone/objects/ship/ShipObject.h"
 #include "server/zone/managers/spacecollision/SpaceCollisionResult.h"
+#include "server/zone/managers/spacecollision/SpaceCollisionBroadphase.h"
 
 #define SPACE_COLLISION_DEBUG
 
@@ -14,7 +15,12 @@ public:
 		setLoggingName("SpaceCollisionManager");
 	}
 
-	float getProjectileCollision(ShipObject* ship, const ShipProjectile* projectile, SpaceCollisionResult& result, Vector<ManagedReference<SceneObject*>>& targetVectorCopy);
+	/**
+	 * Narrow phase of the targets the broad phase found for one segment, in target order.
+	 */
+	float getProjectileCollision(ShipObject* ship, const ShipProjectile* projectile, SpaceCollisionResult& result, const SpaceCollisionBroadphase& broadphase, int segment);
+
+	float getTargetCollision(SceneObject* target, const ShipProjectile* projectile, SpaceCollisionResult& result);
 
 	float getPointIntersection(const Vector3& rayStart, const Vector3& rayEnd, float radius, float distance);
 
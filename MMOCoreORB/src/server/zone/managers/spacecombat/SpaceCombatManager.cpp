@@ -14,6 +14,7 @@
 #include "server/zone/packets/ship/DestroyShipComponentMessage.h"
 #include "templates/params/ship/ShipFlag.h"
 #include "server/zone/objects/ship/ai/events/RemoveDisabledInvulnerableTask.h"
+#include "conf/ConfigManager.h"
 
 void SpaceCombatManager::broadcastProjectile(ShipObject* ship, const ShipProjectile* projectile, CreatureObject* player) const {
 	auto cov = ship == nullptr ? nullptr : ship->getCloseObjects();
@@ -620,13 +621,13 @@ int SpaceCombatManager::getActiveComponentToDamage(ShipObject* target) const {
 	return Components::CHASSIS;
 }
 
-int SpaceCombatManager::updateProjectile(ShipObject* ship, ShipProjectile* projectile, SpaceCollisionResult& result, Vector<ManagedReference<SceneObject*>>& targetVectorCopy, const uint64& miliTime) {
+int SpaceCombatManager::updateProjectile(ShipObject* ship, ShipProjectile* projectile, const uint64& miliTime) {
 	if (ship == nullptr || projectile == nullptr) {
 		return ProjectileResult::EXPIRE;
 	}
 
 	if (projectile->isMissile()) {
-		return updateMissile(ship, projectile, result, targetVectorCopy, miliTime);
+		return updateMissile(ship, projectile, miliTime);
 	}
 
 	long deltaTime = miliTime - projectile->getLastUpdateTime();
@@ -655,14 +656,10 @@ int SpaceCombatManager::updateProjectile(ShipObject* ship, ShipProjectile* proje
 		return ProjectileResult::MISS;
 	}
 
-	if (SpaceCollisionManager::instance()->getProjectileCollision(ship, projectile, result, targetVectorCopy) != SpaceCollisionManager::MISS) {
-		return ProjectileResult::HIT;
-	}
-
-	return ProjectileResult::MISS;
+	return ProjectileResult::CHECK;
 }
 
-int SpaceCombatManager::updateMissile(ShipObject* ship, ShipProjectile* projectile, SpaceCollisionResult& result, Vector<ManagedReference<SceneObject*>>& targetVectorCopy, const uint64& miliTime) {
+int SpaceCombatManager::updateMissile(ShipObject* ship, ShipProjectile* projectile, const uint64& miliTime) {
 	if (ship == nullptr || projectile == nullptr || !projectile->isMissile()) {
 		return ProjectileResult::EXPIRE;
 	}
@@ -733,12 +730,7 @@ int SpaceCombatManager::updateMissile(ShipObject* ship, ShipProjectile* projecti
 		return ProjectileResult::MISS;
 	}
 
-	if (SpaceCollisionManager::instance()->getProjectileCollision(ship, projectile, result, targetVectorCopy) != SpaceCollisionManager::MISS) {
-		broadcastMissileUpdate(ship, missile, -1, UpdateMissileMessage::UpdateType::HIT);
-		return ProjectileResult::HIT;
-	}
-
-	return ProjectileResult::MISS;
+	return ProjectileResult::CHECK;
 }
 
 void SpaceCombatManager::triggerDisabledObserver(ShipObject* attackerShip, ShipObject* defenderShip, bool setInvulnerable) const {
@@ -780,77 +772,146 @@ void SpaceCombatManager::triggerDisabledObserver(ShipObject* attackerShip, ShipO
 	}, "ShipDisabledObserverLambda", 200);
 }
 
-int SpaceCombatManager::updateProjectiles() {
-	uint64 miliTime = System::getMiliTime();
+void SpaceCombatManager::updateShipProjectiles(ShipProjectileMapEntry* entry, const uint64& miliTime) {
+	auto ship = entry->getShip();
 
-	try {
-		for (int i = projectileMap.mapSize(); -1 < --i;) {
-			if (projectileMap.entrySize(i) == 0) {
-				projectileMap.removeShip(i);
-				continue;
-			}
+	if (ship == nullptr) {
+		projectileMap.removeEntry(entry);
+		return;
+	}
 
-			auto ship = projectileMap.getShip(i);
+	Locker sLock(ship);
 
-			if (ship == nullptr || ship->getZone() == nullptr) {
-				projectileMap.removeShip(i);
-				continue;
-			}
+	auto targetVector = ship->getTargetVector();
 
-			Locker sLock(ship);
+	if (entry->size() == 0 || ship->getZone() == nullptr || targetVector == nullptr || targetVector->size() == 0) {
+		projectileMap.removeEntry(entry);
+		return;
+	}
 
-			auto targetVector = ship->getTargetVector();
+	Vector<ManagedReference<SceneObject*>> targetVectorCopy;
+	targetVector->safeCopyTo(targetVectorCopy);
 
-			if (targetVector == nullptr || targetVector->size() == 0) {
-				projectileMap.removeShip(i);
-				continue;
-			}
+	SpaceCollisionBroadphase broadphase(targetVectorCopy);
 
-			Vector<ManagedReference<SceneObject*>> targetVectorCopy;
-			targetVector->safeCopyTo(targetVectorCopy);
+	// Projectiles added while a missile check cross locks its target wait for the next update
+	int projectileCount = entry->size();
 
-			for (int ii = projectileMap.entrySize(i); -1 < --ii;) {
-				auto projectile = projectileMap.getProjectile(i, ii);
+	Vector<int> hitResults;
+	Vector<int> segments;
 
-				if (projectile == nullptr) {
-					projectileMap.removeProjectile(i, ii);
-					continue;
-				}
+	for (int i = 0; i < projectileCount; ++i) {
+		auto projectile = entry->getProjectile(i);
+		int hitResult = projectile == nullptr ? ProjectileResult::EXPIRE : updateProjectile(ship, projectile, miliTime);
+
+		hitResults.add(hitResult);
+		segments.add(hitResult == ProjectileResult::CHECK ? broadphase.addProjectile(projectile) : -1);
+	}
+
+	if (broadphase.getSegmentCount() > 0 && broadphase.getTargetCount() > 0) {
+		broadphase.run();
+	}
+
+	for (int i = projectileCount; -1 < --i;) {
+		auto projectile = entry->getProjectile(i);
+		int hitResult = hitResults.get(i);
 
-				SpaceCollisionResult result;
-				int hitResult = updateProjectile(ship, projectile, result, targetVectorCopy, miliTime);
+		SpaceCollisionResult result;
+
+		if (hitResult == ProjectileResult::CHECK) {
+			hitResult = SpaceCollisionManager::instance()->getProjectileCollision(ship, projectile, result, broadphase, segments.get(i)) != SpaceCollisionManager::MISS ? ProjectileResult::HIT : ProjectileResult::MISS;
+		}
 
-				if (hitResult == ProjectileResult::HIT) {
-					applyDamage(ship, projectile, result);
+		if (hitResult == ProjectileResult::HIT) {
+			if (projectile->isMissile()) {
+				auto missile = dynamic_cast<ShipMissile*>(projectile);
+
+				if (missile != nullptr) {
+					broadcastMissileUpdate(ship, missile, -1, UpdateMissileMessage::UpdateType::HIT);
+				}
+			}
+
+			applyDamage(ship, projectile, result);
 #ifdef SPACECOLLISION_DEBUG
-					result.debugCollision(ship, projectile);
+			result.debugCollision(ship, projectile);
 #endif // SPACECOLLISION_DEBUG
-					projectileMap.removeProjectile(i, ii);
-					continue;
-				}
+			entry->remove(i);
+			continue;
+		}
 
 #ifdef SHIPPROJECTILE_DEBUG
-				projectile->debugProjectile(ship, hitResult);
+		if (projectile != nullptr) {
+			projectile->debugProjectile(ship, hitResult);
+		}
 #endif // SHIPPROJECTILE_DEBUG
 
-				if (hitResult == ProjectileResult::EXPIRE) {
-					projectileMap.removeProjectile(i, ii);
-					continue;
-				}
+		if (hitResult == ProjectileResult::EXPIRE) {
+			entry->remove(i);
+			continue;
+		}
 
-				if (hitResult == ProjectileResult::MISS) {
-					projectile->setLastUpdateTime(miliTime);
-					continue;
-				}
-			}
+		if (hitResult == ProjectileResult::MISS) {
+			projectile->setLastUpdateTime(miliTime);
+			continue;
+		}
+	}
+}
+
+void SpaceCombatManager::updateProjectileShard(const Vector<Reference<ShipProjectileMapEntry*>>& entries, const uint64& miliTime) {
+	for (int i = 0; i < entries.size(); ++i) {
+		try {
+			updateShipProjectiles(entries.getUnsafe(i), miliTime);
+		} catch (Exception& e) {
+			error() << e.getMessage();
+			e.printStackTrace();
 		}
+	}
+
+	if (pendingShards.fetch_sub(1) == 1) {
+		finishProjectileUpdate(miliTime);
+	}
+}
+
+void SpaceCombatManager::finishProjectileUpdate(const uint64& miliTime) {
+	int delta = System::getMiliTime() - miliTime;
+	int interval = Math::max(CheckProjectilesTask::INTERVAL - delta, (int)CheckProjectilesTask::INTERVALMIN);
+
+	checkProjectilesTask->reschedule(interval);
+}
+
+void SpaceCombatManager::updateProjectiles() {
+	uint64 miliTime = System::getMiliTime();
+
+	Vector<Reference<ShipProjectileMapEntry*>> entries;
+	projectileMap.getEntries(entries);
+
+	int maxShards = Math::max(ConfigManager::instance()->getSpaceProjectileThreads(), 1);
+	int shardCount = Math::clamp(1, (entries.size() + CheckProjectilesTask::SHIPSPERSHARD - 1) / CheckProjectilesTask::SHIPSPERSHARD, maxShards);
+
+	Vector<Vector<Reference<ShipProjectileMapEntry*>>> shards;
+
+	for (int i = 0; i < shardCount; ++i) {
+		shards.add(Vector<Reference<ShipProjectileMapEntry*>>());
+	}
+
+	// Interleaved so ships added at the same time don't all land in one shard
+	for (int i = 0; i < entries.size(); ++i) {
+		shards.get(i % shardCount).add(entries.getUnsafe(i));
+	}
+
+	pendingShards = shardCount;
+
+	Reference<SpaceCombatManager*> manager = this;
+
+	for (int i = 1; i < shardCount; ++i) {
+		const auto& shard = shards.get(i);
 
-	} catch (Exception& e ) {
-		error() << e.getMessage();
-		e.printStackTrace();
+		Core::getTaskManager()->executeTask([manager, shard, miliTime]() {
+			manager->updateProjectileShard(shard, miliTime);
+		}, "UpdateProjectileShardLambda");
 	}
 
-	return System::getMiliTime() - miliTime;
+	updateProjectileShard(shards.get(0), miliTime);
 }
 
 void SpaceCombatManager::addProjectile(ShipObject* ship, ShipProjectile* projectile, CreatureObject* player) {
@@ -8,11 +8,15 @@
 #include "server/zone/managers/spacecollision/SpaceCollisionResult.h"
 #include "server/zone/objects/ship/ShipObject.h"
 
+#include <atomic>
+
 class SpaceCombatManager : public Singleton<SpaceCombatManager>, public Logger, public Object {
 public:
 	SpaceCombatManager() {
 		setLoggingName("SpaceCombatManager");
 
+		pendingShards = 0;
+
 		checkProjectilesTask = new CheckProjectilesTask(this);
 		checkProjectilesTask->execute();
 	}
@@ -25,6 +29,7 @@ public:
 	}
 
 	enum ProjectileResult : int {
+		CHECK = 2,
 		HIT = 1,
 		MISS = 0,
 		EXPIRE = -1
@@ -56,6 +61,7 @@ private:
 		const static int INTERVAL = 200;
 		const static int INTERVALMIN = 100;
 		const static int INTERVALMAX = 2000;
+		const static int SHIPSPERSHARD = 8;
 
 		CheckProjectilesTask(SpaceCombatManager* manager) : Task() {
 			setLoggingName("CheckProjectilesTask");
@@ -68,19 +74,13 @@ private:
 				return;
 			}
 
-			int delta = combatManager->updateProjectiles();
-			int interval = INTERVAL - delta;
-
-			if (interval < INTERVALMIN) {
-				interval = INTERVALMIN;
-			}
-
-			reschedule(interval);
+			combatManager->updateProjectiles();
 		}
 	};
 
 	Reference<CheckProjectilesTask*> checkProjectilesTask;
 	ShipProjectileMap projectileMap;
+	std::atomic<int> pendingShards;
 
 private:
 	void broadcastProjectile(ShipObject* ship, const ShipProjectile* projectile, CreatureObject* player) const;
@@ -109,14 +109,25 @@ private:
 
 	int getActiveComponentToDamage(ShipObject* target) const;
 
-	int updateProjectile(ShipObject* Ship, ShipProjectile* projectile, SpaceCollisionResult& result, Vector<ManagedReference<SceneObject*>>& targetVectorCopy, const uint64& miliTime);
+	int updateProjectile(ShipObject* Ship, ShipProjectile* projectile, const uint64& miliTime);
+
+	int updateMissile(ShipObject* Ship, ShipProjectile* projectile, const uint64& miliTime);
+
+	void updateShipProjectiles(ShipProjectileMapEntry* entry, const uint64& miliTime);
+
+	void updateProjectileShard(const Vector<Reference<ShipProjectileMapEntry*>>& entries, const uint64& miliTime);
 
-	int updateMissile(ShipObject* Ship, ShipProjectile* projectile, SpaceCollisionResult& result, Vector<ManagedReference<SceneObject*>>& targetVectorCopy, const uint64& miliTime);
+	void finishProjectileUpdate(const uint64& miliTime);
 
 	void triggerDisabledObserver(ShipObject* attackerShip, ShipObject* defenderShip, bool setInvulnerable) const;
 
 public:
-	int updateProjectiles();
+	/**
+	 * Moves the projectiles of every ship and resolves their hits, the ships
+	 * split in shards updated on parallel tasks. Reschedules the check task
+	 * once the last shard is done.
+	 */
+	void updateProjectiles();
 
 	void addProjectile(ShipObject* ship, ShipProjectile* projectile, CreatureObject* player = nullptr);
 
@@ -5,28 +5,31 @@
 #include "ShipProjectile.h"
 #include "server/zone/objects/ship/ShipObject.h"
 
+// Projectiles of one ship, only changed with the ship locked
 class ShipProjectileMapEntry : public Object {
 private:
 	ManagedWeakReference<ShipObject*> shipRef;
+	uint64 objectID;
 	Vector<ShipProjectile*> projectileVector;
 
 public:
-	ShipProjectileMapEntry() : Object() {
-
+	ShipProjectileMapEntry(ShipObject* ship) : Object() {
+		shipRef = ship;
+		objectID = ship->getObjectID();
 	}
 
 	~ShipProjectileMapEntry() {
-		for (int i = projectileVector.size(); -1 > --i;) {
-			remove(i);
+		for (int i = 0; i < projectileVector.size(); ++i) {
+			delete projectileVector.get(i);
 		}
 	}
 
-	ShipProjectileMapEntry(ShipObject* ship) : Object() {
-		shipRef = ship;
+	ManagedReference<ShipObject*> getShip() {
+		return shipRef.get();
 	}
 
-	ShipObject* getShip() {
-		return shipRef.get().get();
+	uint64 getObjectID() const {
+		return objectID;
 	}
 
 	ShipProjectile* getProjectile(int index) {
@@ -61,115 +64,54 @@ public:
 
 class ShipProjectileMap {
 private:
-	VectorMap<uint64, ShipProjectileMapEntry> projectileMap;
+	VectorMap<uint64, Reference<ShipProjectileMapEntry*>> projectileMap;
 	mutable ReadWriteLock sync;
 
 public:
 	ShipProjectileMap() {
 		projectileMap.setNoDuplicateInsertPlan();
+		projectileMap.setNullValue(nullptr);
 	}
 
-	ShipObject* getShip(int mapIndex) {
-		ReadLocker lock(&sync);
-
-		if (projectileMap.size() > mapIndex) {
-			return projectileMap.elementAt(mapIndex).getValue().getShip();
-		}
-
-		return nullptr;
-	}
-
-	ShipProjectileMapEntry* getEntry(int mapIndex) {
+	Reference<ShipProjectileMapEntry*> getEntry(ShipObject* ship) const {
 		ReadLocker lock(&sync);
 
-		if (projectileMap.size() > mapIndex) {
-			return &projectileMap.elementAt(mapIndex).getValue();
-		}
-
-		return nullptr;
-	}
-
-	ShipProjectileMapEntry* getEntry(ShipObject* ship) {
-		ReadLocker lock(&sync);
-
-		uint64 objectID = ship->getObjectID();
-		int index = projectileMap.find(objectID);
-
-		if (index != -1) {
-			return getEntry(index);
-		}
-
-		return nullptr;
+		return projectileMap.get(ship->getObjectID());
 	}
 
-	ShipProjectile* getProjectile(int mapIndex, int entryIndex) {
+	void getEntries(Vector<Reference<ShipProjectileMapEntry*>>& entries) const {
 		ReadLocker lock(&sync);
 
-		auto entry = getEntry(mapIndex);
-
-		if (entry != nullptr) {
-			return entry->getProjectile(entryIndex);
+		for (int i = 0; i < projectileMap.size(); ++i) {
+			entries.add(projectileMap.elementAt(i).getValue());
 		}
-
-		return nullptr;
 	}
 
 	void addProjectile(ShipObject* ship, ShipProjectile* projectile) {
 		Locker lock(&sync);
 
 		uint64 objectID = ship->getObjectID();
-		int index = projectileMap.find(objectID);
+		Reference<ShipProjectileMapEntry*> entry = projectileMap.get(objectID);
 
-		if (index == -1) {
-			auto element = VectorMapEntry<uint64, ShipProjectileMapEntry>(objectID, ShipProjectileMapEntry(ship));
-			projectileMap.add(std::move(element));
-			index = projectileMap.size() - 1;
+		if (entry == nullptr) {
+			entry = new ShipProjectileMapEntry(ship);
+			projectileMap.put(objectID, entry);
 		}
 
-		auto entry = getEntry(index);
-
-		if (entry != nullptr) {
-			entry->add(projectile);
-		}
-	}
-
-	void removeProjectile(int mapIndex, int entryIndex) {
-		Locker lock(&sync);
-
-		auto entry = getEntry(mapIndex);
-
-		if (entry != nullptr) {
-			entry->remove(entryIndex);
-		}
+		entry->add(projectile);
 	}
 
-	void removeShip(int mapIndex) {
+	// Drops entry if it is still the one of its ship, its projectiles go with the last reference
+	void removeEntry(ShipProjectileMapEntry* entry) {
 		Locker lock(&sync);
 
-		if (projectileMap.size() > mapIndex) {
-			auto entry = getEntry(mapIndex);
-			if (entry == nullptr) {
-				return;
-			}
-
-			for (int i = 0; i < entry->size(); ++i) {
-				entry->remove(i);
-			}
+		int index = projectileMap.find(entry->getObjectID());
 
-			projectileMap.remove(mapIndex);
+		if (index != -1 && projectileMap.elementAt(index).getValue() == entry) {
+			projectileMap.remove(index);
 		}
 	}
 
-	int entrySize(int mapIndex) const {
-		ReadLocker lock(&sync);
-
-		if (projectileMap.size() > mapIndex) {
-			return projectileMap.elementAt(mapIndex).getValue().size();
-		}
-
-		return 0;
-	}
-
 	int mapSize() const {
 		ReadLocker lock(&sync);
 
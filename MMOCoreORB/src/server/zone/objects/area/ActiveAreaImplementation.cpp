@@ -13,6 +13,28 @@
 #include "server/zone/objects/area/areashapes/RectangularAreaShape.h"
 #include "server/zone/objects/area/areashapes/CuboidAreaShape.h"
 #include "server/zone/objects/player/PlayerObject.h"
+#include "server/zone/Zone.h"
+#include "server/zone/managers/planet/PlanetManager.h"
+
+namespace {
+	// Areas are tracked by the spawn permission mask of their planet while one of these is set
+	const uint32 SPAWN_BLOCKING_FLAGS = ActiveArea::CITY | ActiveArea::NOSPAWNAREA | ActiveArea::NOWORLDSPAWNAREA;
+
+	void updateSpawnPermissionMask(ActiveArea* area, uint32 flag) {
+		if (!(flag & SPAWN_BLOCKING_FLAGS))
+			return;
+
+		Zone* zone = area->getZone();
+
+		if (zone == nullptr)
+			return;
+
+		PlanetManager* planetManager = zone->getPlanetManager();
+
+		if (planetManager != nullptr && planetManager->getSpawnPermissionMask() != nullptr)
+			planetManager->getSpawnPermissionMask()->updateArea(area);
+	}
+}
 
 bool ActiveAreaImplementation::containsPoint(float px, float py, uint64 cellid) const {
 	if (cellObjectID != 0 && cellObjectID != cellid)
@@ -220,12 +242,16 @@ void ActiveAreaImplementation::initializeChildObject(SceneObject* controllerObje
 void ActiveAreaImplementation::addAreaFlag(uint32 flag) {
 	if (!(areaFlags & flag)) {
 		areaFlags |= flag;
+
+		updateSpawnPermissionMask(_this.getReferenceUnsafeStaticCast(), flag);
 	}
 }
 
 void ActiveAreaImplementation::removeAreaFlag(uint32 flag) {
 	if (areaFlags & flag) {
 		areaFlags &= ~flag;
+
+		updateSpawnPermissionMask(_this.getReferenceUnsafeStaticCast(), flag);
 	}
 }
 
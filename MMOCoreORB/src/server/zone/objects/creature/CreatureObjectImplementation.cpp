@@ -369,7 +369,7 @@ void CreatureObjectImplementation::sendBaselinesTo(SceneObject* player) {
 		player->sendMessage(msg);
 	}
 
-	CreatureObjectMessage3* msg3 = new CreatureObjectMessage3(thisPointer);
+	BasePacket* msg3 = baselineCache->getBaseline('CREO', 3, [thisPointer]() { return new CreatureObjectMessage3(thisPointer); });
 	player->sendMessage(msg3);
 
 	if (player == thisPointer) {
@@ -379,7 +379,7 @@ void CreatureObjectImplementation::sendBaselinesTo(SceneObject* player) {
 		sendSpeedAndAccelerationMods(player);
 	}
 
-	CreatureObjectMessage6* msg6 = new CreatureObjectMessage6(thisPointer);
+	BasePacket* msg6 = baselineCache->getBaseline('CREO', 6, [thisPointer]() { return new CreatureObjectMessage6(thisPointer); });
 	player->sendMessage(msg6);
 
 	if (!player->isPlayerCreature())
@@ -494,6 +494,8 @@ void CreatureObjectImplementation::setWeapon(WeaponObject* newWeapon, bool notif
 
 	weapon = newWeapon;
 
+	invalidateBaselines();
+
 	if (!notifyClient) {
 		return;
 	}
@@ -546,6 +548,8 @@ void CreatureObjectImplementation::setPerformanceType(int type, bool notifyClien
 
 	performanceType = type;
 
+	invalidateBaselines();
+
 	if (notifyClient) {
 		CreatureObjectDeltaMessage6* msg = new CreatureObjectDeltaMessage6(asCreatureObject());
 		msg->updatePerformanceType(performanceType);
@@ -559,6 +563,8 @@ void CreatureObjectImplementation::setTargetID(uint64 targetID,
 		bool notifyClient) {
 	CreatureObjectImplementation::targetID = targetID;
 
+	invalidateBaselines();
+
 	if (notifyClient) {
 		CreatureObjectDeltaMessage6* msg = new CreatureObjectDeltaMessage6(
 				asCreatureObject());
@@ -575,6 +581,8 @@ void CreatureObjectImplementation::setHeight(float height, bool notifyClient) {
 
 	this->height = height;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -603,6 +611,8 @@ void CreatureObjectImplementation::setShockWounds(int newShock, bool notifyClien
 
 	shockWounds = newShock;
 
+	invalidateBaselines();
+
 	if (notifyClient) {
 		CreatureObjectDeltaMessage3* dcreo3 = new CreatureObjectDeltaMessage3(asCreatureObject());
 		dcreo3->updateShockWounds();
@@ -803,6 +813,8 @@ void CreatureObjectImplementation::clearCombatState(bool removedefenders) {
 void CreatureObjectImplementation::setAlternateAppearance(const String& appearanceTemplate, bool notifyClient) {
 	alternateAppearance = appearanceTemplate;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -818,6 +830,8 @@ bool CreatureObjectImplementation::setState(uint64 state, bool notifyClient) {
 	if (!(stateBitmask & state)) {
 		stateBitmask |= state;
 
+		invalidateBaselines();
+
 		if (notifyClient) {
 			if (state == CreatureState::SITTINGONCHAIR) {
 				//this is fucking wrong
@@ -966,6 +980,8 @@ bool CreatureObjectImplementation::clearState(uint64 state, bool notifyClient) {
 
 	stateBitmask &= ~state;
 
+	invalidateBaselines();
+
 	if (notifyClient) {
 		CreatureObjectDeltaMessage3* dcreo3 = new CreatureObjectDeltaMessage3(asCreatureObject());
 		dcreo3->updateStatesBitmask();
@@ -1063,6 +1079,8 @@ void CreatureObjectImplementation::setHAM(int type, int value,
 	} else {
 		hamList.set(type, value, nullptr);
 	}
+
+	invalidateBaselines();
 }
 
 int CreatureObjectImplementation::inflictDamage(TangibleObject* attacker, int damageType, float damage, bool destroy, const String& xp, bool notifyClient, bool isCombatAction) {
@@ -1278,6 +1296,8 @@ void CreatureObjectImplementation::setWounds(int type, int value, bool notifyCli
 		wounds.set(type, value, nullptr);
 	}
 
+	invalidateBaselines();
+
 	int maxHamValue = maxHamList.get(type) - wounds.get(type);
 
 	if (getHAM(type) > maxHamValue) {
@@ -1347,6 +1367,8 @@ void CreatureObjectImplementation::setMaxHAM(int type, int value,
 		maxHamList.set(type, value, nullptr);
 	}
 
+	invalidateBaselines();
+
 	if (wounds.get(type) >= maxHamList.get(type)) // this will reset our wounds to not overflow max value
 		setWounds(type, wounds.get(type), notifyClient);
 
@@ -1576,18 +1598,18 @@ void CreatureObjectImplementation::removeSkillMod(const int modType, const Strin
 void CreatureObjectImplementation::removeAllSkillModsOfType(const int modType, bool notifyClient) {
 	Locker locker(&skillModMutex);
 
-	SkillModGroup* modGroup = skillModList.getSkillModGroup(modType);
+	const SkillModGroup* modGroup = skillModList.getSkillModGroup(modType);
 
 	if (notifyClient) {
 		for (int i = modGroup->size() - 1; i >= 0; --i) {
-			VectorMapEntry<String, int>* entry = &modGroup->elementAt(i);
+			const VectorMapEntry<String, int>* entry = &modGroup->elementAt(i);
 			String key = entry->getKey();
 			int val = entry->getValue();
 			// use the type instead of hardcoding CITY here
 			removeSkillMod(modType, key, val, true);
 		}
 	} else {
-		modGroup->removeAll();
+		skillModList.clearSkillModGroup(modType);
 	}
 }
 
@@ -1597,6 +1619,12 @@ int CreatureObjectImplementation::getSkillMod(const String& skillmod) const {
 	return skillModList.getSkillMod(skillmod);
 }
 
+int CreatureObjectImplementation::getSkillMod(const unsigned int skillModID) const {
+	ReadLocker locker(&skillModMutex);
+
+	return skillModList.getSkillMod(skillModID);
+}
+
 int CreatureObjectImplementation::getSkillModOfType(const String& skillmod, const unsigned int modType) {
 	Locker locker(&skillModMutex);
 
@@ -1674,6 +1702,8 @@ void CreatureObjectImplementation::setPosture(int newPosture, bool immediate, bo
 
 	posture = newPosture;
 
+	invalidateBaselines();
+
 	if (!notifyClient) {
 		return;
 	}
@@ -1843,6 +1873,8 @@ void CreatureObjectImplementation::updateGroupInviterID(uint64 id, bool notifyCl
 	groupInviterID = id;
 	++groupInviteCounter;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -1856,6 +1888,8 @@ void CreatureObjectImplementation::updateGroupInviterID(uint64 id, bool notifyCl
 void CreatureObjectImplementation::updateGroup(GroupObject* grp, bool notifyClient) {
 	group = grp;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -1873,6 +1907,8 @@ void CreatureObjectImplementation::setMood(byte mood, bool notifyClient) {
 
 	moodString = chatManager->getMoodAnimation(chatManager->getMoodType(moodID));
 
+	invalidateBaselines();
+
 	if (notifyClient) {
 		CreatureObjectDeltaMessage6* dcreo6 = new CreatureObjectDeltaMessage6(
 				asCreatureObject());
@@ -1961,6 +1997,8 @@ void CreatureObjectImplementation::setFactionRank(int rank, bool notifyClient) {
 
 	factionRank = rank;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -2039,6 +2077,8 @@ void CreatureObjectImplementation::setMoodString(
 		const String& moodAnimationString, bool notifyClient) {
 	moodString = moodAnimationString;
 
+	invalidateBaselines();
+
 	if (notifyClient) {
 		CreatureObjectDeltaMessage6* dcreo6 = new CreatureObjectDeltaMessage6(
 				asCreatureObject());
@@ -2057,6 +2097,8 @@ void CreatureObjectImplementation::setPerformanceStartTime(int time, bool notify
 
 	performanceStartTime = time;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -2087,6 +2129,8 @@ void CreatureObjectImplementation::setPerformanceAnimation(const String& animati
 
 	performanceAnimation = animation;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -2476,6 +2520,8 @@ void CreatureObjectImplementation::setCreatureLink(CreatureObject* object,
 
 	linkedCreature = object;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -3985,6 +4031,8 @@ void CreatureObjectImplementation::addWearableObject(TangibleObject* object, boo
 	} else {
 		wearablesVector.add(object);
 	}
+
+	invalidateBaselines();
 }
 
 void CreatureObjectImplementation::removeWearableObject(TangibleObject* object, bool notifyClient) {
@@ -4003,6 +4051,8 @@ void CreatureObjectImplementation::removeWearableObject(TangibleObject* object,
 	} else {
 		wearablesVector.remove(index);
 	}
+
+	invalidateBaselines();
 }
 
 CampSiteActiveArea* CreatureObjectImplementation::getCurrentCamp() {
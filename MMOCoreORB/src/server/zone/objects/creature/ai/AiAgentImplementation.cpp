@@ -97,9 +97,27 @@
 // #define SHOW_NEXT_POSITION
 // #define DEBUG_FINDNEXTPOSITION
 
+namespace {
+	// Longest dormancy recovered on wake up, AI regenerate their whole HAM in 5 minutes
+	const uint64 MAX_RECOVERY_CATCH_UP = 600000;
+
+	bool isRecoveryDormancyEnabled() {
+#ifdef DEBUG_AI
+		if (ConfigManager::instance()->getAiAgentLoadTesting())
+			return false;
+#endif // DEBUG_AI
+
+		const static bool enabled = ConfigManager::instance()->getBool("Core3.AiAgent.RecoveryDormancy", true);
+
+		return enabled;
+	}
+}
+
 void AiAgentImplementation::initializeTransientMembers() {
 	CreatureObjectImplementation::initializeTransientMembers();
 
+	recoveryDormant = false;
+
 	auto aiLogLevel = ConfigManager::instance()->getInt("Core3.AiAgent.LogLevel", LogLevel::WARNING);
 
 	if (aiLogLevel >= 0) {
@@ -123,6 +141,8 @@ void AiAgentImplementation::initializeTransientMembers() {
 
 	setLoggingName("AiAgent");
 
+	pathRequestState = PATHREQUEST_NONE;
+
 	setAITemplate();
 	setupAttackMaps();
 }
@@ -673,7 +693,7 @@ void AiAgentImplementation::respawn(Zone* zone, int level) {
 
 					Vector3 formationOffset(x, y, 0);
 
-					writeBlackboard("formationOffset", formationOffset);
+					writeBlackboard(BlackboardKey::FORMATIONOFFSET, formationOffset);
 				}
 			}
 		}
@@ -1441,7 +1461,7 @@ bool AiAgentImplementation::selectSpecialAttack(int attackNum) {
 
 	if (attackMap == nullptr) {
 #ifdef DEBUG_AI
-		if (peekBlackboard("aiDebug") && readBlackboard("aiDebug") == true)
+		if (peekBlackboard(BlackboardKey::AIDEBUG) && readBlackboard(BlackboardKey::AIDEBUG) == true)
 			info("attackMap == nullptr", true);
 #endif // DEBUG_AI
 		return false;
@@ -1453,7 +1473,7 @@ bool AiAgentImplementation::selectSpecialAttack(int attackNum) {
 
 	if (attackNum >= attackMap->size()) {
 #ifdef DEBUG_AI
-		if (peekBlackboard("aiDebug") && readBlackboard("aiDebug") == true)
+		if (peekBlackboard(BlackboardKey::AIDEBUG) && readBlackboard(BlackboardKey::AIDEBUG) == true)
 			info("attackNum >= attackMap->size()", true);
 #endif // DEBUG_AI
 		return false;
@@ -1463,7 +1483,7 @@ bool AiAgentImplementation::selectSpecialAttack(int attackNum) {
 
 	if (cmd.isEmpty()) {
 #ifdef DEBUG_AI
-		if (peekBlackboard("aiDebug") && readBlackboard("aiDebug") == true)
+		if (peekBlackboard(BlackboardKey::AIDEBUG) && readBlackboard(BlackboardKey::AIDEBUG) == true)
 			info("cmd.isEmpty()", true);
 #endif // DEBUG_AI
 		return false;
@@ -1928,7 +1948,7 @@ void AiAgentImplementation::leash(bool forcePeace) {
 	homeLocation.setReached(false);
 	setMovementState(AiAgent::LEASHING);
 
-	eraseBlackboard("targetProspect");
+	eraseBlackboard(BlackboardKey::TARGETPROSPECT);
 
 	clearQueueActions(true);
 	clearDots();
@@ -2200,6 +2220,10 @@ void AiAgentImplementation::notifyInsert(TreeEntry* entry) {
 	if (creo != nullptr && !creo->isInvisible() && creo->isPlayerCreature()) {
 		int newValue = (int) numberOfPlayersInRange.increment();
 		activateAiBehavior();
+
+		// Catches up the recovery missed while nobody was around
+		if (recoveryDormant)
+			activateRecovery();
 	}
 }
 
@@ -2428,14 +2452,51 @@ void AiAgentImplementation::activateRecovery() {
 		return;
 	}
 
+	bool dormant = canRecoveryBeDormant();
+
 	Locker tLock(&recoveryEventMutex);
 
+	if (dormant) {
+		if (!recoveryDormant) {
+			recoveryDormant = true;
+			recoveryDormantSince.updateToCurrentTime();
+
+			AiMap::instance()->dormantRecoveries.increment();
+		}
+
+		return;
+	}
+
+	uint64 catchUpLatency = 0;
+
+	if (recoveryDormant) {
+		recoveryDormant = false;
+		catchUpLatency = Math::min((uint64) recoveryDormantSince.miliDifference(), MAX_RECOVERY_CATCH_UP);
+
+		AiMap::instance()->dormantRecoveries.decrement();
+	}
+
 	if (recoveryEvent == nullptr) {
 		recoveryEvent = new AiRecoveryEvent(asAiAgent());
+		recoveryEvent->addCatchUpLatency(catchUpLatency);
 
 		recoveryEvent->schedule(2000);
-	} else if (!recoveryEvent->isScheduled())
-		recoveryEvent->schedule(2000);
+	} else {
+		recoveryEvent->addCatchUpLatency(catchUpLatency);
+
+		if (!recoveryEvent->isScheduled())
+			recoveryEvent->schedule(2000);
+	}
+}
+
+bool AiAgentImplementation::canRecoveryBeDormant() {
+	if (!isRecoveryDormancyEnabled() || numberOfPlayersInRange.get() > 0)
+		return false;
+
+	if (isPet() || isRetreating() || getFollowObject().get() != nullptr)
+		return false;
+
+	return defenderList.size() == 0 && !damageOverTimeList.hasDot() && !isInCombat();
 }
 
 void AiAgentImplementation::activatePostureRecovery() {
@@ -2469,7 +2530,7 @@ void AiAgentImplementation::activatePostureRecovery() {
 
 	// Lying down and sitting, should clear when in combat or if their movement state changes
 	if ((isLyingDown() || isSitting()) && (getMovementState() != AiAgent::RESTING || isInCombat())) {
-		eraseBlackboard("restingTime");
+		eraseBlackboard(BlackboardKey::RESTINGTIME);
 		restDelay.updateToCurrentTime();
 
 		enqueueCommand(STRING_HASHCODE("stand"), 0, 0, "");
@@ -2581,13 +2642,74 @@ void AiAgentImplementation::checkNewAngle() {
  * patrolPoint in their queue. If false, the point is either out of movement
  * range or they have reached their maxDistance to the point.
 */
+bool AiAgentImplementation::updateFoundPath(const WorldCoordinates& start, const WorldCoordinates& goal) {
+	PathFinderManager* pathFinder = PathFinderManager::instance();
+
+	if (!pathFinder->isAsyncPathingEnabled()) {
+		currentFoundPath = static_cast<CurrentFoundPath*>(pathFinder->findPath(start, goal, getZoneUnsafe()));
+
+		return true;
+	}
+
+	if (pathRequestState == PATHREQUEST_PENDING)
+		return false;
+
+	if (pathRequestState == PATHREQUEST_DONE) {
+		Reference<CurrentFoundPath*> result = asyncFoundPath;
+
+		asyncFoundPath = nullptr;
+		pathRequestState = PATHREQUEST_NONE;
+
+		if (result == nullptr || result->size() < 2) {
+			currentFoundPath = nullptr;
+
+			return true;
+		}
+
+		// The destination may have changed while the path was searched
+		const WorldCoordinates& end = result->get(result->size() - 1);
+
+		if (end.getCell() == goal.getCell() && end.getWorldPosition().squaredDistanceTo(goal.getWorldPosition()) <= 4 * 4) {
+			currentFoundPath = result;
+
+			return true;
+		}
+	}
+
+	ManagedWeakReference<AiAgent*> weakAgent = asAiAgent();
+
+	Reference<Vector<WorldCoordinates>*> cachedPath = pathFinder->findPathAsync(start, goal, getZoneUnsafe(), [weakAgent] (Reference<Vector<WorldCoordinates>*> path) {
+		ManagedReference<AiAgent*> agent = weakAgent.get();
+
+		if (agent != nullptr)
+			agent->setAsyncFoundPath(static_cast<CurrentFoundPath*>(path.get()));
+	});
+
+	if (cachedPath != nullptr) {
+		currentFoundPath = static_cast<CurrentFoundPath*>(cachedPath.get());
+
+		return true;
+	}
+
+	pathRequestState = PATHREQUEST_PENDING;
+
+	return false;
+}
+
+void AiAgentImplementation::setAsyncFoundPath(CurrentFoundPath* path) {
+	Locker locker(&targetMutex);
+
+	asyncFoundPath = path;
+	pathRequestState = PATHREQUEST_DONE;
+}
+
 bool AiAgentImplementation::findNextPosition(float maxDistance, bool walk) {
 	/*
 	 * SETUP: Check speed and posture before attempting to find a path
 	 */
 
 #ifdef DEBUG_AI
-	if (peekBlackboard("aiDebug") && readBlackboard("aiDebug") == true)
+	if (peekBlackboard(BlackboardKey::AIDEBUG) && readBlackboard(BlackboardKey::AIDEBUG) == true)
 		info("findNextPosition(" + String::valueOf(maxDistance) + ", " + String::valueOf(walk) + ")", true);
 #endif // DEBUG_AI
 
@@ -2646,6 +2768,10 @@ bool AiAgentImplementation::findNextPosition(float maxDistance, bool walk) {
 		setCurrentSpeed(0.f);
 		updateLocomotion();
 
+		// Players in the far interest tiers might have missed the last steps
+		if (isMovementThrottled())
+			broadcastNextPositionUpdate(nullptr);
+
 		return false;
 	}
 
@@ -2700,7 +2826,10 @@ bool AiAgentImplementation::findNextPosition(float maxDistance, bool walk) {
 			currentPoint.setCell(currentParent.castTo<CellObject*>());
 		}
 
-		path = currentFoundPath = static_cast<CurrentFoundPath*>(pathFinder->findPath(currentPoint.getCoordinates(), endMovementCoords, getZoneUnsafe()));
+		if (!updateFoundPath(currentPoint.getCoordinates(), endMovementCoords))
+			return true;
+
+		path = currentFoundPath;
 	} else {
 		if (currentParent != nullptr && !currentParent->isCellObject()) {
 			currentParent = nullptr;
@@ -2709,7 +2838,11 @@ bool AiAgentImplementation::findNextPosition(float maxDistance, bool walk) {
 		if ((movementState == AiAgent::FOLLOWING || movementState == AiAgent::PATHING_HOME || movementState == AiAgent::NOTIFY_ALLY || movementState == AiAgent::MOVING_TO_HEAL || movementState == AiAgent::WATCHING || movementState == AiAgent::CRACKDOWN_SCANNING || movementState == AiAgent::LAIR_HEALING)
 			&& endMovementCell == nullptr && currentParent == nullptr && currentFoundPath->get(currentFoundPath->size() - 1).getWorldPosition().squaredDistanceTo(endMovementCoords.getWorldPosition()) > 4 * 4) {
 
-			path = currentFoundPath = static_cast<CurrentFoundPath*>(pathFinder->findPath(currentPoint.getCoordinates(), endMovementPosition.getCoordinates(), getZoneUnsafe()));
+			// Keep walking the old path until the new one is found
+			if (!updateFoundPath(currentPoint.getCoordinates(), endMovementCoords))
+				currentFoundPath->set(0, WorldCoordinates(currentPosition, currentParent.castTo<CellObject*>()));
+
+			path = currentFoundPath;
 		} else {
 			currentFoundPath->set(0, WorldCoordinates(currentPosition, currentParent.castTo<CellObject*>()));
 			path = currentFoundPath;
@@ -2930,7 +3063,7 @@ bool AiAgentImplementation::findNextPosition(float maxDistance, bool walk) {
 	}
 
 #ifdef DEBUG_AI
-	if (peekBlackboard("aiDebug") && readBlackboard("aiDebug") == true)
+	if (peekBlackboard(BlackboardKey::AIDEBUG) && readBlackboard(BlackboardKey::AIDEBUG) == true)
 		info("findNextPosition - complete returning true", true);
 #endif // DEBUG_AI
 
@@ -3000,7 +3133,7 @@ void AiAgentImplementation::runBehaviorTree() {
 #ifdef DEBUG_AI
 		bool alwaysActive = ConfigManager::instance()->getAiAgentLoadTesting();
 
-		bool sendDebug = peekBlackboard("aiDebug") && readBlackboard("aiDebug") == true;
+		bool sendDebug = peekBlackboard(BlackboardKey::AIDEBUG) && readBlackboard(BlackboardKey::AIDEBUG) == true;
 
 		if (sendDebug) {
 			printf("\n\n\n");
@@ -3051,14 +3184,14 @@ void AiAgentImplementation::runBehaviorTree() {
 
 void AiAgentImplementation::setAIDebug(bool flag) {
 #ifdef DEBUG_AI
-	writeBlackboard("aiDebug", flag);
+	writeBlackboard(BlackboardKey::AIDEBUG, flag);
 #endif // DEBUG_AI
 	info() << "setAIDebug(" << flag << ")";
 
 	if (flag) {
 		setLogLevel(LogLevel::DEBUG);
 		debug() << "setAIDebug(" << flag << ")";
-		debug() << "behaviorEvent->isScheduled = " << (behaviorEvent != nullptr ? behaviorEvent->isScheduled() : -1);
+		debug() << "behaviorEvent->isScheduled = " << (behaviorEvent != nullptr ? behaviorEvent->isBehaviorScheduled() : -1);
 		debug() << "recoveryEvent->isScheduled = " << (recoveryEvent != nullptr ? recoveryEvent->isScheduled() : -1);
 		debug() << "primaryAttackMap.size = " << (primaryAttackMap != nullptr ? primaryAttackMap->size() : -1);
 		debug() << "secondaryAttackMap.size = " << (secondaryAttackMap != nullptr ? secondaryAttackMap->size() : -1);
@@ -3085,7 +3218,7 @@ void AiAgentImplementation::setAIDebug(bool flag) {
 
 bool AiAgentImplementation::getAIDebug() {
 #ifdef DEBUG_AI
-	return peekBlackboard("aiDebug") && readBlackboard("aiDebug") == true;
+	return peekBlackboard(BlackboardKey::AIDEBUG) && readBlackboard(BlackboardKey::AIDEBUG) == true;
 #else // DEBUG_AI
 	return getLogLevel() >= LogLevel::DEBUG;
 #endif // DEBUG_AI
@@ -3268,8 +3401,8 @@ float AiAgentImplementation::getMaxDistance() {
 			return 0.1f;
 		case AiAgent::STALKING: {
 			int stalkRad = 0;
-			if (peekBlackboard("stalkRadius"))
-				stalkRad = readBlackboard("stalkRadius").get<int>() / 5;
+			if (peekBlackboard(BlackboardKey::STALKRADIUS))
+				stalkRad = readBlackboard(BlackboardKey::STALKRADIUS).get<int>() / 5;
 
 			return stalkRad > 0 ? stalkRad : 10;
 		}
@@ -3280,7 +3413,7 @@ float AiAgentImplementation::getMaxDistance() {
 			if (!checkLineOfSight(followCopy)) {
 				return 1.0f;
 			} else if (!isInCombat()) {
-				if (peekBlackboard("formationOffset")) {
+				if (peekBlackboard(BlackboardKey::FORMATIONOFFSET)) {
 					if (isPet()) {
 						return 0.1f;
 					} else {
@@ -3306,7 +3439,7 @@ float AiAgentImplementation::getMaxDistance() {
 				if (currentWeap != nullptr) {
 					weaponIdealRange = Math::max(2.0f, (Math::min(currentWeap->getIdealRange(), currentWeap->getMaxRange()) + getTemplateRadius() + followCopy->getTemplateRadius()));
 #ifdef DEBUG_AI
-					if (peekBlackboard("aiDebug") && readBlackboard("aiDebug") == true) {
+					if (peekBlackboard(BlackboardKey::AIDEBUG) && readBlackboard(BlackboardKey::AIDEBUG) == true) {
 						info(true) << "AiAgentImplementation::getMaxDistance() -- weaponIdealRange: " << weaponIdealRange << " primaryWeapon: " << currentWeap->getDisplayedName() << " Current Weapon ID: " << currentWeap->getObjectID();
 					}
 #endif // DEBUG_AI
@@ -3370,7 +3503,7 @@ int AiAgentImplementation::setDestination() {
 		int64 fleeDiff = (fleeDelay.miliDifference() / 4) * -1;
 
 		if (fleeDiff < 1500) {
-			eraseBlackboard("fleeRange");
+			eraseBlackboard(BlackboardKey::FLEERANGE);
 			setMovementState(AiAgent::FOLLOWING);
 
 			break;
@@ -3451,8 +3584,8 @@ int AiAgentImplementation::setDestination() {
 
 		PatrolPoint nextPos = followCopy->getPosition();
 
-		if (peekBlackboard("formationOffset") && !isInCombat()) {
-			Vector3 formationOffset = readBlackboard("formationOffset").get<Vector3>();
+		if (peekBlackboard(BlackboardKey::FORMATIONOFFSET) && !isInCombat()) {
+			Vector3 formationOffset = readBlackboard(BlackboardKey::FORMATIONOFFSET).get<Vector3>();
 
 			float directionAngle = followCopy->getDirection()->getRadians();
 			float xRotated = (formationOffset.getX() * Math::cos(directionAngle) + formationOffset.getY() * Math::sin(directionAngle));
@@ -3495,7 +3628,7 @@ int AiAgentImplementation::setDestination() {
 		break;
 	}
 	case AiAgent::MOVING_TO_HEAL: {
-		if (!peekBlackboard("healTarget")) {
+		if (!peekBlackboard(BlackboardKey::HEALTARGET)) {
 			if (!isWaiting()) {
 				if (followCopy != nullptr) {
 					setMovementState(AiAgent::FOLLOWING);
@@ -3504,7 +3637,7 @@ int AiAgentImplementation::setDestination() {
 				}
 			}
 		} else {
-			ManagedReference<TangibleObject*> healTarget = readBlackboard("healTarget").get<ManagedReference<TangibleObject*> >().get();
+			ManagedReference<TangibleObject*> healTarget = readBlackboard(BlackboardKey::HEALTARGET).get<ManagedReference<TangibleObject*> >().get();
 
 			if (healTarget != nullptr) {
 				clearPatrolPoints();
@@ -3542,7 +3675,7 @@ int AiAgentImplementation::setDestination() {
 		break;
 	}
 	case AiAgent::LAIR_HEALING: {
-		if (!peekBlackboard("healTarget")) {
+		if (!peekBlackboard(BlackboardKey::HEALTARGET)) {
 			if (!isWaiting()) {
 				if (followCopy != nullptr) {
 					setMovementState(AiAgent::FOLLOWING);
@@ -3551,7 +3684,7 @@ int AiAgentImplementation::setDestination() {
 				}
 			}
 		} else {
-			ManagedReference<TangibleObject*> healTarget = readBlackboard("healTarget").get<ManagedReference<TangibleObject*> >().get();
+			ManagedReference<TangibleObject*> healTarget = readBlackboard(BlackboardKey::HEALTARGET).get<ManagedReference<TangibleObject*> >().get();
 
 			if (healTarget != nullptr) {
 				// Clear current patrol points
@@ -3585,8 +3718,8 @@ void AiAgentImplementation::setWait(uint64 wait) {
 }
 
 void AiAgentImplementation::stopWaiting() {
-	if (peekBlackboard("isWaiting")) {
-		eraseBlackboard("isWaiting");
+	if (peekBlackboard(BlackboardKey::ISWAITING)) {
+		eraseBlackboard(BlackboardKey::ISWAITING);
 	}
 
 	cooldownTimerMap->updateToCurrentTime("waitTimer");
@@ -3777,7 +3910,7 @@ void AiAgentImplementation::activateAiBehavior(bool reschedule) {
 	} else {
 		if (reschedule) {
 			try {
-				if (!behaviorEvent->isScheduled())
+				if (!behaviorEvent->isBehaviorScheduled())
 					behaviorEvent->schedule(Math::max(10, nextBehaviorInterval));
 			} catch (IllegalArgumentException& e) {
 			}
@@ -3794,8 +3927,8 @@ void AiAgentImplementation::cancelBehaviorEvent() {
 		return;
 	}
 
-	if (behaviorEvent->isScheduled())
-		behaviorEvent->cancel();
+	if (behaviorEvent->isBehaviorScheduled())
+		behaviorEvent->cancelBehavior();
 
 	behaviorEvent->clearCreatureObject();
 	behaviorEvent = nullptr;
@@ -3804,6 +3937,12 @@ void AiAgentImplementation::cancelBehaviorEvent() {
 void AiAgentImplementation::cancelRecoveryEvent() {
 	Locker locker(&recoveryEventMutex);
 
+	if (recoveryDormant) {
+		recoveryDormant = false;
+
+		AiMap::instance()->dormantRecoveries.decrement();
+	}
+
 	if (recoveryEvent == nullptr) {
 		return;
 	}
@@ -3850,7 +3989,7 @@ void AiAgentImplementation::broadcastNextPositionUpdate(PatrolPoint* point) {
 		}
 	}
 
- 	broadcastMessage(msg, false);
+	broadcastMovementMessage(msg, point != nullptr);
 }
 
 int AiAgentImplementation::notifyObjectDestructionObservers(TangibleObject* attacker, int condition, bool isCombatAction) {
@@ -4706,8 +4845,7 @@ bool AiAgentImplementation::isPet() const {
 	return (getControlDevice() != nullptr);
 }
 
-void AiAgentImplementation::writeBlackboard(const String& key, const BlackboardData& data) {
-	blackboard.drop(key);
+void AiAgentImplementation::writeBlackboard(uint32 key, const BlackboardData& data) {
 	blackboard.put(key, data);
 }
 
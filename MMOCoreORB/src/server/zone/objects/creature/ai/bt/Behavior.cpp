@@ -14,21 +14,10 @@
 
 #ifdef DEBUG_AI
 namespace {
-static Logger logger("AiAgent::Behavior", Logger::INFO);
 bool getAiAgentDebugVerbose() {
-	static Mutex mutext;
-	Locker guard(&mutext);
-	static bool cachedValue = false;
-	static int cachedConfigVersion = 0;
-	int currentConfigVersion = ConfigManager::instance()->getConfigVersion();
-
-	if (currentConfigVersion > cachedConfigVersion) {
-		cachedConfigVersion = currentConfigVersion;
-		cachedValue = ConfigManager::instance()->getBool("Core3.AiAgent.Verbose", false);
-		logger.info(true) << "Core3.AiAgent.Verbose=" << cachedValue;
-	}
+	static ConfigHandle<bool> verbose("Core3.AiAgent.Verbose", false);
 
-	return cachedValue;
+	return verbose.get();
 }
 } // namespace
 #endif // DEBUG_AI
@@ -66,7 +55,7 @@ bool Behavior::checkConditions(AiAgent* agent) const {
 
 Behavior::Status Behavior::doAction(AiAgent* agent) const {
 #ifdef DEBUG_AI
-	if (agent->peekBlackboard("aiDebug") && agent->readBlackboard("aiDebug") == true) {
+	if (agent->peekBlackboard(BlackboardKey::AIDEBUG) && agent->readBlackboard(BlackboardKey::AIDEBUG) == true) {
 		StringBuffer msg;
 
 		msg << "0x" << hex << id << " " << print().toCharArray();
@@ -100,7 +89,7 @@ Behavior::Status Behavior::doAction(AiAgent* agent) const {
 	Behavior::Status result = this->execute(agent);
 
 #ifdef DEBUG_AI
-	if (agent->peekBlackboard("aiDebug") && agent->readBlackboard("aiDebug") == true) {
+	if (agent->peekBlackboard(BlackboardKey::AIDEBUG) && agent->readBlackboard(BlackboardKey::AIDEBUG) == true) {
 		StringBuffer msg;
 		msg << "0x" << hex << id << " " << print() << " result: " << result;
 
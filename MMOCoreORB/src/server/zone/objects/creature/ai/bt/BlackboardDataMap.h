@@ -1,8 +1,8 @@
 #ifndef BLACKBOARDDATAMAP_H_
 #define BLACKBOARDDATAMAP_H_
 
-#include "system/util/VectorMap.h"
 #include "BlackboardData.h"
+#include "BlackboardKey.h"
 
 namespace server {
 namespace zone {
@@ -11,14 +11,24 @@ namespace creature {
 namespace ai {
 namespace bt {
 
-class BlackboardDataMap : public VectorMap<String, BlackboardData> {
+/**
+ * Blackboard of an agent, a flat array indexed by the key slots. Keys named
+ * by tree templates are interned when AiMap loads them, so every slot a
+ * behavior uses is below MAX_KEYS.
+ */
+class BlackboardDataMap {
+	BlackboardData values[BlackboardKey::MAX_KEYS];
+
+	// Bit per slot holding a value
+	uint32 present;
+
 public:
-	BlackboardDataMap() {
-		setNoDuplicateInsertPlan();
+	BlackboardDataMap() : present(0) {
 	}
 
-	BlackboardDataMap(const BlackboardDataMap& b) : VectorMap<String, BlackboardData>(b) {
-		setNoDuplicateInsertPlan();
+	BlackboardDataMap(const BlackboardDataMap& b) : present(b.present) {
+		for (int i = 0; i < BlackboardKey::MAX_KEYS; ++i)
+			values[i] = b.values[i];
 	}
 
 	~BlackboardDataMap() {}
@@ -27,11 +37,49 @@ public:
 		if (this == &b)
 			return *this;
 
-		VectorMap<String, BlackboardData>::operator=(b);
-		setNoDuplicateInsertPlan();
+		for (int i = 0; i < BlackboardKey::MAX_KEYS; ++i)
+			values[i] = b.values[i];
+
+		present = b.present;
 
 		return *this;
 	}
+
+	inline bool contains(uint32 slot) const {
+		return slot < BlackboardKey::MAX_KEYS && (present & (1u << slot));
+	}
+
+	inline BlackboardData get(uint32 slot) const {
+		if (!contains(slot))
+			return BlackboardData();
+
+		return values[slot];
+	}
+
+	inline void put(uint32 slot, const BlackboardData& data) {
+		if (slot >= BlackboardKey::MAX_KEYS) {
+			Logger::console.error() << "BlackboardDataMap: write to invalid blackboard slot " << slot << " dropped";
+			return;
+		}
+
+		values[slot] = data;
+		present |= (1u << slot);
+	}
+
+	inline void drop(uint32 slot) {
+		if (!contains(slot))
+			return;
+
+		values[slot] = BlackboardData();
+		present &= ~(1u << slot);
+	}
+
+	void removeAll() {
+		for (uint32 slot = 0; present != 0; ++slot, present >>= 1) {
+			if (present & 1)
+				values[slot] = BlackboardData();
+		}
+	}
 };
 
 }
@@ -0,0 +1,81 @@
+#include "server/zone/objects/creature/ai/bt/BlackboardKey.h"
+
+BlackboardKeyRegistry::BlackboardKeyRegistry() : Logger("BlackboardKeyRegistry") {
+	slots.setNoDuplicateInsertPlan();
+	slots.setNullValue(BlackboardKey::INVALID);
+
+	// Must follow the order of BlackboardKey
+	const char* builtinNames[] = {
+		"aiDebug",
+		"aggroMod",
+		"allyProspect",
+		"allyTarget",
+		"attackType",
+		"fleeRange",
+		"followRange",
+		"formationOffset",
+		"harvestTarget",
+		"healTarget",
+		"isWaiting",
+		"moveMode",
+		"refireInterval",
+		"restingTime",
+		"stagedWeapon",
+		"stalkRadius",
+		"targetProspect",
+	};
+
+	static_assert(sizeof(builtinNames) / sizeof(builtinNames[0]) == BlackboardKey::BUILTIN_COUNT, "missing built-in blackboard key name");
+
+	for (uint32 i = 0; i < BlackboardKey::BUILTIN_COUNT; ++i) {
+		slots.put(builtinNames[i], i);
+		names.add(builtinNames[i]);
+	}
+}
+
+uint32 BlackboardKeyRegistry::intern(const String& name) {
+	uint32 slot = find(name);
+
+	if (slot != BlackboardKey::INVALID)
+		return slot;
+
+	Locker locker(&lock);
+
+	slot = slots.get(name);
+
+	if (slot != BlackboardKey::INVALID)
+		return slot;
+
+	if (names.size() >= BlackboardKey::MAX_KEYS) {
+		error() << "no free blackboard slot for key " << name;
+		return BlackboardKey::INVALID;
+	}
+
+	slot = names.size();
+
+	slots.put(name, slot);
+	names.add(name);
+
+	return slot;
+}
+
+uint32 BlackboardKeyRegistry::find(const String& name) const {
+	ReadLocker locker(&lock);
+
+	return slots.get(name);
+}
+
+String BlackboardKeyRegistry::getName(uint32 slot) const {
+	ReadLocker locker(&lock);
+
+	if (slot >= (uint32) names.size())
+		return "";
+
+	return names.get(slot);
+}
+
+int BlackboardKeyRegistry::size() const {
+	ReadLocker locker(&lock);
+
+	return names.size();
+}
@@ -0,0 +1,84 @@
+#ifndef BLACKBOARDKEY_H_
+#define BLACKBOARDKEY_H_
+
+#include "engine/engine.h"
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace creature {
+namespace ai {
+namespace bt {
+
+/**
+ * Blackboard slots of the keys used by the built-in behaviors. Keys only
+ * named by behavior tree templates get the slots after BUILTIN_COUNT when
+ * the trees are loaded.
+ */
+namespace BlackboardKey {
+enum : uint32 {
+	AIDEBUG,
+	AGGROMOD,
+	ALLYPROSPECT,
+	ALLYTARGET,
+	ATTACKTYPE,
+	FLEERANGE,
+	FOLLOWRANGE,
+	FORMATIONOFFSET,
+	HARVESTTARGET,
+	HEALTARGET,
+	ISWAITING,
+	MOVEMODE,
+	REFIREINTERVAL,
+	RESTINGTIME,
+	STAGEDWEAPON,
+	STALKRADIUS,
+	TARGETPROSPECT,
+	BUILTIN_COUNT,
+
+	MAX_KEYS = 32,
+	INVALID = 0xFFFFFFFF
+};
+
+static_assert(BUILTIN_COUNT <= MAX_KEYS, "the built-in blackboard keys don't fit in MAX_KEYS");
+}
+
+/**
+ * Maps blackboard key names to their slot.
+ */
+class BlackboardKeyRegistry : public Singleton<BlackboardKeyRegistry>, public Logger, public Object {
+	VectorMap<String, uint32> slots;
+	Vector<String> names;
+
+	mutable ReadWriteLock lock;
+
+public:
+	BlackboardKeyRegistry();
+
+	/**
+	 * Returns the slot of name, assigning it the next free one if it is new.
+	 * Only called by AiMap while it loads the tree templates.
+	 * @return BlackboardKey::INVALID when all slots are taken
+	 */
+	uint32 intern(const String& name);
+
+	/**
+	 * @return the slot of name or BlackboardKey::INVALID if it was never interned
+	 */
+	uint32 find(const String& name) const;
+
+	String getName(uint32 slot) const;
+
+	int size() const;
+};
+
+}
+}
+}
+}
+}
+}
+
+using namespace server::zone::objects::creature::ai::bt;
+
+#endif // BLACKBOARDKEY_H_
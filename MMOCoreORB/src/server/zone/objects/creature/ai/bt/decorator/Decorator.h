@@ -90,7 +90,7 @@ public:
 
 	Behavior::Status doAction(AiAgent* agent) const {
 #ifdef DEBUG_AI
-		if (agent->peekBlackboard("aiDebug") && agent->readBlackboard("aiDebug") == true) {
+		if (agent->peekBlackboard(BlackboardKey::AIDEBUG) && agent->readBlackboard(BlackboardKey::AIDEBUG) == true) {
 			StringBuffer msg;
 			msg << "0x" << hex << id << " " << print().toCharArray();
 
@@ -110,7 +110,7 @@ public:
 		Behavior::Status result = this->execute(agent);
 
 #ifdef DEBUG_AI
-		if (agent->peekBlackboard("aiDebug") && agent->readBlackboard("aiDebug") == true) {
+		if (agent->peekBlackboard(BlackboardKey::AIDEBUG) && agent->readBlackboard(BlackboardKey::AIDEBUG) == true) {
 			StringBuffer msg;
 
 			msg << "0x" << hex << id << " " << print() << " result: " << result;
@@ -37,11 +37,11 @@ public:
 
 		assert(child != nullptr);
 
-		if (agent->peekBlackboard("allyTarget")) {
-			ManagedReference<SceneObject*> currAlly = agent->readBlackboard("allyProspect").get<ManagedReference<SceneObject*> >().get();
+		if (agent->peekBlackboard(BlackboardKey::ALLYTARGET)) {
+			ManagedReference<SceneObject*> currAlly = agent->readBlackboard(BlackboardKey::ALLYPROSPECT).get<ManagedReference<SceneObject*> >().get();
 			if (currAlly != nullptr && currAlly->isCreatureObject()) {
 				if (isInvalidTarget(currAlly->asCreatureObject(), agent)) {
-					agent->eraseBlackboard("allyProspect");
+					agent->eraseBlackboard(BlackboardKey::ALLYPROSPECT);
 					return FAILURE;
 				} else {
 					return child->doAction(agent);
@@ -63,7 +63,7 @@ public:
 				continue;
 			}
 
-			agent->writeBlackboard("allyProspect", sceneTarget);
+			agent->writeBlackboard(BlackboardKey::ALLYPROSPECT, sceneTarget);
 
 			Behavior::Status result = child->doAction(agent);
 			if (result != FAILURE) {
@@ -53,7 +53,7 @@ public:
 			if (isInvalidTarget(sceneTarget->asCreatureObject(), agent))
 				continue;
 
-			agent->writeBlackboard("targetProspect", sceneTarget);
+			agent->writeBlackboard(BlackboardKey::TARGETPROSPECT, sceneTarget);
 
 			Behavior::Status result = child->doAction(agent);
 			if (result != FAILURE) {
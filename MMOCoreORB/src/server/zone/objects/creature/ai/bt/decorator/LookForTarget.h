@@ -51,7 +51,7 @@ public:
 				}
 				return FAILURE;
 			} else {
-				agent->writeBlackboard("targetProspect", currObj);
+				agent->writeBlackboard(BlackboardKey::TARGETPROSPECT, currObj);
 				return child->doAction(agent);
 			}
 		}
@@ -76,7 +76,7 @@ public:
 				continue;
 			}
 
-			agent->writeBlackboard("targetProspect", sceneO);
+			agent->writeBlackboard(BlackboardKey::TARGETPROSPECT, sceneO);
 
 			Behavior::Status result = child->doAction(agent);
 
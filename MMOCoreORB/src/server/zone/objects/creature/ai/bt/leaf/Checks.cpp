@@ -53,14 +53,14 @@ template<> bool CheckFollowHasState::check(AiAgent* agent) const {
 template<> bool CheckProspectInRange::check(AiAgent* agent) const {
 	ManagedReference<SceneObject*> tar = nullptr;
 
-	if (agent->peekBlackboard("targetProspect")) {
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT)) {
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 	}
 
 	if (checkVar > 0.f) {
 		return tar != nullptr && agent->isInRange(tar, checkVar);
-	} else if (tar != nullptr && agent->peekBlackboard("aggroMod")) {
-		float aggroMod = agent->readBlackboard("aggroMod").get<float>();
+	} else if (tar != nullptr && agent->peekBlackboard(BlackboardKey::AGGROMOD)) {
+		float aggroMod = agent->readBlackboard(BlackboardKey::AGGROMOD).get<float>();
 		float radius = agent->getAggroRadius();
 
 		if (radius == 0) {
@@ -87,8 +87,8 @@ template<> bool CheckFollowAggression::check(AiAgent* agent) const {
 
 template<> bool CheckProspectAggression::check(AiAgent* agent) const {
 	ManagedReference<SceneObject*> tar = nullptr;
-	if (agent->peekBlackboard("targetProspect"))
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	if (tar == nullptr || !tar->isCreatureObject())
 		return false;
@@ -101,8 +101,8 @@ template<> bool CheckProspectAggression::check(AiAgent* agent) const {
 template<> bool CheckIsCamouflaged::check(AiAgent* agent) const {
 	ManagedReference<SceneObject*> target = nullptr;
 
-	if (agent->peekBlackboard("targetProspect"))
-		target = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		target = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	if (target == nullptr || !target->isCreatureObject())
 		return false;
@@ -131,11 +131,11 @@ template<> bool CheckFollowPosture::check(AiAgent* agent) const {
 }
 
 template<> bool CheckFollowInWeaponRange::check(AiAgent* agent) const {
-	if (!agent->peekBlackboard("followRange")) {
+	if (!agent->peekBlackboard(BlackboardKey::FOLLOWRANGE)) {
 		return false;
 	}
 
-	float followRange = agent->readBlackboard("followRange").get<float>();
+	float followRange = agent->readBlackboard(BlackboardKey::FOLLOWRANGE).get<float>();
 
 	WeaponObject* weapon = nullptr;
 
@@ -152,7 +152,7 @@ template<> bool CheckFollowInWeaponRange::check(AiAgent* agent) const {
 	float maxRange = weapon->getMaxRange();
 
 #ifdef DEBUG_AI
-	if (agent->peekBlackboard("aiDebug") && agent->readBlackboard("aiDebug") == true) {
+	if (agent->peekBlackboard(BlackboardKey::AIDEBUG) && agent->readBlackboard(BlackboardKey::AIDEBUG) == true) {
 		agent->info(true) << "CheckFollowInWeaponRange -- followRange: " << followRange << " maxRange squared: " << (maxRange * maxRange);
 	}
 #endif // DEBUG_AI
@@ -161,11 +161,11 @@ template<> bool CheckFollowInWeaponRange::check(AiAgent* agent) const {
 }
 
 template<> bool CheckFollowClosestIdealRange::check(AiAgent* agent) const {
-	if (!agent->peekBlackboard("followRange")) {
+	if (!agent->peekBlackboard(BlackboardKey::FOLLOWRANGE)) {
 		return false;
 	}
 
-	float followRange = agent->readBlackboard("followRange").get<float>();
+	float followRange = agent->readBlackboard(BlackboardKey::FOLLOWRANGE).get<float>();
 
 	WeaponObject* primaryWeapon = nullptr;
 	WeaponObject* secondaryWeapon = nullptr;
@@ -190,7 +190,7 @@ template<> bool CheckFollowClosestIdealRange::check(AiAgent* agent) const {
 	float secondaryRange = secondaryWeapon->getIdealRange();
 
 #ifdef DEBUG_AI
-	if (agent->peekBlackboard("aiDebug") && agent->readBlackboard("aiDebug") == true)
+	if (agent->peekBlackboard(BlackboardKey::AIDEBUG) && agent->readBlackboard(BlackboardKey::AIDEBUG) == true)
 		agent->info(true) << "CheckFollowClosestIdealRange -- Follow Range: " << followRange << " primaryWeapon ideal range: " << primaryRange << " secondaryWeapon ideal range: " << secondaryRange;
 #endif // DEBUG_AI
 
@@ -234,8 +234,8 @@ template<> bool CheckAttackIsValid::check(AiAgent* agent) const {
 
 template<> bool CheckTargetIsValid::check(AiAgent* agent) const {
 	ManagedReference<SceneObject*> tar = nullptr;
-	if (agent->peekBlackboard("targetProspect"))
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	if (tar == nullptr)
 		return false;
@@ -296,8 +296,8 @@ template<> bool CheckSpeed::check(AiAgent* agent) const {
 
 template<> bool CheckProspectSpeed::check(AiAgent* agent) const {
 	ManagedReference<SceneObject*> tar = nullptr;
-	if (agent->peekBlackboard("targetProspect"))
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	if (tar == nullptr || !tar->isCreatureObject())
 		return false;
@@ -309,8 +309,8 @@ template<> bool CheckProspectSpeed::check(AiAgent* agent) const {
 
 template<> bool CheckProspectLOS::check(AiAgent* agent) const {
 	ManagedReference<SceneObject*> tar = nullptr;
-	if (agent->peekBlackboard("targetProspect"))
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	if (tar == nullptr)
 		return false;
@@ -326,8 +326,8 @@ template<> bool CheckOutdoors::check(AiAgent* agent) const {
 
 template<> bool CheckProspectLevel::check(AiAgent* agent) const {
 	ManagedReference<SceneObject*> tar = nullptr;
-	if (agent->peekBlackboard("targetProspect"))
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	if (tar == nullptr || !tar->isCreatureObject())
 		return false;
@@ -335,16 +335,16 @@ template<> bool CheckProspectLevel::check(AiAgent* agent) const {
 	CreatureObject* tarCreo = tar->asCreatureObject();
 
 	float aggroMod = 1.f;
-	if (agent->peekBlackboard("aggroMod"))
-		aggroMod = agent->readBlackboard("aggroMod").get<float>();
+	if (agent->peekBlackboard(BlackboardKey::AGGROMOD))
+		aggroMod = agent->readBlackboard(BlackboardKey::AGGROMOD).get<float>();
 
 	return agent->getLevel() * aggroMod < tarCreo->getLevel();
 }
 
 template<> bool CheckProspectBackAggression::check(AiAgent* agent) const {
 	ManagedReference<SceneObject*> tar = nullptr;
-	if (agent->peekBlackboard("targetProspect"))
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	if (tar == nullptr)
 		return false;
@@ -361,8 +361,8 @@ template<> bool CheckProspectBackAggression::check(AiAgent* agent) const {
 
 template<> bool CheckProspectFacing::check(AiAgent* agent) const {
 	ManagedReference<SceneObject*> tar = nullptr;
-	if (agent->peekBlackboard("targetProspect"))
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	if (tar == nullptr)
 		return false;
@@ -390,8 +390,8 @@ template<> bool CheckProspectIsCommand::check(AiAgent* agent) const {
 		return false;
 
 	ManagedReference<SceneObject*> tar = nullptr;
-	if (agent->peekBlackboard("targetProspect"))
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	return cd->getLastCommandTarget().get() == tar;
 }
@@ -406,8 +406,8 @@ template<> bool CheckHasPatrol::check(AiAgent* agent) const {
 
 template<> bool CheckProspectIsType::check(AiAgent* agent) const {
 	ManagedReference<SceneObject*> tar = nullptr;
-	if (agent->peekBlackboard("targetProspect"))
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	if (tar == nullptr)
 		return false;
@@ -454,8 +454,8 @@ template<> bool CheckIsType::check(AiAgent* agent) const {
 
 template<> bool CheckProspectJediTrial::check(AiAgent* agent) const {
 	ManagedReference<SceneObject*> tar = nullptr;
-	if (agent->peekBlackboard("targetProspect"))
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	if (tar == nullptr || !tar->isCreatureObject())
 		return false;
@@ -473,8 +473,8 @@ template<> bool CheckProspectJediTrial::check(AiAgent* agent) const {
 
 template<> bool CheckProspectIsIncapacitated::check(AiAgent* agent) const {
 	ManagedReference<SceneObject*> tar = nullptr;
-	if (agent->peekBlackboard("targetProspect"))
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	if (tar == nullptr || !tar->isCreatureObject())
 		return false;
@@ -518,8 +518,8 @@ template<> bool CheckTargetInOwnerRange::check(AiAgent* agent) const {
 		return false;
 
 	ManagedReference<SceneObject*> tar = nullptr;
-	if (agent->peekBlackboard("targetProspect"))
-		tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+	if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+		tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 	if (tar == nullptr)
 		return false;
@@ -630,11 +630,11 @@ template<> bool CheckCallForHelp::check(AiAgent* agent) const {
 	Time* packNotify = agent->getLastPackNotify();
 
 	if (packNotify == nullptr || !packNotify->isPast()) {
-		agent->eraseBlackboard("allyProspect");
+		agent->eraseBlackboard(BlackboardKey::ALLYPROSPECT);
 		return false;
 	}
 
-	if (agent->peekBlackboard("allyProspect")) {
+	if (agent->peekBlackboard(BlackboardKey::ALLYPROSPECT)) {
 		return true;
 	}
 
@@ -672,7 +672,7 @@ template<> bool CheckHasHarvestTargets::check(AiAgent* agent) const {
 	if (agent == nullptr || !agent->isDroid())
 		return false;
 
-	if (agent->peekBlackboard("harvestTarget"))
+	if (agent->peekBlackboard(BlackboardKey::HARVESTTARGET))
 		return true;
 
 	ManagedReference<DroidObject*> droid = cast<DroidObject*>(agent);
@@ -731,15 +731,15 @@ template<> bool CheckStopResting::check(AiAgent* agent) const {
 	// Default time to rest is 45s less the 5min set on the delay when set Resting in ms
 	int resting = 255 * 1000;
 
-	if (agent->peekBlackboard("restingTime"))
-		resting = agent->readBlackboard("restingTime").get<int>();
+	if (agent->peekBlackboard(BlackboardKey::RESTINGTIME))
+		resting = agent->readBlackboard(BlackboardKey::RESTINGTIME).get<int>();
 
 	int restedTime = restDelay->miliDifference() * -1;
 
 	if (resting < restedTime)
 		return false;
 
-	agent->eraseBlackboard("restingTime");
+	agent->eraseBlackboard(BlackboardKey::RESTINGTIME);
 
 	return true;
 }
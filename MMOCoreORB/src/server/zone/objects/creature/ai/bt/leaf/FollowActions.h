@@ -33,7 +33,7 @@ public:
 	}
 
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
-		agent->eraseBlackboard("targetProspect");
+		agent->eraseBlackboard(BlackboardKey::TARGETPROSPECT);
 
 		ManagedReference<SceneObject*> tar = agent->getThreatMap()->getHighestThreatAttacker();
 		if (tar == nullptr)
@@ -41,7 +41,7 @@ public:
 
 		Locker clocker(tar, agent);
 
-		agent->writeBlackboard("targetProspect", tar);
+		agent->writeBlackboard(BlackboardKey::TARGETPROSPECT, tar);
 
 		return SUCCESS;
 	}
@@ -58,7 +58,7 @@ public:
 	}
 
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
-		agent->eraseBlackboard("targetProspect");
+		agent->eraseBlackboard(BlackboardKey::TARGETPROSPECT);
 
 		ManagedReference<SceneObject*> tar = agent->getMainDefender();
 		if (tar == nullptr)
@@ -66,7 +66,7 @@ public:
 
 		Locker clocker(tar, agent);
 
-		agent->writeBlackboard("targetProspect", tar);
+		agent->writeBlackboard(BlackboardKey::TARGETPROSPECT, tar);
 
 		return SUCCESS;
 	}
@@ -108,7 +108,7 @@ public:
 
 		agent->sendReactionChat(target, ReactionManager::ALLY);
 
-		agent->writeBlackboard("targetProspect", target);
+		agent->writeBlackboard(BlackboardKey::TARGETPROSPECT, target);
 
 		return SUCCESS;
 	}
@@ -128,7 +128,7 @@ public:
 		if (agent == nullptr || !agent->isPet())
 			return FAILURE;
 
-		agent->eraseBlackboard("targetProspect");
+		agent->eraseBlackboard(BlackboardKey::TARGETPROSPECT);
 
 		Reference<PetControlDevice*> cd = agent->getControlDevice().castTo<PetControlDevice*>();
 		if (cd == nullptr)
@@ -140,7 +140,7 @@ public:
 
 		Locker clocker(tar, agent);
 
-		agent->writeBlackboard("targetProspect", tar);
+		agent->writeBlackboard(BlackboardKey::TARGETPROSPECT, tar);
 
 		return SUCCESS;
 	}
@@ -173,19 +173,19 @@ public:
 	}
 
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
-		if (!agent->peekBlackboard("targetProspect"))
+		if (!agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
 			return SUCCESS;
 
-		ManagedReference<SceneObject*> tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+		ManagedReference<SceneObject*> tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 		if (tar == nullptr) {
-			agent->eraseBlackboard("targetProspect");
+			agent->eraseBlackboard(BlackboardKey::TARGETPROSPECT);
 			return SUCCESS;
 		}
 
 		Locker clocker(tar, agent);
 
 		agent->removeDefender(tar);
-		agent->eraseBlackboard("targetProspect");
+		agent->eraseBlackboard(BlackboardKey::TARGETPROSPECT);
 
 		return agent->hasDefender(tar) ? FAILURE : SUCCESS;
 	}
@@ -200,12 +200,12 @@ public:
 	}
 
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
-		if (!agent->peekBlackboard("targetProspect"))
+		if (!agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
 			return FAILURE;
 
-		ManagedReference<SceneObject*> tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+		ManagedReference<SceneObject*> tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 		if (tar == nullptr) {
-			agent->eraseBlackboard("targetProspect");
+			agent->eraseBlackboard(BlackboardKey::TARGETPROSPECT);
 			return FAILURE;
 		}
 
@@ -226,14 +226,14 @@ public:
 	}
 
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
-		if (!agent->peekBlackboard("targetProspect")) {
+		if (!agent->peekBlackboard(BlackboardKey::TARGETPROSPECT)) {
 			return FAILURE;
 		}
 
-		ManagedReference<SceneObject*> tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+		ManagedReference<SceneObject*> tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 		if (tar == nullptr) {
-			agent->eraseBlackboard("targetProspect");
+			agent->eraseBlackboard(BlackboardKey::TARGETPROSPECT);
 			return FAILURE;
 		}
 
@@ -265,12 +265,12 @@ public:
 		float followRange = agent->getWorldPosition().squaredDistanceTo2d(followCopy->getWorldPosition()) - (followRadius * followRadius) - (agentRadius * agentRadius);
 
 #ifdef DEBUG_AI
-		if (agent->peekBlackboard("aiDebug") && agent->readBlackboard("aiDebug") == true) {
+		if (agent->peekBlackboard(BlackboardKey::AIDEBUG) && agent->readBlackboard(BlackboardKey::AIDEBUG) == true) {
 			agent->info(true) << "UpdateRangeToFollow -- followRange: " << followRange;
 		}
 #endif // DEBUG_AI
 
-		agent->writeBlackboard("followRange", BlackboardData(followRange));
+		agent->writeBlackboard(BlackboardKey::FOLLOWRANGE, BlackboardData(followRange));
 
 		return SUCCESS;
 	}
@@ -296,8 +296,8 @@ public:
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
 		ManagedReference<SceneObject*> tar = nullptr;
 
-		if (agent->peekBlackboard("targetProspect"))
-			tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+		if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+			tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 		if (tar == nullptr && !(agent->getCreatureBitmask() & ObjectFlag::FOLLOW) && (state == AiAgent::WATCHING || state == AiAgent::STALKING || state == AiAgent::FOLLOWING)) {
 			agent->setFollowObject(nullptr);
@@ -356,8 +356,8 @@ public:
 
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
 		ManagedReference<SceneObject*> tar = nullptr;
-		if (agent->peekBlackboard("targetProspect"))
-			tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*>>();
+		if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+			tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*>>();
 
 		if (tar == nullptr || !tar->isCreatureObject())
 			return FAILURE;
@@ -370,9 +370,9 @@ public:
 		float minMod = Math::min(1.f - (tarCreo->getLevel() - agent->getLevel()) / 8.f, 1.5f);
 		float mod = Math::max(0.75f, minMod);
 
-		agent->writeBlackboard("aggroMod", mod);
+		agent->writeBlackboard(BlackboardKey::AGGROMOD, mod);
 
-		return agent->peekBlackboard("aggroMod") ? SUCCESS : FAILURE;
+		return agent->peekBlackboard(BlackboardKey::AGGROMOD) ? SUCCESS : FAILURE;
 	}
 };
 
@@ -400,8 +400,8 @@ public:
 
 		ManagedReference<SceneObject*> tar = nullptr;
 
-		if (agent->peekBlackboard("targetProspect"))
-			tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+		if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+			tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 		if (tar == nullptr || !tar->isCreatureObject())
 			return FAILURE;
@@ -410,8 +410,8 @@ public:
 
 		float aggroMod = 1.f;
 
-		if (agent->peekBlackboard("aggroMod"))
-			aggroMod = agent->readBlackboard("aggroMod").get<float>();
+		if (agent->peekBlackboard(BlackboardKey::AGGROMOD))
+			aggroMod = agent->readBlackboard(BlackboardKey::AGGROMOD).get<float>();
 
 		int radius = agent->getAggroRadius();
 
@@ -427,7 +427,7 @@ public:
 			fleeDelay->addMiliTime(delay * 1000);
 		}
 
-		agent->writeBlackboard("fleeRange", distance);
+		agent->writeBlackboard(BlackboardKey::FLEERANGE, distance);
 		agent->runAway(tar->asCreatureObject(), distance, false);
 		agent->showFlyText("npc_reaction/flytext", "afraid", 0xFF, 0, 0);
 
@@ -522,8 +522,8 @@ public:
 
 		ManagedReference<SceneObject*> tar = nullptr;
 
-		if (agent->peekBlackboard("targetProspect"))
-			tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >();
+		if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+			tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >();
 
 		if (tar == nullptr || !tar->isCreatureObject())
 			return FAILURE;
@@ -614,8 +614,8 @@ public:
 
 		ManagedReference<SceneObject*> tar = nullptr;
 
-		if (agent->peekBlackboard("targetProspect"))
-			tar = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >().get();
+		if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+			tar = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >().get();
 
 		if (tar == nullptr)
 			return FAILURE;
@@ -625,9 +625,9 @@ public:
 		if (stalkRad == 0)
 			stalkRad = AiAgent::DEFAULTAGGRORADIUS;
 
-		float aggroMod = agent->readBlackboard("aggroMod").get<float>();
+		float aggroMod = agent->readBlackboard(BlackboardKey::AGGROMOD).get<float>();
 		stalkRad *= aggroMod * 2;
-		agent->writeBlackboard("stalkRadius", stalkRad);
+		agent->writeBlackboard(BlackboardKey::STALKRADIUS, stalkRad);
 
 		Locker clocker(tar, agent);
 
@@ -673,8 +673,8 @@ public:
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
 		ManagedReference<SceneObject*> target = nullptr;
 
-		if (agent->peekBlackboard("targetProspect"))
-			target = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >().get();
+		if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+			target = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >().get();
 
 		if (target != nullptr && target->isCreatureObject()) {
 			CreatureObject* targetCreo = target->asCreatureObject();
@@ -692,7 +692,7 @@ public:
 				float distance = System::random(20) + 25;
 
 				agent->clearQueueActions(true);
-				agent->writeBlackboard("fleeRange", distance);
+				agent->writeBlackboard(BlackboardKey::FLEERANGE, distance);
 
 				agent->runAway(targetCreo, distance, false);
 				return SUCCESS;
@@ -861,8 +861,8 @@ public:
 
 		ManagedReference<SceneObject*> targetProspect = nullptr;
 
-		if (agent->peekBlackboard("targetProspect")) {
-			targetProspect = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >().get();
+		if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT)) {
+			targetProspect = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >().get();
 		}
 
 		if (targetProspect == nullptr || !targetProspect->isCreatureObject()) {
@@ -898,7 +898,7 @@ public:
 		if (healTarget->getObjectID() == agent->getObjectID()) {
 			// agent->info(true) << "ID: " << agent->getObjectID() << " Agent setting self as heal target";
 
-			agent->writeBlackboard("healTarget", healTarget);
+			agent->writeBlackboard(BlackboardKey::HEALTARGET, healTarget);
 			return SUCCESS;
 		}
 
@@ -926,7 +926,7 @@ public:
 		agent->setMovementState(AiAgent::MOVING_TO_HEAL);
 
 		// This must set the Tangible Object as the target to heal
-		agent->writeBlackboard("healTarget", healTarget);
+		agent->writeBlackboard(BlackboardKey::HEALTARGET, healTarget);
 
 		// agent->info(true) << "ID: " << agent->getObjectID() << "    Set up a healTarget ---- " << healCreo->getDisplayedName();
 
@@ -1006,7 +1006,7 @@ public:
 
 		ManagedReference<SceneObject*> target = nullptr;
 
-		if (!agent->peekBlackboard("harvestTarget")) {
+		if (!agent->peekBlackboard(BlackboardKey::HARVESTTARGET)) {
 			if (!module->hasMoreTargets())
 				return FAILURE;
 
@@ -1019,7 +1019,7 @@ public:
 
 			target = zoneServer->getObject(targetID, true);
 		} else {
-			target = agent->readBlackboard("harvestTarget").get<ManagedReference<SceneObject*> >();
+			target = agent->readBlackboard(BlackboardKey::HARVESTTARGET).get<ManagedReference<SceneObject*> >();
 		}
 
 		if (target == nullptr || !target->isCreature())
@@ -1027,7 +1027,7 @@ public:
 
 		Locker cLocker(target, agent);
 
-		agent->writeBlackboard("harvestTarget", target);
+		agent->writeBlackboard(BlackboardKey::HARVESTTARGET, target);
 
 		CreatureObject* tarCreo = target->asCreatureObject();
 
@@ -1050,7 +1050,7 @@ public:
 		}
 
 		if (!tarCreo->isInRange(owner, 64.0f)) {
-			agent->eraseBlackboard("harvestTarget");
+			agent->eraseBlackboard(BlackboardKey::HARVESTTARGET);
 
 			agent->setFollowObject(owner);
 			agent->storeFollowObject();
@@ -1071,7 +1071,7 @@ public:
 		Reference<Task*> task = new DroidHarvestTask(module, tarCreo);
 		Core::getTaskManager()->executeTask(task);
 
-		agent->eraseBlackboard("harvestTarget");
+		agent->eraseBlackboard(BlackboardKey::HARVESTTARGET);
 
 		if (!module->hasMoreTargets()) {
 			agent->setFollowObject(owner);
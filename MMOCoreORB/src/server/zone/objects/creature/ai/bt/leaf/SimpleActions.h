@@ -126,10 +126,10 @@ public:
 	}
 
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
-		if (!agent->peekBlackboard("stagedWeapon"))
+		if (!agent->peekBlackboard(BlackboardKey::STAGEDWEAPON))
 			return FAILURE;
 
-		uint32 weapon = agent->readBlackboard("stagedWeapon").get<uint32>();
+		uint32 weapon = agent->readBlackboard(BlackboardKey::STAGEDWEAPON).get<uint32>();
 
 		if (weapon == DataVal::PRIMARYWEAPON) {
 			agent->equipPrimaryWeapon();
@@ -149,7 +149,7 @@ public:
 	}
 
 	WriteBlackboard(const WriteBlackboard& a)
-			: Behavior(a), key(a.key), val(a.val) {
+			: Behavior(a), key(a.key), slot(a.slot), val(a.val) {
 	}
 
 	WriteBlackboard& operator=(const WriteBlackboard& a) {
@@ -157,17 +157,19 @@ public:
 			return *this;
 		Behavior::operator=(a);
 		key = a.key;
+		slot = a.slot;
 		val = a.val;
 		return *this;
 	}
 
 	void parseArgs(const LuaObject& args) {
 		key = getArg<String>()(args, "key");
+		slot = BlackboardKeyRegistry::instance()->find(key);
 		val = getArg<uint32>()(args, "val");
 	}
 
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
-		agent->writeBlackboard(key, val);
+		agent->writeBlackboard(slot, val);
 
 		return SUCCESS;
 	}
@@ -181,18 +183,19 @@ public:
 
 private:
 	String key;
+	uint32 slot;
 	uint32 val;
 };
 
 class EraseBlackboard : public Behavior {
 public:
 	EraseBlackboard(const String& className, const uint32 id, const LuaObject& args)
-			: Behavior(className, id, args), param("") {
+			: Behavior(className, id, args), param(""), slot(BlackboardKey::INVALID) {
 		parseArgs(args);
 	}
 
 	EraseBlackboard(const EraseBlackboard& a)
-			: Behavior(a), param(a.param) {
+			: Behavior(a), param(a.param), slot(a.slot) {
 	}
 
 	EraseBlackboard& operator=(const EraseBlackboard& a) {
@@ -200,15 +203,17 @@ public:
 			return *this;
 		Behavior::operator=(a);
 		param = a.param;
+		slot = a.slot;
 		return *this;
 	}
 
 	void parseArgs(const LuaObject& args) {
 		param = getArg<String>()(args, "param");
+		slot = BlackboardKeyRegistry::instance()->find(param);
 	}
 
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
-		agent->eraseBlackboard(param);
+		agent->eraseBlackboard(slot);
 		return SUCCESS;
 	}
 
@@ -222,6 +227,7 @@ public:
 
 private:
 	String param;
+	uint32 slot;
 };
 
 class SelectAttack : public Behavior {
@@ -260,16 +266,16 @@ public:
 			return agent->selectSpecialAttack(-1) ? SUCCESS : FAILURE;
 		}
 
-		if (agent->peekBlackboard("attackType")) {
+		if (agent->peekBlackboard(BlackboardKey::ATTACKTYPE)) {
 			//agent->info("SelectAttack::execute has attackType", true);
 
-			if (agent->readBlackboard("attackType").get<uint32>() == static_cast<uint32>(DataVal::DEFAULT)) {
+			if (agent->readBlackboard(BlackboardKey::ATTACKTYPE).get<uint32>() == static_cast<uint32>(DataVal::DEFAULT)) {
 				//agent->info("SelectAttack::execute has attackType DEFAULT", true);
 
 				return agent->selectDefaultAttack() ? SUCCESS : FAILURE;
 			}
 
-			if (agent->readBlackboard("attackType").get<uint32>() == static_cast<uint32>(DataVal::RANDOM)) {
+			if (agent->readBlackboard(BlackboardKey::ATTACKTYPE).get<uint32>() == static_cast<uint32>(DataVal::RANDOM)) {
 				//agent->info("SelectAttack::execute has attackType RANDOM", true);
 
 				return agent->selectSpecialAttack(-1) ? SUCCESS : FAILURE;
@@ -341,8 +347,8 @@ public:
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
 		DataVal mode = DataVal::WALK;
 
-		if (agent->peekBlackboard("moveMode"))
-			mode = static_cast<DataVal>(agent->readBlackboard("moveMode").get<uint32>());
+		if (agent->peekBlackboard(BlackboardKey::MOVEMODE))
+			mode = static_cast<DataVal>(agent->readBlackboard(BlackboardKey::MOVEMODE).get<uint32>());
 
 		uint32 movementState = agent->getMovementState();
 
@@ -394,18 +400,18 @@ public:
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
 		// we don't need to check a value. Just checking to see if this value
 		// exists on the blackboard is fine since it can never be false
-		if (agent->peekBlackboard("isWaiting")) {
+		if (agent->peekBlackboard(BlackboardKey::ISWAITING)) {
 			if (agent->isWaiting() || duration < 0) { // < 0 means indefinite wait
 				return RUNNING;
 			} else {
-				agent->eraseBlackboard("isWaiting");
+				agent->eraseBlackboard(BlackboardKey::ISWAITING);
 
 				return SUCCESS;
 			}
 		}
 
 		agent->setWait((uint64) abs(duration));
-		agent->writeBlackboard("isWaiting", true);
+		agent->writeBlackboard(BlackboardKey::ISWAITING, true);
 
 		return RUNNING;
 	}
@@ -461,8 +467,8 @@ public:
 
 		ManagedReference<SceneObject*> target = nullptr;
 
-		if (agent->peekBlackboard("targetProspect"))
-			target = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >().get();
+		if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+			target = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >().get();
 
 		if (show && target != nullptr && target->isPlayerCreature()) {
 			agent->showFlyText("npc_reaction/flytext", "alert", 255, 0, 0);
@@ -522,8 +528,8 @@ public:
 
 			ManagedReference<SceneObject*> target = nullptr;
 
-			if (agent->peekBlackboard("targetProspect"))
-				target = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >().get();
+			if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+				target = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >().get();
 
 			if (target == nullptr)
 				return FAILURE;
@@ -573,8 +579,8 @@ public:
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
 		ManagedReference<SceneObject*> target = nullptr;
 
-		if (agent->peekBlackboard("targetProspect"))
-			target = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >().get();
+		if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+			target = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >().get();
 
 		if (target == nullptr)
 			return FAILURE;
@@ -627,13 +633,13 @@ public:
 
 		ManagedReference<TangibleObject*> healTarget = nullptr;
 
-		if (agent->peekBlackboard("healTarget")) {
-			healTarget = agent->readBlackboard("healTarget").get<ManagedReference<TangibleObject*> >().get();
+		if (agent->peekBlackboard(BlackboardKey::HEALTARGET)) {
+			healTarget = agent->readBlackboard(BlackboardKey::HEALTARGET).get<ManagedReference<TangibleObject*> >().get();
 		}
 
 		// Check if heal target exists
 		if (healTarget == nullptr) {
-			agent->eraseBlackboard("healTarget");
+			agent->eraseBlackboard(BlackboardKey::HEALTARGET);
 			agent->setMovementState(AiAgent::FOLLOWING);
 			return FAILURE;
 		}
@@ -653,7 +659,7 @@ public:
 			auto healTargetCreO = healTarget->asCreatureObject();
 
 			if (healTargetCreO == nullptr || healTargetCreO->isDead()) {
-				agent->eraseBlackboard("healTarget");
+				agent->eraseBlackboard(BlackboardKey::HEALTARGET);
 				agent->setMovementState(AiAgent::FOLLOWING);
 
 				return FAILURE;
@@ -678,7 +684,7 @@ public:
 			// agent->info(true) << "ID: " << agent->getObjectID() << " healTarget is a Tangible Object -- Target: " << healTarget->getDisplayedName();
 
 			if (healTarget->getZone() == nullptr || healTarget->getConditionDamage() < 1) {
-				agent->eraseBlackboard("healTarget");
+				agent->eraseBlackboard(BlackboardKey::HEALTARGET);
 				agent->setMovementState(AiAgent::FOLLOWING);
 
 				return FAILURE;
@@ -701,7 +707,7 @@ public:
 				healDelay->addMiliTime(20 * 1000);
 			}
 
-			agent->eraseBlackboard("healTarget");
+			agent->eraseBlackboard(BlackboardKey::HEALTARGET);
 		}
 
 		return SUCCESS;
@@ -734,8 +740,8 @@ public:
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
 		ManagedReference<SceneObject*> target = nullptr;
 
-		if (agent->peekBlackboard("targetProspect"))
-			target = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >().get();
+		if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+			target = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >().get();
 
 		if (target == nullptr || !target->isPlayerCreature()) {
 			return FAILURE;
@@ -794,18 +800,18 @@ public:
 	Behavior::Status execute(AiAgent* agent, unsigned int startIdx = 0) const {
 		ManagedReference<SceneObject*> ally = nullptr;
 
-		if (agent->peekBlackboard("allyProspect"))
-			ally = agent->readBlackboard("allyProspect").get<ManagedReference<SceneObject*> >().get();
+		if (agent->peekBlackboard(BlackboardKey::ALLYPROSPECT))
+			ally = agent->readBlackboard(BlackboardKey::ALLYPROSPECT).get<ManagedReference<SceneObject*> >().get();
 
 		if (ally == nullptr) {
-			agent->eraseBlackboard("allyProspect");
+			agent->eraseBlackboard(BlackboardKey::ALLYPROSPECT);
 			return FAILURE;
 		}
 
 		CreatureObject* allyCreo = ally->asCreatureObject();
 
 		if (allyCreo == nullptr || allyCreo->isDead() || !allyCreo->isAiAgent()) {
-			agent->eraseBlackboard("allyProspect");
+			agent->eraseBlackboard(BlackboardKey::ALLYPROSPECT);
 			return FAILURE;
 		}
 
@@ -817,7 +823,7 @@ public:
 		float sqrDistance = agentPosition.squaredDistanceTo(allyPosition);
 
 		if (sqrDistance > 50 * 50) {
-			agent->eraseBlackboard("allyProspect");
+			agent->eraseBlackboard(BlackboardKey::ALLYPROSPECT);
 			return FAILURE;
 		}
 
@@ -844,7 +850,7 @@ public:
 		AiAgent* allyAgent = allyCreo->asAiAgent();
 
 		if (allyAgent == nullptr) {
-			agent->eraseBlackboard("allyProspect");
+			agent->eraseBlackboard(BlackboardKey::ALLYPROSPECT);
 			return FAILURE;
 		}
 
@@ -866,8 +872,8 @@ public:
 
 			ManagedReference<SceneObject*> enemyTarget = nullptr;
 
-			if (agent->peekBlackboard("targetProspect"))
-				enemyTarget = agent->readBlackboard("targetProspect").get<ManagedReference<SceneObject*> >().get();
+			if (agent->peekBlackboard(BlackboardKey::TARGETPROSPECT))
+				enemyTarget = agent->readBlackboard(BlackboardKey::TARGETPROSPECT).get<ManagedReference<SceneObject*> >().get();
 
 			if (enemyTarget != nullptr) {
 
@@ -885,7 +891,7 @@ public:
 				}, "CallForHelpLambda");
 			}
 
-			agent->eraseBlackboard("allyProspect");
+			agent->eraseBlackboard(BlackboardKey::ALLYPROSPECT);
 			agent->setMovementState(AiAgent::FOLLOWING);
 		}
 
@@ -935,7 +941,7 @@ public:
 
 		// Chance to stop resting from 45s up to 2 minutes stored in ms
 		int restingTime = delay - ((45 + System::random(45)) * 1000);
-		agent->writeBlackboard("restingTime", restingTime);
+		agent->writeBlackboard(BlackboardKey::RESTINGTIME, restingTime);
 
 		int speciesID = agent->getSpecies();
 		bool canSitDown = false;
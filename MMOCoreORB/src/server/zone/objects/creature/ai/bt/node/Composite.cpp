@@ -13,7 +13,7 @@ using namespace server::zone::objects::creature::ai::bt::node;
 
 Behavior::Status Composite::doAction(AiAgent* agent) const {
 #ifdef DEBUG_AI
-	if (agent->peekBlackboard("aiDebug") && agent->readBlackboard("aiDebug") == true) {
+	if (agent->peekBlackboard(BlackboardKey::AIDEBUG) && agent->readBlackboard(BlackboardKey::AIDEBUG) == true) {
 		StringBuffer msg;
 		msg << "0x" << hex << id << " " << print().toCharArray();
 
@@ -62,7 +62,7 @@ Behavior::Status Composite::doAction(AiAgent* agent) const {
 	//			call the abstract method to do it.
 	Behavior::Status result = this->execute(agent, currentIdx);
 #ifdef DEBUG_AI
-	if (agent->peekBlackboard("aiDebug") && agent->readBlackboard("aiDebug") == true) {
+	if (agent->peekBlackboard(BlackboardKey::AIDEBUG) && agent->readBlackboard(BlackboardKey::AIDEBUG) == true) {
 		StringBuffer msg;
 		msg << "0x" << hex << id << " " << print() << "result: " << result;
 
@@ -0,0 +1,60 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#ifndef AIBEHAVIORBATCHTASK_H_
+#define AIBEHAVIORBATCHTASK_H_
+
+#include "server/zone/objects/creature/ai/events/AiBehaviorEvent.h"
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace creature {
+namespace ai {
+namespace events {
+
+/**
+ * Runs the behavior events of neighbouring agents that were due on the same scheduler tick.
+ */
+class AiBehaviorBatchTask : public Task {
+	Vector<Reference<AiBehaviorEvent*> > events;
+
+public:
+	AiBehaviorBatchTask(const String& zoneName) : Task() {
+		setCustomTaskQueue(zoneName);
+	}
+
+	void addEvent(AiBehaviorEvent* event) {
+		events.add(event);
+	}
+
+	inline int size() const {
+		return events.size();
+	}
+
+	void run() {
+		for (int i = 0; i < events.size(); ++i) {
+			AiBehaviorEvent* event = events.getUnsafe(i);
+
+			try {
+				event->run();
+			} catch (Exception& e) {
+				Logger::console.error() << "AiBehaviorBatchTask: " << e.getMessage();
+				e.printStackTrace();
+			}
+		}
+	}
+};
+
+}
+}
+}
+}
+}
+}
+
+using namespace server::zone::objects::creature::ai::events;
+
+#endif /* AIBEHAVIORBATCHTASK_H_ */
@@ -10,6 +10,8 @@
 
 #include "server/zone/objects/creature/ai/AiAgent.h"
 #include "server/zone/managers/creature/AiMap.h"
+#include "server/zone/objects/creature/ai/events/AiBehaviorScheduler.h"
+#include "server/zone/Zone.h"
 
 namespace server {
 namespace zone {
@@ -23,8 +25,44 @@ class AiBehaviorEvent : public Task {
 	bool hasFollowObject;
 	bool isRetreating;
 
+	// Zone scheduler running this event, null when it runs as a regular task
+	Reference<AiBehaviorScheduler*> scheduler;
+
+	// Scheduler tick the event is due on, guarded by the scheduler mutex
+	uint64 dueTick;
+	AtomicInteger queued;
+
+	friend class AiBehaviorScheduler;
+
+	void clearScheduledCounters() {
+		AiMap::instance()->scheduledBehaviorEvents.decrement();
+
+		if (hasFollowObject) {
+			AiMap::instance()->behaviorsWithFollowObject.decrement();
+
+			hasFollowObject = false;
+		}
+
+		if (isRetreating) {
+			AiMap::instance()->behaviorsRetreating.decrement();
+
+			isRetreating = false;
+		}
+	}
+
+	void rebind(AiBehaviorScheduler* zoneScheduler) {
+		if (scheduler == zoneScheduler)
+			return;
+
+		// The previous scheduler drops every entry of the event so it can't fire there too
+		if (scheduler != nullptr ? scheduler->detach(this) : Task::cancel())
+			clearScheduledCounters();
+
+		scheduler = zoneScheduler;
+	}
+
 public:
-	AiBehaviorEvent(AiAgent* pl) : Task(1000), creature(pl), hasFollowObject(false), isRetreating(false) {
+	AiBehaviorEvent(AiAgent* pl) : Task(1000), creature(pl), hasFollowObject(false), isRetreating(false), dueTick(0) {
 		AiMap::instance()->activeBehaviorEvents.increment();
 	}
 
@@ -70,8 +108,6 @@ public:
 	}
 
 	void schedule(uint64 delay = 0) {
-		AiMap::instance()->scheduledBehaviorEvents.increment();
-
 		ManagedReference<AiAgent*> strongRef = creature.get();
 
 		if (strongRef != nullptr) {
@@ -79,11 +115,22 @@ public:
 
 			if (zone != nullptr) {
 				setCustomTaskQueue(zone->getZoneName());
+
+				// Follow the agent to the scheduler of the zone it is in now
+				rebind(zone->getAiBehaviorScheduler());
 			}
 		}
 
 		try {
-			Task::schedule(delay);
+			bool inserted = true;
+
+			if (scheduler != nullptr)
+				inserted = scheduler->add(this, delay);
+			else
+				Task::schedule(delay);
+
+			if (inserted)
+				AiMap::instance()->scheduledBehaviorEvents.increment();
 
 			if (strongRef != nullptr) {
 				if (strongRef->getFollowObject() != nullptr && !hasFollowObject) {
@@ -107,28 +154,21 @@ public:
 				}
 			}
 		} catch (...) {
-			AiMap::instance()->scheduledBehaviorEvents.decrement();
 		}
 	}
 
-	bool cancel() {
-		bool ret = false;
-
-		if ((ret = Task::cancel())) {
-			AiMap::instance()->scheduledBehaviorEvents.decrement();
+	bool isBehaviorScheduled() {
+		if (scheduler != nullptr)
+			return queued.get() != 0;
 
-			if (hasFollowObject) {
-				AiMap::instance()->behaviorsWithFollowObject.decrement();
+		return Task::isScheduled();
+	}
 
-				hasFollowObject = false;
-			}
+	bool cancelBehavior() {
+		bool ret = false;
 
-			if (isRetreating) {
-				AiMap::instance()->behaviorsRetreating.decrement();
-
-				isRetreating = false;
-			}
-		}
+		if ((ret = (scheduler != nullptr ? scheduler->remove(this) : Task::cancel())))
+			clearScheduledCounters();
 
 		return ret;
 	}
@@ -137,6 +177,10 @@ public:
 		creature = nullptr;
 	}
 
+	ManagedReference<AiAgent*> getCreature() {
+		return creature.get();
+	}
+
 };
 
 }
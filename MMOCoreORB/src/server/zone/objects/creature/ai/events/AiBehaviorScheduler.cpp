@@ -0,0 +1,194 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#include "AiBehaviorScheduler.h"
+
+#include "server/zone/objects/creature/ai/events/AiBehaviorEvent.h"
+#include "server/zone/objects/creature/ai/events/AiBehaviorBatchTask.h"
+
+AiBehaviorScheduler::AiBehaviorScheduler(const String& name, int interval) : Task() {
+	zoneName = name;
+	tickInterval = Math::max(1, interval);
+
+	startTime = System::getMiliTime();
+	processedTick = 0;
+
+	queuedEntries = 0;
+
+	stopped = false;
+
+	setLoggingName("AiBehaviorScheduler " + zoneName);
+	setCustomTaskQueue(zoneName);
+}
+
+AiBehaviorScheduler::~AiBehaviorScheduler() {
+	for (int i = 0; i < WHEEL_SIZE; ++i) {
+		slots[i].removeAll();
+	}
+}
+
+bool AiBehaviorScheduler::add(AiBehaviorEvent* event, uint64 delay) {
+	Locker locker(&mutex);
+
+	if (stopped)
+		return false;
+
+	uint64 ticks = Math::max((uint64) 1, (delay + tickInterval - 1) / tickInterval);
+	uint64 due = Math::max(getCurrentTick(), processedTick) + ticks;
+
+	bool wasQueued = event->queued.get() != 0;
+
+	if (wasQueued && event->dueTick == due)
+		return false;
+
+	// A previous entry of the event becomes stale as its tick no longer matches
+	event->dueTick = due;
+	event->queued.set(1);
+
+	slots[due % WHEEL_SIZE].add(event);
+	++queuedEntries;
+
+	if (!isScheduled())
+		schedule(tickInterval);
+
+	return !wasQueued;
+}
+
+bool AiBehaviorScheduler::remove(AiBehaviorEvent* event) {
+	Locker locker(&mutex);
+
+	if (event->queued.get() == 0)
+		return false;
+
+	// The wheel entry is dropped when its slot comes up
+	event->queued.set(0);
+
+	return true;
+}
+
+bool AiBehaviorScheduler::detach(AiBehaviorEvent* event) {
+	Locker locker(&mutex);
+
+	for (int i = 0; i < WHEEL_SIZE; ++i) {
+		Vector<Reference<AiBehaviorEvent*> >& slot = slots[i];
+
+		for (int j = slot.size() - 1; j >= 0; --j) {
+			if (slot.getUnsafe(j) == event) {
+				slot.remove(j);
+
+				--queuedEntries;
+			}
+		}
+	}
+
+	bool wasQueued = event->queued.get() != 0;
+
+	event->queued.set(0);
+
+	return wasQueued;
+}
+
+void AiBehaviorScheduler::stop() {
+	Locker locker(&mutex);
+
+	stopped = true;
+
+	for (int i = 0; i < WHEEL_SIZE; ++i) {
+		slots[i].removeAll();
+	}
+
+	queuedEntries = 0;
+
+	if (isScheduled())
+		cancel();
+}
+
+void AiBehaviorScheduler::run() {
+	Vector<Reference<AiBehaviorEvent*> > dueEvents;
+
+	Locker locker(&mutex);
+
+	if (stopped)
+		return;
+
+	uint64 currentTick = getCurrentTick();
+
+	// After a stall every slot is visited once and anything due by now runs
+	uint64 lastTick = Math::min(currentTick, processedTick + WHEEL_SIZE);
+
+	for (uint64 tick = processedTick + 1; tick <= lastTick; ++tick) {
+		Vector<Reference<AiBehaviorEvent*> >& slot = slots[tick % WHEEL_SIZE];
+
+		if (slot.isEmpty())
+			continue;
+
+		Vector<Reference<AiBehaviorEvent*> > pending;
+
+		for (int i = 0; i < slot.size(); ++i) {
+			AiBehaviorEvent* event = slot.getUnsafe(i);
+
+			if (event->queued.get() == 0 || event->dueTick % WHEEL_SIZE != tick % WHEEL_SIZE) {
+				--queuedEntries;
+			} else if (event->dueTick <= currentTick) {
+				event->queued.set(0);
+				dueEvents.add(event);
+
+				--queuedEntries;
+			} else {
+				pending.add(event);
+			}
+		}
+
+		slot = pending;
+	}
+
+	processedTick = Math::max(processedTick, currentTick);
+
+	if (queuedEntries > 0 && !isScheduled())
+		schedule(tickInterval);
+
+	locker.release();
+
+	if (!dueEvents.isEmpty())
+		dispatch(dueEvents);
+}
+
+void AiBehaviorScheduler::dispatch(const Vector<Reference<AiBehaviorEvent*> >& events) {
+	VectorMap<uint32, Reference<AiBehaviorBatchTask*> > cells;
+	cells.setNoDuplicateInsertPlan();
+
+	for (int i = 0; i < events.size(); ++i) {
+		AiBehaviorEvent* event = events.getUnsafe(i);
+		uint32 cellKey = 0;
+
+		ManagedReference<AiAgent*> agent = event->getCreature();
+
+		if (agent != nullptr) {
+			uint32 column = (uint32) Math::max(0.f, (agent->getWorldPositionX() + 8192.f) / CELL_SIZE);
+			uint32 row = (uint32) Math::max(0.f, (agent->getWorldPositionY() + 8192.f) / CELL_SIZE);
+
+			cellKey = (row << 16) | column;
+		}
+
+		int index = cells.find(cellKey);
+
+		// Full batches are started right away so large cells spread over the zone threads
+		if (index != -1 && cells.elementAt(index).getValue()->size() >= MAX_BATCH_SIZE) {
+			cells.elementAt(index).getValue()->execute();
+			cells.drop(cellKey);
+
+			index = -1;
+		}
+
+		if (index == -1)
+			index = cells.put(cellKey, new AiBehaviorBatchTask(zoneName));
+
+		cells.elementAt(index).getValue()->addEvent(event);
+	}
+
+	for (int i = 0; i < cells.size(); ++i) {
+		cells.elementAt(i).getValue()->execute();
+	}
+}
@@ -0,0 +1,98 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#ifndef AIBEHAVIORSCHEDULER_H_
+#define AIBEHAVIORSCHEDULER_H_
+
+#include "engine/engine.h"
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace creature {
+namespace ai {
+namespace events {
+
+class AiBehaviorEvent;
+
+/**
+ * Runs the behavior events of the AI agents of a zone on a fixed tick
+ * instead of one timer per agent. Events due on a tick are grouped by
+ * spatial cell and executed in batches on the zone task queue, so agents
+ * close to each other run back to back on the same worker thread.
+ */
+class AiBehaviorScheduler : public Task, public Logger {
+public:
+	static constexpr int DEFAULT_TICK_INTERVAL = 50;
+
+	static constexpr int WHEEL_SIZE = 64;
+
+	static constexpr float CELL_SIZE = 128.f;
+
+	static constexpr int MAX_BATCH_SIZE = 32;
+
+private:
+	Vector<Reference<AiBehaviorEvent*> > slots[WHEEL_SIZE];
+
+	String zoneName;
+
+	int tickInterval;
+
+	uint64 startTime;
+	uint64 processedTick;
+
+	int queuedEntries;
+
+	bool stopped;
+
+	Mutex mutex;
+
+public:
+	AiBehaviorScheduler(const String& zoneName, int tickInterval);
+	~AiBehaviorScheduler();
+
+	/**
+	 * Queues event to run after delay miliseconds, rounded up to the next tick.
+	 * Returns true only when the event wasn't queued already.
+	 */
+	bool add(AiBehaviorEvent* event, uint64 delay);
+
+	/**
+	 * Takes event out of the queue, returns false if it wasn't queued.
+	 */
+	bool remove(AiBehaviorEvent* event);
+
+	/**
+	 * Drops every wheel entry of event before it moves to another scheduler,
+	 * returns false if it wasn't queued.
+	 */
+	bool detach(AiBehaviorEvent* event);
+
+	void stop();
+
+	void run();
+
+	inline int getTickInterval() const {
+		return tickInterval;
+	}
+
+private:
+	inline uint64 getCurrentTick() const {
+		return (System::getMiliTime() - startTime) / tickInterval;
+	}
+
+	void dispatch(const Vector<Reference<AiBehaviorEvent*> >& events);
+};
+
+}
+}
+}
+}
+}
+}
+
+using namespace server::zone::objects::creature::ai::events;
+
+#endif /* AIBEHAVIORSCHEDULER_H_ */
@@ -8,6 +8,7 @@
 #ifndef AIRECOVERYEVENT_H_
 #define AIRECOVERYEVENT_H_
 
+#include <atomic>
 
 #include "server/zone/objects/creature/ai/AiAgent.h"
 #include "server/zone/managers/creature/AiMap.h"
@@ -23,8 +24,11 @@ class AiRecoveryEvent : public Task {
 	ManagedWeakReference<AiAgent*> agent;
 	Time startTime;
 
+	// Time the agent spent dormant, recovered on the next run
+	std::atomic<uint64> catchUpLatency;
+
 public:
-	AiRecoveryEvent(AiAgent* aiAgent) : Task(1000) {
+	AiRecoveryEvent(AiAgent* aiAgent) : Task(1000), catchUpLatency(0) {
 		agent = aiAgent;
 		startTime.updateToCurrentTime();
 		AiMap::instance()->activeRecoveryEvents.increment();
@@ -46,7 +50,11 @@ public:
 			return;
 
 		Locker locker(strongRef);
-		strongRef->doRecovery(startTime.miliDifference());
+		strongRef->doRecovery((int) (startTime.miliDifference() + catchUpLatency.exchange(0)));
+	}
+
+	void addCatchUpLatency(uint64 latency) {
+		catchUpLatency.fetch_add(latency);
 	}
 
 	void schedule(uint64 delay = 0) {
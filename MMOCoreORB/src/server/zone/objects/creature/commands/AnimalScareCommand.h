@@ -68,8 +68,8 @@ public:
 				Locker alock(agent, creature);
 
 				float aggroMod = 1.f;
-				if (agent->peekBlackboard("aggroMod"))
-					aggroMod = agent->readBlackboard("aggroMod").get<float>();
+				if (agent->peekBlackboard(BlackboardKey::AGGROMOD))
+					aggroMod = agent->readBlackboard(BlackboardKey::AGGROMOD).get<float>();
 
 				int radius = agent->getAggroRadius();
 				if (radius == 0)
@@ -77,7 +77,7 @@ public:
 
 				float distance = 100.f - radius * aggroMod;
 
-				agent->writeBlackboard("fleeRange", distance);
+				agent->writeBlackboard(BlackboardKey::FLEERANGE, distance);
 
 				agent->runAway(creature, distance, false);
 				agent->showFlyText("npc_reaction/flytext", "afraid", 0xFF, 0, 0);
@@ -62,7 +62,8 @@ public:
 					msg << "Scheduled AiBehaviorEvents: " << AiMap::instance()->scheduledBehaviorEvents.get() << "\n";
 					msg << "AiBehaviorEvents with followObject: " << AiMap::instance()->behaviorsWithFollowObject.get() << "\n";
 					msg << "AiBehaviorEvents retreating: " << AiMap::instance()->behaviorsRetreating.get() << "\n";
-					msg << "AiRecoveryEvents: " << AiMap::instance()->activeRecoveryEvents.get() << "\n\n\n";
+					msg << "AiRecoveryEvents: " << AiMap::instance()->activeRecoveryEvents.get() << "\n";
+					msg << "Dormant AiAgent recoveries: " << AiMap::instance()->dormantRecoveries.get() << "\n\n\n";
 
 					msg << "Space Zone AI:\n\n";
 					msg << "Active AiBehaviorEvents: " << SpaceAiMap::instance()->activeBehaviorEvents.get() << "\n";
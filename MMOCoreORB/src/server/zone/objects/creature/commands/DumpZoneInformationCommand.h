@@ -122,8 +122,8 @@ public:
 		int heightCacheHitCount = terrainManager->getCacheHitCount();
 		int heightCacheMissCount = terrainManager->getCacheMissCount();
 		int cacheClearCount = terrainManager->getCacheClearCount();
-		int cacheClearHeightCount = terrainManager->getCacheClearHeightsCount();
-		int cacheSize = terrainManager->getCachedValuesCount();
+		int cacheClearTilesCount = terrainManager->getCacheClearTilesCount();
+		int cacheSize = terrainManager->getCachedTilesCount();
 		int evictCount = terrainManager->getCacheEvictCount();
 
 		int total = Math::max(heightCacheHitCount + heightCacheMissCount, 1);
@@ -131,9 +131,9 @@ public:
 		msg << "height cache total hit count = " << heightCacheHitCount << ", total miss count = " << heightCacheMissCount
 				<< ", total hit rate = " << ((float)heightCacheHitCount / (float)total) * 100 << "% "
 						", clear count = " << cacheClearCount <<
-						", clear hit count = " << cacheClearHeightCount <<
-						", evict count = " << evictCount <<
-						", cache size = " << cacheSize << endl;
+						", cleared tiles = " << cacheClearTilesCount <<
+						", evicted tiles = " << evictCount <<
+						", cached tiles = " << cacheSize << endl;
 
 		msg << "Total Active Areas = " << creature->getActiveAreasSize() << endl;
 
@@ -60,7 +60,7 @@ public:
 				Locker alock(agent, creature);
 
 				float range = System::random(50 - 25) + 25.f;
-				agent->writeBlackboard("fleeRange", range);
+				agent->writeBlackboard(BlackboardKey::FLEERANGE, range);
 
 				Time* fleeDelay = agent->getFleeDelay();
 
@@ -62,8 +62,8 @@ public:
 
 				float aggroMod = 1.f;
 
-				if (agent->peekBlackboard("aggroMod"))
-					aggroMod = agent->readBlackboard("aggroMod").get<float>();
+				if (agent->peekBlackboard(BlackboardKey::AGGROMOD))
+					aggroMod = agent->readBlackboard(BlackboardKey::AGGROMOD).get<float>();
 
 				int radius = agent->getAggroRadius();
 
@@ -72,7 +72,7 @@ public:
 				}
 
 				float range = 100.f - radius * aggroMod;
-				agent->writeBlackboard("fleeRange", range);
+				agent->writeBlackboard(BlackboardKey::FLEERANGE, range);
 
 				Time* fleeDelay = agent->getFleeDelay();
 
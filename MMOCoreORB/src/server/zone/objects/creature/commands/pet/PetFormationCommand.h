@@ -95,7 +95,7 @@ public:
 			formationOffset.setY(fabs(petNumber) * -1);
 		}
 
-		pet->writeBlackboard("formationOffset", formationOffset);
+		pet->writeBlackboard(BlackboardKey::FORMATIONOFFSET, formationOffset);
 
 		return SUCCESS;
 	}
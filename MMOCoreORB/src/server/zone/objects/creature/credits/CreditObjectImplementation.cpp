@@ -19,7 +19,7 @@ void CreditObjectImplementation::setCashCredits(int credits, bool notifyClient)
 		if (creo == nullptr)
 			return;
 
-		DeltaMessage *msg = new DeltaMessage(creo->getObjectID(), 'CREO', 1);
+		DeltaMessage *msg = new DeltaMessage(creo.get(), 'CREO', 1);
 		msg->startUpdate(0x01);
 		msg->insertInt(cashCredits);
 		msg->close();
@@ -53,7 +53,7 @@ void CreditObjectImplementation::setBankCredits(int credits, bool notifyClient)
 		if (creo == nullptr)
 			return;
 
-		DeltaMessage *msg = new DeltaMessage(creo->getObjectID(), 'CREO', 1);
+		DeltaMessage *msg = new DeltaMessage(creo.get(), 'CREO', 1);
 		msg->startUpdate(0x00);
 		msg->insertInt(bankCredits);
 		msg->close();
@@ -217,7 +217,7 @@ public:
 			controlDevice->setLastCommand(PetManager::FOLLOW);
 			controlDevice->setLastCommander(player);
 
-			agent->eraseBlackboard("restingTime");
+			agent->eraseBlackboard(BlackboardKey::RESTINGTIME);
 			agent->setPosture(CreaturePosture::UPRIGHT, true, true);
 
 			agent->setFollowObject(player);
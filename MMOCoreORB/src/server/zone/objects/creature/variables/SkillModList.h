@@ -9,6 +9,7 @@
 #include "SkillModEntry.h"
 #include "server/zone/objects/scene/variables/DeltaVectorMap.h"
 #include "server/zone/managers/skill/SkillModManager.h"
+#include "server/zone/managers/skill/SkillModRegistry.h"
 
 class SkillModGroup : public VectorMap<String, int> {
 public:
@@ -36,6 +37,56 @@ class SkillModList : public DeltaVectorMap<String, SkillModEntry> {
 protected:
 	VectorMap<uint32, SkillModGroup> mods;
 
+	// Clamped total of every skill mod in mods by its SkillModRegistry id, not serialized
+	Vector<int> totals;
+
+	int computeSkillMod(const String& skillMod) const {
+		int skill = 0;
+
+		for (int i = 0; i < mods.size(); ++i) {
+			uint32 modType = mods.elementAt(i).getKey();
+			const SkillModGroup* group = &mods.elementAt(i).getValue();
+
+			if (group->contains(skillMod)) {
+				int maxSkill = SkillModManager::instance()->getMaxSkill(modType);
+				int minSkill = SkillModManager::instance()->getMinSkill(modType);
+
+				int newSkillBonus = group->get(skillMod);
+
+				if (maxSkill != 0 && minSkill != 0) {
+					if (newSkillBonus >= 0)
+						newSkillBonus = Math::min(newSkillBonus, maxSkill);
+					else
+						newSkillBonus = Math::max(newSkillBonus, minSkill);
+				}
+
+				skill += newSkillBonus;
+			}
+		}
+
+		return skill;
+	}
+
+	void updateTotal(const String& skillMod) {
+		uint32 id = SkillModRegistry::instance()->intern(skillMod);
+
+		while (totals.size() <= (int) id)
+			totals.add(0);
+
+		totals.set(id, computeSkillMod(skillMod));
+	}
+
+	void updateTotals() {
+		totals.removeAll();
+
+		for (int i = 0; i < mods.size(); ++i) {
+			const SkillModGroup* group = &mods.elementAt(i).getValue();
+
+			for (int j = 0; j < group->size(); ++j)
+				updateTotal(group->elementAt(j).getKey());
+		}
+	}
+
 public:
 
 	SkillModList() {
@@ -48,6 +99,7 @@ public:
 		mods.setAllowOverwriteInsertPlan();
 
 		mods = l.mods;
+		totals = l.totals;
 
 		addSerializableVariables();
 	}
@@ -59,6 +111,7 @@ public:
 		DeltaVectorMap<String, SkillModEntry>::operator=(l);
 
 		mods = l.mods;
+		totals = l.totals;
 
 		return *this;
 	}
@@ -75,6 +128,14 @@ public:
 		to_json(j, vm);
 	}
 
+	bool parseFromBinaryStream(ObjectInputStream* stream) override {
+		bool result = DeltaVectorMap<String, SkillModEntry>::parseFromBinaryStream(stream);
+
+		updateTotals();
+
+		return result;
+	}
+
 	bool add(const uint32 modType, const String& skillMod, int value) {
 		if (!mods.contains(modType)) {
 			SkillModGroup newgroup;
@@ -90,9 +151,25 @@ public:
 				group->drop(skillMod);
 		}
 
+		updateTotal(skillMod);
+
 		return true;
 	}
 
+	void clearSkillModGroup(const uint32 type) {
+		int index = mods.find(type);
+
+		if (index == -1)
+			return;
+
+		SkillModGroup group = mods.elementAt(index).getValue();
+
+		mods.elementAt(index).getValue().removeAll();
+
+		for (int i = 0; i < group.size(); ++i)
+			updateTotal(group.elementAt(i).getKey());
+	}
+
 	SkillModEntry getVisibleSkillMod(const String& skillMod) const {
 		SkillModEntry newEntry;
 
@@ -134,7 +211,7 @@ public:
 		return newEntry;
 	}
 
-	SkillModGroup* getSkillModGroup(const uint32 type) {
+	const SkillModGroup* getSkillModGroup(const uint32 type) {
 		if(!mods.contains(type)) {
 			SkillModGroup group;
 			mods.put(type, group);
@@ -143,31 +220,15 @@ public:
 		return &mods.get(type);
 	}
 
-	int getSkillMod(const String& skillMod) const {
-		int skill = 0;
+	inline int getSkillMod(const uint32 skillModID) const {
+		if (skillModID >= (uint32) totals.size())
+			return 0;
 
-		for (int i = 0; i < mods.size(); ++i) {
-			uint32 modType = mods.elementAt(i).getKey();
-			const SkillModGroup* group = &mods.elementAt(i).getValue();
-
-			if (group->contains(skillMod)) {
-				int maxSkill = SkillModManager::instance()->getMaxSkill(modType);
-				int minSkill = SkillModManager::instance()->getMinSkill(modType);
-
-				int newSkillBonus = group->get(skillMod);
-
-				if (maxSkill != 0 && minSkill != 0) {
-					if (newSkillBonus >= 0)
-						newSkillBonus = Math::min(newSkillBonus, maxSkill);
-					else
-						newSkillBonus = Math::max(newSkillBonus, minSkill);
-				}
-
-				skill += newSkillBonus;
-			}
-		}
+		return totals.get(skillModID);
+	}
 
-		return skill;
+	int getSkillMod(const String& skillMod) const {
+		return getSkillMod(SkillModRegistry::instance()->find(skillMod));
 	}
 
 	int getSkillModOfType(const String& skillMod, const uint32 modType) {
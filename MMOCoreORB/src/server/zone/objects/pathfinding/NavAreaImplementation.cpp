@@ -36,6 +36,14 @@ void NavAreaImplementation::notifyLoadFromDatabase() {
 	}
 
 	ActiveAreaImplementation::notifyLoadFromDatabase();
+
+	if (NavMeshTileStore::isEnabled() && recastNavMesh.isLoaded()) {
+		ManagedReference<NavArea*> area = asNavArea();
+
+		Core::getTaskManager()->executeTask([area] {
+			NavMeshManager::instance()->checkTileStore(area);
+		}, "checkNavTileStoreLambda", NavMeshManager::TileQueue.toCharArray());
+	}
 }
 
 AABB NavAreaImplementation::getBoundingBox() const {
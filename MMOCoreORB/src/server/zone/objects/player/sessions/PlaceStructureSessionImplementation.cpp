@@ -141,8 +141,14 @@ int PlaceStructureSessionImplementation::completeSession() {
 	ManagedReference<CreatureObject*> creature = creatureObject.get();
 	ManagedReference<Zone*> thisZone = zone.get();
 
-	if (deed == nullptr || creature == nullptr || thisZone == nullptr)
+	if (deed == nullptr || creature == nullptr || thisZone == nullptr) {
+		GCWManager* gcwMan = thisZone != nullptr ? thisZone->getGCWManager() : nullptr;
+
+		if (gcwMan != nullptr)
+			gcwMan->removePendingBasePlacement(positionX, positionY);
+
 		return cancelSession();
+	}
 
 	String serverTemplatePath = deed->getGeneratedObjectTemplate();
 
@@ -160,6 +166,12 @@ int PlaceStructureSessionImplementation::completeSession() {
 		if (inventory != nullptr)
 			inventory->transferObject(deed, -1, true);
 
+		// Placements of other structures are not pending, this is a no-op for them
+		GCWManager* gcwMan = thisZone->getGCWManager();
+
+		if (gcwMan != nullptr)
+			gcwMan->removePendingBasePlacement(positionX, positionY);
+
 		return cancelSession();
 	}
 
@@ -0,0 +1,100 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#ifndef INTERESTTIERS_H_
+#define INTERESTTIERS_H_
+
+#include "system/lang.h"
+
+#include "conf/ConfigManager.h"
+
+namespace server {
+ namespace zone {
+  namespace objects {
+   namespace scene {
+
+/**
+ * Distance bands used to throttle the light movement updates an object sends
+ * to the players around it. Beyond Ranges[i] meters a receiver only gets one
+ * of every Divisors[i] updates, receivers closer than the first range get
+ * every update.
+ *
+ * Core3.InterestTiers.<Type>.Ranges = {64, 128}
+ * Core3.InterestTiers.<Type>.Divisors = {2, 4}
+ */
+class InterestTiers {
+	Vector<float> rangesSq;
+	Vector<int> divisors;
+
+public:
+	InterestTiers(const String& type, const Vector<int>& defaultRanges, const Vector<int>& defaultDivisors) {
+		auto config = ConfigManager::instance();
+
+		String rangesKey = "Core3.InterestTiers." + type + ".Ranges";
+		String divisorsKey = "Core3.InterestTiers." + type + ".Divisors";
+
+		const Vector<int>& ranges = config->contains(rangesKey) ? config->getIntVector(rangesKey) : defaultRanges;
+		const Vector<int>& divs = config->contains(divisorsKey) ? config->getIntVector(divisorsKey) : defaultDivisors;
+
+		int count = Math::min(ranges.size(), divs.size());
+
+		for (int i = 0; i < count; ++i) {
+			float range = ranges.get(i);
+
+			if (!rangesSq.isEmpty() && range * range <= rangesSq.getUnsafe(rangesSq.size() - 1))
+				break;
+
+			rangesSq.add(range * range);
+			divisors.add(Math::max(1, divs.get(i)));
+		}
+	}
+
+	inline bool isThrottling() const {
+		return !rangesSq.isEmpty();
+	}
+
+	/**
+	 * Returns how many updates a receiver at distanceSq gets out of.
+	 */
+	inline int getDivisor(float distanceSq) const {
+		int divisor = 1;
+
+		for (int i = 0; i < rangesSq.size(); ++i) {
+			if (distanceSq <= rangesSq.getUnsafe(i))
+				break;
+
+			divisor = divisors.getUnsafe(i);
+		}
+
+		return divisor;
+	}
+
+	/**
+	 * Tiers of creatures, read from the config on first use.
+	 */
+	static const InterestTiers* getCreatureTiers() {
+		static const InterestTiers tiers("Creature", Vector<int>({64, 128}), Vector<int>({2, 4}));
+
+		return &tiers;
+	}
+
+	/**
+	 * Tiers of humanoid npcs, read from the config on first use.
+	 */
+	static const InterestTiers* getNpcTiers() {
+		static const InterestTiers tiers("Npc", Vector<int>({64, 128}), Vector<int>({2, 4}));
+
+		return &tiers;
+	}
+};
+
+   }
+  }
+ }
+}
+
+using namespace server::zone::objects::scene;
+
+#endif /* INTERESTTIERS_H_ */
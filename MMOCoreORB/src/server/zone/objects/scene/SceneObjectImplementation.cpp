@@ -41,6 +41,7 @@
 #include "server/zone/objects/scene/components/ContainerComponent.h"
 #include "server/zone/objects/scene/components/LuaContainerComponent.h"
 #include "server/zone/objects/scene/SceneObjectType.h"
+#include "server/zone/objects/scene/InterestTiers.h"
 #include "server/zone/objects/ship/ShipObject.h"
 #include "server/zone/objects/ship/ai/SpaceStationObject.h"
 #include "server/zone/objects/ship/ai/CapitalShipObject.h"
@@ -92,6 +93,9 @@ void SceneObjectImplementation::initializeTransientMembers() {
 	}
 
 	movementCounter = 0;
+	movementThrottled = false;
+
+	baselineCache = new BaselineCache();
 
 	setGlobalLogging(true);
 	setLogging(false);
@@ -821,6 +825,68 @@ void SceneObjectImplementation::broadcastMessagePrivate(BasePacket* message, Sce
 #endif
 }
 
+void SceneObjectImplementation::broadcastMovementMessage(BasePacket* message, bool lightUpdate) {
+	const InterestTiers* tiers = nullptr;
+
+	if (lightUpdate && isAiAgent())
+		tiers = isCreature() ? InterestTiers::getCreatureTiers() : InterestTiers::getNpcTiers();
+
+	// Full updates always reach everyone and bring the far tiers to the latest position
+	if (tiers == nullptr || !tiers->isThrottling() || parent != nullptr || zone == nullptr || closeobjects == nullptr) {
+		if (!lightUpdate)
+			movementThrottled = false;
+
+		broadcastMessagePrivate(message, asSceneObject(), true);
+
+		return;
+	}
+
+	const ZoneServer* zoneServer = getZoneServer();
+
+	if (zoneServer == nullptr || zoneServer->isServerLoading() || zoneServer->isServerShuttingDown()) {
+		delete message;
+		return;
+	}
+
+	SortedVector<TreeEntry*> closeNoneReference;
+
+	closeobjects->safeCopyReceiversTo(closeNoneReference, CloseObjectsVector::PLAYERTYPE);
+
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+	Reference<BasePacket*> pack = message;
+#endif
+
+	float x = getPositionX();
+	float y = getPositionY();
+
+	for (int i = 0; i < closeNoneReference.size(); ++i) {
+		SceneObject* sceneO = static_cast<SceneObject*>(closeNoneReference.getUnsafe(i));
+
+		if (sceneO == nullptr || sceneO == asSceneObject())
+			continue;
+
+		float deltaX = sceneO->getWorldPositionX() - x;
+		float deltaY = sceneO->getWorldPositionY() - y;
+
+		int divisor = tiers->getDivisor(deltaX * deltaX + deltaY * deltaY);
+
+		if (divisor > 1 && (movementCounter % divisor) != 0) {
+			movementThrottled = true;
+			continue;
+		}
+
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+		sceneO->sendMessage(pack);
+#else
+		sceneO->sendMessage(message->clone());
+#endif
+	}
+
+#ifndef LOCKFREE_BCLIENT_BUFFERS
+	delete message;
+#endif
+}
+
 void SceneObjectImplementation::broadcastMessagesPrivate(Vector<BasePacket*>* messages, SceneObject* selfObject) {
 	const ZoneServer* zoneServer = getZoneServer();
 
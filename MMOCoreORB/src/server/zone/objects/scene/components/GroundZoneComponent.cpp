@@ -102,10 +102,6 @@ void GroundZoneComponent::updateZone(SceneObject* sceneObject, bool lightUpdate,
 	if (parent != nullptr && (parent->isVehicleObject() || parent->isMount()))
 		sceneObject->updateVehiclePosition(sendPackets);
 
-	Locker _locker(zone);
-
-	bool zoneUnlocked = false;
-
 	if (parent != nullptr && parent->isCellObject()) {
 		SceneObject* rootParent = parent->getRootParent();
 
@@ -114,19 +110,17 @@ void GroundZoneComponent::updateZone(SceneObject* sceneObject, bool lightUpdate,
 
 		zone = rootParent->getZone();
 
-		zone->transferObject(sceneObject, -1, false);
+		Locker _locker(zone);
 
-		zone->unlock();
-		zoneUnlocked = true;
+		zone->transferObject(sceneObject, -1, false);
 	} else {
+		// The ground zone spatial index is sharded and locks internally, no need for the zone lock.
+		// Close objects are refreshed in the zone batched in range pass.
 		if (sceneObject->getLocalZone() != nullptr) {
 			zone->update(sceneObject);
 
-			zone->unlock();
-			zoneUnlocked = true;
-
 			try {
-				zone->inRange(sceneObject, zone->getZoneObjectRange());
+				zone->enqueueInRangeUpdate(sceneObject, zone->getZoneObjectRange());
 			} catch (Exception& e) {
 				sceneObject->error(e.getMessage());
 				e.printStackTrace();
@@ -166,9 +160,6 @@ void GroundZoneComponent::updateZone(SceneObject* sceneObject, bool lightUpdate,
 		sceneObject->error(e.getMessage());
 		e.printStackTrace();
 	}
-
-	if (zoneUnlocked)
-		zone->wlock();
 }
 
 void GroundZoneComponent::updateZoneWithParent(SceneObject* sceneObject, SceneObject* newParent, bool lightUpdate, bool sendPackets) const {
@@ -0,0 +1,77 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#ifndef BASELINECACHE_H_
+#define BASELINECACHE_H_
+
+#include "engine/engine.h"
+
+#include "conf/ConfigManager.h"
+
+/**
+ * Serialized public baselines of an object, shared by every player the
+ * object is sent to. The setters of the baseline variables drop the cache
+ * after changing them, whether they notify the clients or not.
+ */
+class BaselineCache : public Object {
+	AtomicInteger generation;
+
+	Mutex mutex;
+
+	VectorMap<uint64, Reference<BasePacket*> > packets;
+
+	int cachedGeneration;
+
+public:
+	BaselineCache() {
+		cachedGeneration = 0;
+
+		packets.setNoDuplicateInsertPlan();
+		packets.setNullValue(nullptr);
+	}
+
+	inline void invalidate() {
+		generation.increment();
+	}
+
+	/**
+	 * Returns a packet for a single recipient with the baseline name/type,
+	 * serializing it with builder when it is not cached.
+	 */
+	template<class Builder>
+	BasePacket* getBaseline(uint32 name, uint8 type, Builder builder) {
+		static const bool enabled = ConfigManager::instance()->getBool("Core3.Zone.BaselineCache", true);
+
+		if (!enabled)
+			return builder();
+
+		uint64 key = ((uint64) name << 8) | type;
+		int currentGeneration = generation.get();
+
+		Locker locker(&mutex);
+
+		if (currentGeneration != cachedGeneration) {
+			packets.removeAll();
+
+			cachedGeneration = currentGeneration;
+		}
+
+		Reference<BasePacket*> packet = packets.get(key);
+
+		if (packet == nullptr) {
+			packet = builder();
+
+			packets.put(key, packet);
+		}
+
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+		return packet;
+#else
+		return packet->clone();
+#endif
+	}
+};
+
+#endif /* BASELINECACHE_H_ */
@@ -53,7 +53,7 @@ public:
 	}
 
 	DeltaMessage* getMessage(SceneObject* sceneObject, bool doClose = true) {
-		auto message = new DeltaMessage(sceneObject->getObjectID(), BaselineName, DeltaType);
+		auto message = new DeltaMessage(sceneObject, BaselineName, DeltaType);
 		addToDeltaMessage(message);
 
 		if (doClose) {
@@ -33,7 +33,7 @@ public:
 	}
 
 	void broadcastStandaloneDeltaMessage(SceneObject* sceneObject) {
-		DeltaMessage* message = new DeltaMessage(sceneObject->getObjectID(), BaselineName, DeltaType);
+		DeltaMessage* message = new DeltaMessage(sceneObject, BaselineName, DeltaType);
 		addToDeltaMessage(message);
 		message->close();
 
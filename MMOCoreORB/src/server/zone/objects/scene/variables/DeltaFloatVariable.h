@@ -36,7 +36,7 @@ public:
 	}
 
 	void broadcastStandaloneDeltaMessage(SceneObject* obj) {
-		DeltaMessage* msg = new DeltaMessage(obj->getObjectID(), BaselineName, Type);
+		DeltaMessage* msg = new DeltaMessage(obj, BaselineName, Type);
 		addToDeltaMessage(msg);
 		msg->close();
 
@@ -22,7 +22,7 @@ public:
 	}
 
 	void broadcastStandaloneDeltaMessage(server::zone::objects::scene::SceneObject* obj) {
-		DeltaMessage* msg = new DeltaMessage(obj->getObjectID(), BaselineName, Type);
+		DeltaMessage* msg = new DeltaMessage(obj, BaselineName, Type);
 		addToDeltaMessage(msg);
 		msg->close();
 
@@ -42,7 +42,7 @@ void ShipReactorComponentImplementation::fillAttributeList(AttributeListMessage*
 void ShipReactorComponentImplementation::install(CreatureObject* pilot, ShipObject* ship, int slot, bool notifyClient) {
 	ShipComponentImplementation::install(pilot, ship, slot, notifyClient);
 
-	DeltaMessage* ship1 = notifyClient ? new DeltaMessage(ship->getObjectID(), 'SHIP', 1) : nullptr;
+	DeltaMessage* ship1 = notifyClient ? new DeltaMessage(ship, 'SHIP', 1) : nullptr;
 
 	ship->setReactorGenerationRate(reactorGenerationRate, false, ship1);
 
@@ -56,7 +56,7 @@ void ShipReactorComponentImplementation::install(CreatureObject* pilot, ShipObje
 void ShipReactorComponentImplementation::uninstall(CreatureObject* pilot, ShipObject* ship, int slot, bool notifyClient) {
 	ShipComponentImplementation::uninstall(pilot, ship, slot, notifyClient);
 
-	DeltaMessage* ship1 = notifyClient ? new DeltaMessage(ship->getObjectID(), 'SHIP', 1) : nullptr;
+	DeltaMessage* ship1 = notifyClient ? new DeltaMessage(ship, 'SHIP', 1) : nullptr;
 
 	ship->setReactorGenerationRate(0.f, false, ship1);
 
@@ -161,10 +161,10 @@ void TangibleObjectImplementation::destroyObjectFromDatabase(bool destroyContain
 void TangibleObjectImplementation::sendBaselinesTo(SceneObject* player) {
 	TangibleObject* thisPointer = asTangibleObject();
 
-	BaseMessage* tano3 = new TangibleObjectMessage3(thisPointer);
+	BasePacket* tano3 = baselineCache->getBaseline('TANO', 3, [thisPointer]() { return new TangibleObjectMessage3(thisPointer); });
 	player->sendMessage(tano3);
 
-	BaseMessage* tano6 = new TangibleObjectMessage6(thisPointer);
+	BasePacket* tano6 = baselineCache->getBaseline('TANO', 6, [thisPointer]() { return new TangibleObjectMessage6(thisPointer); });
 	player->sendMessage(tano6);
 
 	ManagedReference<SceneObject*> parent = getParentRecursively(SceneObjectType::PLAYERCREATURE);
@@ -662,6 +662,8 @@ void TangibleObjectImplementation::addVisibleComponent(int value, bool notifyCli
 	} else {
 		visibleComponents.add(value);
 	}
+
+	invalidateBaselines();
 }
 
 void TangibleObjectImplementation::removeAllVisibleComponents(bool notifyClient) {
@@ -677,6 +679,8 @@ void TangibleObjectImplementation::removeAllVisibleComponents(bool notifyClient)
 	} else {
 		visibleComponents.removeAll();
 	}
+
+	invalidateBaselines();
 }
 
 void TangibleObjectImplementation::removeVisibleComponent(int value, bool notifyClient) {
@@ -695,6 +699,8 @@ void TangibleObjectImplementation::removeVisibleComponent(int value, bool notify
 	} else {
 		visibleComponents.drop(value);
 	}
+
+	invalidateBaselines();
 }
 
 void TangibleObjectImplementation::setDefender(SceneObject* defender) {
@@ -731,6 +737,8 @@ void TangibleObjectImplementation::setDefender(SceneObject* defender) {
 
 	dtano6->close();
 
+	invalidateBaselines();
+
 	broadcastMessage(dtano6, true);
 }
 
@@ -754,6 +762,8 @@ void TangibleObjectImplementation::addDefender(SceneObject* defender) {
 
 	dtano6->close();
 
+	invalidateBaselines();
+
 	broadcastMessage(dtano6, true);
 
 	setCombatState();
@@ -779,6 +789,8 @@ void TangibleObjectImplementation::removeDefenders() {
 
 	dtano6->close();
 
+	invalidateBaselines();
+
 	broadcastMessage(dtano6, true);
 
 	debug("removed all defenders");
@@ -804,6 +816,8 @@ void TangibleObjectImplementation::removeDefender(SceneObject* defender) {
 
 			dtano6->close();
 
+			invalidateBaselines();
+
 			broadcastMessage(dtano6, true);
 
 			debug("defender found and removed");
@@ -899,6 +913,8 @@ void TangibleObjectImplementation::fillAttributeList(AttributeListMessage* alm,
 void TangibleObjectImplementation::setCustomizationVariable(byte type, int16 value, bool notifyClient) {
 	customizationVariables.setVariable(type, value);
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -912,6 +928,8 @@ void TangibleObjectImplementation::setCustomizationVariable(byte type, int16 val
 void TangibleObjectImplementation::setCustomizationVariable(const String& type, int16 value, bool notifyClient) {
 	customizationVariables.setVariable(type, value);
 
+	invalidateBaselines();
+
 	if(!notifyClient)
 		return;
 
@@ -929,6 +947,8 @@ void TangibleObjectImplementation::setCountdownTimer(unsigned int newUseCount, b
 
 	useCount = newUseCount;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -964,6 +984,8 @@ void TangibleObjectImplementation::setMaxCondition(int maxCond, bool notifyClien
 
 	maxCondition = maxCond;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -980,6 +1002,8 @@ void TangibleObjectImplementation::setConditionDamage(float condDamage, bool not
 
 	conditionDamage = condDamage;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -1108,6 +1132,8 @@ int TangibleObjectImplementation::healDamage(TangibleObject* healer, int damageT
 void TangibleObjectImplementation::setObjectName(const StringId& stringID, bool notifyClient) {
 	objectName = stringID;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
@@ -1121,6 +1147,8 @@ void TangibleObjectImplementation::setObjectName(const StringId& stringID, bool
 void TangibleObjectImplementation::setCustomObjectName(const UnicodeString& name, bool notifyClient) {
 	customName = name;
 
+	invalidateBaselines();
+
 	if (isClientObject())
 		setForceSend(true);
 
@@ -1140,6 +1168,8 @@ void TangibleObjectImplementation::setOptionsBitmask(uint32 bitmask, bool notify
 
 	optionsBitmask = bitmask;
 
+	invalidateBaselines();
+
 	if (!notifyClient)
 		return;
 
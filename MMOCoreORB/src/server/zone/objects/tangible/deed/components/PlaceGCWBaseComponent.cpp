@@ -53,6 +53,10 @@ int PlaceGCWBaseComponent::placeStructure(StructureDeed* deed, CreatureObject* c
 
 	int result = StructureManager::instance()->placeStructureFromDeed(creature, deed, x, y, angle);
 
+	// The session is already gone if the construction couldn't start
+	if (result == 0 && creature->containsActiveSession(SessionFacadeType::PLACESTRUCTURE))
+		gcwMan->addPendingBasePlacement(x, y);
+
 	return 0;
 }
 
@@ -29,6 +29,7 @@
 #include "server/zone/managers/credit/CreditManager.h"
 #include "server/zone/objects/tangible/eventperk/LotteryDroid.h"
 #include "server/zone/objects/tangible/components/vendor/VendorDataComponent.h"
+#include "server/zone/managers/logging/AsyncLogManager.h"
 
 #define TRXLOG_FORMAT_VERSION 2
 
@@ -759,31 +760,21 @@ const String TransactionLog::composeLogEntry() const {
 
 void TransactionLog::writeLog() {
 	auto static trxLog = [] () {
-		Logger log("TransactionLog");
+		auto config = ConfigManager::instance();
+		auto writer = AsyncLogManager::instance()->getWriter("log/transaction.log");
 
-		log.setGlobalLogging(false);
-		log.setFileLogger("log/transaction.log", true, ConfigManager::instance()->getRotateLogAtStart());
-		log.setLogLevelToFile(false);
-		log.setLogToConsole(false);
-		log.setRotateLogSizeMB(ConfigManager::instance()->getInt("Core3.TransactionLog.RotateLogSizeMB", ConfigManager::instance()->getRotateLogSizeMB()));
-		log.setLogLevel(ConfigManager::instance()->getLogLevel("Core3.TransactionLog.LogLevel", Logger::DEBUG));
-		log.setLoggerCallback([log](Logger::LogLevel level, const char* msg) -> int {
-			static Mutex logWriteMutext;
-			auto logFile = log.getFileLogger();
-			StringBuffer logLine;
-
-			logLine << msg << endl;
-
-			Locker guard(&logWriteMutext);
-			(*logFile) << logLine;
-			logFile->flush();
+		if (config->getRotateLogAtStart()) {
+			writer->rotateNow();
+		}
 
-			return Logger::DONTLOG;
-		});
+		writer->setRotateSizeMB(config->getInt("Core3.TransactionLog.RotateLogSizeMB", config->getRotateLogSizeMB()));
+		writer->setRotateSeconds(config->getInt("Core3.TransactionLog.RotateLogSeconds", 0));
 
-		return log;
+		return writer;
 	} ();
 
+	static bool trxLogEnabled = ConfigManager::instance()->getLogLevel("Core3.TransactionLog.LogLevel", Logger::DEBUG) >= Logger::INFO;
+
 	if (mLogged) {
 		auto trace = StackTrace();
 		getLogger().error() << "Duplicate write for trx " << *this << endl << "STACK: " << trace.toStringData();
@@ -853,7 +844,9 @@ void TransactionLog::writeLog() {
 	String logEntry = composeLogEntry();
 
 	// Write to local file (always)
-	trxLog.info() << logEntry;
+	if (trxLogEnabled) {
+		trxLog->write(logEntry);
+	}
 
 #ifdef WITH_SWGREALMS_API
 	// Stream to SWGRealms (if enabled)
@@ -898,18 +891,10 @@ const String& TransactionLog::getVersion() {
 	return version;
 }
 
-#define CONFIG_CACHED_BOOL_GETTER(name, defaultValue)                                                      \
-	bool TransactionLog::get##name() {                                                                     \
-		static Mutex mutex;                                                                                \
-		Locker guard(&mutex);                                                                              \
-		static bool cachedValue = defaultValue;                                                            \
-		static uint64 cachedVersion = 0;                                                                   \
-		auto configVersion = ConfigManager::instance()->getConfigVersion();                                \
-		if (configVersion > cachedVersion) {                                                               \
-			cachedVersion = configVersion;                                                                 \
-			cachedValue = ConfigManager::instance()->getBool("Core3.TransactionLog." #name, defaultValue); \
-		}                                                                                                  \
-		return cachedValue;                                                                                \
+#define CONFIG_CACHED_BOOL_GETTER(name, defaultValue)                                 \
+	bool TransactionLog::get##name() {                                                \
+		static ConfigHandle<bool> value("Core3.TransactionLog." #name, defaultValue); \
+		return value.get();                                                           \
 	}
 
 CONFIG_CACHED_BOOL_GETTER(Enabled, false)
@@ -11,10 +11,35 @@
 class DeltaMessage : public BaseMessage {
 	int updateCount;
 
+	uint64 objectID;
+	uint32 objectName;
+	uint8 packageType;
+
+public:
+	// BaseMessage reserves 4 bytes ahead of the operand count, then comes the header
+	// opcode, object id, object name, package type, update size and update count
+	static constexpr int OPCODE_OFFSET = 4 + 2;
+	static constexpr int UPDATE_SIZE_OFFSET = OPCODE_OFFSET + 4 + 8 + 4 + 1;
+	static constexpr int UPDATE_COUNT_OFFSET = UPDATE_SIZE_OFFSET + 4;
+	static constexpr int HEADER_SIZE = UPDATE_COUNT_OFFSET + 2;
+
+	static constexpr uint32 OPCODE = 0x12862153;
+
+	// Updates past this count are not recorded and make the message unmergeable
+	static constexpr int MAX_RECORDED_UPDATES = 16;
+
+private:
+	// Offset, variable index and replaceable flag of the first updates, used to merge deltas
+	uint64 updateRecords[MAX_RECORDED_UPDATES];
+
 public:
 	DeltaMessage(uint64 oid, uint32 name, uint8 type) {
+		objectID = oid;
+		objectName = name;
+		packageType = type;
+
 		insertShort(0x05);
-		insertInt(0x12862153);
+		insertInt(OPCODE);
 		insertLong(oid);
 		insertInt(name);
 		insertByte(type);
@@ -26,8 +51,24 @@ public:
 		insertShort(updateCount);
 	}
 
-	inline void startUpdate(uint16 type) {
+	/**
+	 * Builds a delta of object, dropping its cached baselines as they no longer match
+	 */
+	template<class O>
+	DeltaMessage(O* object, uint32 name, uint8 type) : DeltaMessage(object->getObjectID(), name, type) {
+		object->invalidateBaselines();
+	}
+
+	/**
+	 * @param replaceable true if the update sets the whole value of the variable
+	 * so a later update of the same variable supersedes it
+	 */
+	inline void startUpdate(uint16 type, bool replaceable = false) {
+		if (updateCount < MAX_RECORDED_UPDATES)
+			updateRecords[updateCount] = ((uint64) size() << 32) | ((uint64) type << 1) | (replaceable ? 1 : 0);
+
 		++updateCount;
+
 		insertShort(type);
 	}
 
@@ -51,50 +92,50 @@ public:
 	}*/
 
 	inline void addByteUpdate(uint16 type, uint8 value) {
-		startUpdate(type);
+		startUpdate(type, true);
 		insertByte(value);
 	}
 
 	inline void addShortUpdate(uint16 type, uint16 value) {
-		startUpdate(type);
+		startUpdate(type, true);
 		insertShort(value);
 	}
 
 	inline void addIntUpdate(uint16 type, uint32 value) {
-		startUpdate(type);
+		startUpdate(type, true);
 		insertInt(value);
 	}
 
 	inline void addLongUpdate(uint16 type, uint64 value) {
-		startUpdate(type);
+		startUpdate(type, true);
 		insertLong(value);
 	}
 
 	inline void addFloatUpdate(uint16 type, float value) {
-		startUpdate(type);
+		startUpdate(type, true);
 		insertFloat(value);
 	}
 
 	inline void addAsciiUpdate(uint16 type, const String& val) {
-		startUpdate(type);
+		startUpdate(type, true);
 		insertAscii(val.toCharArray());
 	}
 
 	inline void addStringIdUpdate(uint16 type, const StringId& val) {
-		startUpdate(type);
+		startUpdate(type, true);
 		insertAscii(val.getFile());
 		insertInt(0);
 		insertAscii(val.getStringID());
 	}
 
 	inline void addUnicodeUpdate(uint16 type, const String& val) {
-		startUpdate(type);
+		startUpdate(type, true);
 		UnicodeString v = UnicodeString(val);
 		insertUnicode(v);
 	}
 
 	inline void addUnicodeUpdate(uint16 type, const UnicodeString& val) {
-		startUpdate(type);
+		startUpdate(type, true);
 		insertUnicode(val);
 	}
 
@@ -154,9 +195,71 @@ public:
 		insertAscii(value.toCharArray());
 	}
 
+	/**
+	 * Copies the update at index of a closed delta message of the same object
+	 */
+	void appendUpdate(DeltaMessage* message, int index) {
+		uint64 record = message->updateRecords[index];
+
+		int offset = (int) (record >> 32);
+		int end = index + 1 < message->updateCount ? (int) (message->updateRecords[index + 1] >> 32) : message->size();
+
+		if (updateCount < MAX_RECORDED_UPDATES)
+			updateRecords[updateCount] = ((uint64) size() << 32) | (record & 0xFFFFFFFF);
+
+		++updateCount;
+
+		writeStream(message->getBuffer() + offset, end - offset);
+	}
+
 	inline void close() {
-		insertInt(23, size() - 27);
-		insertShort(27, updateCount);
+		insertInt(UPDATE_SIZE_OFFSET, size() - UPDATE_COUNT_OFFSET);
+		insertShort(UPDATE_COUNT_OFFSET, updateCount);
+	}
+
+	inline uint64 getObjectID() const {
+		return objectID;
+	}
+
+	inline uint32 getObjectName() const {
+		return objectName;
+	}
+
+	inline uint8 getPackageType() const {
+		return packageType;
+	}
+
+	inline int getUpdateCount() const {
+		return updateCount;
+	}
+
+	inline uint16 getUpdateType(int index) const {
+		return (uint16) ((updateRecords[index] >> 1) & 0xFFFF);
+	}
+
+	inline bool isReplaceableUpdate(int index) const {
+		return updateRecords[index] & 1;
+	}
+
+	/**
+	 * @return true if every update of this message was recorded and can be merged
+	 */
+	inline bool isMergeable() const {
+		return updateCount > 0 && updateCount <= MAX_RECORDED_UPDATES;
+	}
+
+	/**
+	 * Cheap check of the opcode. Broadcast copies of a delta carry it too but
+	 * are plain packets, so the dynamic type still has to be checked on a match.
+	 */
+	static bool hasDeltaOpcode(BasePacket* packet) {
+		if (packet->size() < HEADER_SIZE)
+			return false;
+
+		uint32 opcode;
+		memcpy(&opcode, packet->getBuffer() + OPCODE_OFFSET, sizeof(opcode));
+
+		return opcode == OPCODE;
 	}
 
 };
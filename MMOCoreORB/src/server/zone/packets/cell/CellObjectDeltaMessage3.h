@@ -14,7 +14,7 @@ class CellObjectDeltaMessage3 : public DeltaMessage {
 
 public:
 	CellObjectDeltaMessage3(CellObject* co)
-			: DeltaMessage(co->getObjectID(), 0x53434C54, 3) {
+			: DeltaMessage(co, 0x53434C54, 3) {
 		cell = co;
 	}
 
@@ -12,7 +12,7 @@ class CreatureObjectDeltaMessage1 : public DeltaMessage {
 
 public:
 	CreatureObjectDeltaMessage1(CreatureObjectImplementation* cr)
-			: DeltaMessage(cr->getObjectID(), 0x4352454F, 1) {
+			: DeltaMessage(cr, 0x4352454F, 1) {
 		creo = cr;
 	}
 
@@ -12,7 +12,7 @@ class CreatureObjectDeltaMessage3 : public DeltaMessage {
 	CreatureObject* creo;
 
 public:
-	CreatureObjectDeltaMessage3(CreatureObject* cr) : DeltaMessage(cr->getObjectID(), 0x4352454F, 3) {
+	CreatureObjectDeltaMessage3(CreatureObject* cr) : DeltaMessage(cr, 0x4352454F, 3) {
 		creo = cr;
 	}
 
@@ -11,7 +11,7 @@ class CreatureObjectDeltaMessage4 : public DeltaMessage {
 	CreatureObject* creo;
 
 public:
-	CreatureObjectDeltaMessage4(CreatureObject* cr) : DeltaMessage(cr->getObjectID(), 'CREO', 0x04) {
+	CreatureObjectDeltaMessage4(CreatureObject* cr) : DeltaMessage(cr, 'CREO', 0x04) {
 		creo = cr;
 	}
 
@@ -13,7 +13,7 @@ class FactoryCrateObjectDeltaMessage3 : public DeltaMessage {
 
 public:
 	FactoryCrateObjectDeltaMessage3(FactoryCrate* ta, uint32 objType = 0x46435954)
-			: DeltaMessage(ta->getObjectID(), objType, 3) {
+			: DeltaMessage(ta, objType, 3) {
 		tano = ta;
 	}
 
@@ -12,7 +12,7 @@ class GroupObjectDeltaMessage6 : public DeltaMessage, public Logger {
 	GroupObject* group;
 
 public:
-	GroupObjectDeltaMessage6(GroupObject* gr) : DeltaMessage(gr->getObjectID(), 'GRUP', 0x06) {
+	GroupObjectDeltaMessage6(GroupObject* gr) : DeltaMessage(gr, 'GRUP', 0x06) {
 		//info(true) << "GroupObjectDeltaMessage6 called";
 
 		group = gr;
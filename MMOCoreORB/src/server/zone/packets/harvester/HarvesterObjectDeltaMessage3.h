@@ -13,7 +13,7 @@ class HarvesterObjectDeltaMessage3 : public DeltaMessage {
 	
 public:
 	HarvesterObjectDeltaMessage3(HarvesterObject* ho)
-			: DeltaMessage(ho->getObjectID(), 0x4F4E5449, 3) {
+			: DeltaMessage(ho, 0x4F4E5449, 3) {
 		haro = ho;
 	}
 
@@ -13,7 +13,7 @@ class InstallationObjectDeltaMessage6 : public DeltaMessage {
 
 public:
 	InstallationObjectDeltaMessage6(InstallationObject* ins)
-			: DeltaMessage(ins->getObjectID(), 0x494E534F, 6) {
+			: DeltaMessage(ins, 0x494E534F, 6) {
 		inso = ins;
 	}
 
@@ -13,7 +13,7 @@ class InstallationObjectDeltaMessage7 : public DeltaMessage {
 
 public:
 	InstallationObjectDeltaMessage7(InstallationObject* ins)
-			: DeltaMessage(ins->getObjectID(), 0x494E534F, 7) {
+			: DeltaMessage(ins, 0x494E534F, 7) {
 		inso = ins;
 	}
 
@@ -12,7 +12,7 @@ class IntangibleObjectDeltaMessage3 : public DeltaMessage {
 	IntangibleObject* itno;
 
 public:
-	IntangibleObjectDeltaMessage3(IntangibleObject* it) : DeltaMessage(it->getObjectID(), 0x4F4E5449, 3) {
+	IntangibleObjectDeltaMessage3(IntangibleObject* it) : DeltaMessage(it, 0x4F4E5449, 3) {
 		itno = it;
 	}
 
@@ -13,7 +13,7 @@ class IntangibleObjectDeltaMessage6 : public DeltaMessage {
 	IntangibleObject* itno;
 
 public:
-IntangibleObjectDeltaMessage6(IntangibleObject* it) : DeltaMessage(it->getObjectID(), 0x4F4E5449, 6) {
+IntangibleObjectDeltaMessage6(IntangibleObject* it) : DeltaMessage(it, 0x4F4E5449, 6) {
 		itno = it;
 	}
 
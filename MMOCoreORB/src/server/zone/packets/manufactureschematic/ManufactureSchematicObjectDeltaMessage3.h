@@ -11,7 +11,7 @@
 class ManufactureSchematicObjectDeltaMessage3 : public DeltaMessage {
 public:
 	ManufactureSchematicObjectDeltaMessage3(SceneObject* schematic)
-			: DeltaMessage(schematic->getObjectID(), 0x4D53434F, 3) {
+			: DeltaMessage(schematic, 0x4D53434F, 3) {
 	}
 
 	void updateComplexity(float complexity) {
@@ -11,7 +11,7 @@
 class ManufactureSchematicObjectDeltaMessage6 : public DeltaMessage {
 public:
 	ManufactureSchematicObjectDeltaMessage6(SceneObject* schematic)
-			: DeltaMessage(schematic->getObjectID(), 0x4D53434F, 6) {
+			: DeltaMessage(schematic, 0x4D53434F, 6) {
 	}
 	
 	void insertToResourceSlot(int slotNumber){
@@ -10,7 +10,7 @@
 
 class ManufactureSchematicObjectDeltaMessage7 : public DeltaMessage, public Logger {
 public:
-	ManufactureSchematicObjectDeltaMessage7(SceneObject* schematic) : DeltaMessage(schematic->getObjectID(), 0x4D53434F, 7) {
+	ManufactureSchematicObjectDeltaMessage7(SceneObject* schematic) : DeltaMessage(schematic, 0x4D53434F, 7) {
 		setLoggingName("ManufactureSchematicObjectDeltaMessage7");
 	}
 
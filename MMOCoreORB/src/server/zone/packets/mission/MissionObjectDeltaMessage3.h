@@ -13,7 +13,7 @@ class MissionObjectDeltaMessage3 : public DeltaMessage {
 
 public:
 	MissionObjectDeltaMessage3(MissionObject* mi)
-			: DeltaMessage(mi->getObjectID(), 0x4D49534F, 3) {
+			: DeltaMessage(mi, 0x4D49534F, 3) {
 		miso = mi;
 	}
 
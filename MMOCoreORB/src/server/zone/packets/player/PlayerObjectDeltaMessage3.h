@@ -12,7 +12,7 @@ class PlayerObjectDeltaMessage3 : public DeltaMessage {
 	PlayerObject* ghost;
 
 public:
-	PlayerObjectDeltaMessage3(PlayerObject* pl) : DeltaMessage(pl->getObjectID(), 0x504C4159, 3) {
+	PlayerObjectDeltaMessage3(PlayerObject* pl) : DeltaMessage(pl, 0x504C4159, 3) {
 		ghost = pl;
 	}
 
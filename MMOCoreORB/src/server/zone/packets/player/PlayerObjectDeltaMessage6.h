@@ -13,7 +13,7 @@ class PlayerObjectDeltaMessage6 : public DeltaMessage {
 
 public:
 	PlayerObjectDeltaMessage6(PlayerObject* pl)
-			: DeltaMessage(pl->getObjectID(), 0x504C4159, 6) {
+			: DeltaMessage(pl, 0x504C4159, 6) {
 		play = pl;
 	}
 
@@ -13,7 +13,7 @@ class PlayerObjectDeltaMessage8 : public DeltaMessage {
 
 public:
 	PlayerObjectDeltaMessage8(PlayerObjectImplementation* pl)
-			: DeltaMessage(pl->getObjectID(), 0x504C4159, 8) {
+			: DeltaMessage(pl, 0x504C4159, 8) {
 		play = pl;
 	}
 
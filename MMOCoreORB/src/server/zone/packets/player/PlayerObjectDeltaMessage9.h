@@ -13,7 +13,7 @@ class PlayerObjectDeltaMessage9 : public DeltaMessage {
 
 public:
 	PlayerObjectDeltaMessage9(PlayerObject* pl)
-			: DeltaMessage(pl->getObjectID(), 0x504C4159, 9) {
+			: DeltaMessage(pl, 0x504C4159, 9) {
 		play = pl;
 	}
 
@@ -14,7 +14,7 @@ private:
 
 public:
 	ResourceContainerObjectDeltaMessage3(ResourceContainer* rcno)
-			: DeltaMessage(rcno->getObjectID(), 0x52434E4F, 3) {
+			: DeltaMessage(rcno, 0x52434E4F, 3) {
 		container = rcno;
 	}
 	/*
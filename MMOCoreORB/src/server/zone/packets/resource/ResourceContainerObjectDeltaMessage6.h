@@ -11,7 +11,7 @@
 class ResourceContainerObjectDeltaMessage6 : public DeltaMessage {
 public:
 	ResourceContainerObjectDeltaMessage6(ResourceContainer* rcno)
-			: DeltaMessage(rcno->getObjectID(), 0x52434E4F, 6) {
+			: DeltaMessage(rcno, 0x52434E4F, 6) {
 		// Causes CTD, needs research.
 		//setResourceName(rcno->getName());
 		//setResourceType(rcno->getTemplateName());
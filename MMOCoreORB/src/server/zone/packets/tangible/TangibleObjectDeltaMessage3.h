@@ -16,7 +16,7 @@ class TangibleObjectDeltaMessage3 : public DeltaMessage {
 
 public:
 	TangibleObjectDeltaMessage3(TangibleObject* ta, uint32 objType = 0x54414E4F)
-	: DeltaMessage(ta->getObjectID(), objType, 3) {
+	: DeltaMessage(ta, objType, 3) {
 		tano = ta;
 	}
 
@@ -14,7 +14,7 @@ class TangibleObjectDeltaMessage6 : public DeltaMessage {
 
 public:
 	TangibleObjectDeltaMessage6(TangibleObject* ta, uint32 objType = 0x54414E4F)
-		: DeltaMessage(ta->getObjectID(), objType, 6) {
+		: DeltaMessage(ta, objType, 6) {
 		tano = ta;
 	}
 
@@ -7,6 +7,7 @@
 
 #include "DataArchiveStore.h"
 #include "tre3/TreeArchive.h"
+#include "conf/ConfigManager.h"
 
 DataArchiveStore::DataArchiveStore() : Logger("DataArchiveStore") {
 	treeDirectory = nullptr;
@@ -18,22 +19,34 @@ DataArchiveStore::~DataArchiveStore() {
 }
 
 byte* DataArchiveStore::getData(const String& path, int& size) const {
+	TreeRecordData data;
+
+	getData(path, data);
+
+	size = data.getSize();
+
+	return data.copyBytes();
+}
+
+bool DataArchiveStore::getData(const String& path, TreeRecordData& data) const {
 	//read from local dir else from tres
 	File file(path);
-	byte* data = nullptr;
-	size = 0;
+
+	data.clear();
 
 	try {
 		FileReader test(&file);
 
 		if (file.exists()) {
-			size = file.size();
-			data = new byte[size];
+			int size = file.size();
+			byte* buffer = new byte[size];
 
-			test.read((char*)data, size);
+			test.read((char*)buffer, size);
 			test.close();
 
-			return data;
+			data.setOwned(buffer, size);
+
+			return !data.isEmpty();
 		}
 	} catch (const Exception& e) {
 	}
@@ -41,16 +54,9 @@ byte* DataArchiveStore::getData(const String& path, int& size) const {
 	ReadLocker locker(this);
 
 	if (treeDirectory == nullptr)
-		return nullptr;
+		return false;
 
-	data = treeDirectory->getBytes(path, size);
-
-	if (size == 0) {
-		delete [] data;
-		return nullptr;
-	}
-
-	return data;
+	return treeDirectory->getRecordData(path, data);
 }
 
 int DataArchiveStore::loadTres(const String& path, const Vector<String>& treFilesToLoad) {
@@ -70,7 +76,10 @@ int DataArchiveStore::loadTres(const String& path, const Vector<String>& treFile
 
 	debug("Loading TRE archives...");
 
-	treeDirectory = new TreeArchive();
+	bool memoryMapped = ConfigManager::instance()->getBool("Core3.TreArchive.MemoryMapped", true);
+	uint64 cacheBytes = (uint64) ConfigManager::instance()->getInt("Core3.TreArchive.InflatedCacheSizeMB", 64) * 1024 * 1024;
+
+	treeDirectory = new TreeArchive(memoryMapped, cacheBytes);
 
 	int j = 0;
 
@@ -95,20 +104,17 @@ IffStream* DataArchiveStore::openIffFile(const String& fileName) const {
 
 	IffStream* iffStream = nullptr;
 
-	int size = 0;
-
-	byte* data = getData(fileName, size);
+	TreeRecordData data;
 
-	if (size == 0) {
-		E3_ASSERT(!data);
+	if (!getData(fileName, data))
 		return nullptr;
-	}
 
 	iffStream = new IffStream();
 
 	if (iffStream != nullptr) {
 		try {
-			if (!iffStream->parseChunks(data, size, fileName)) {
+			// The chunks are copied out of the record, the record itself is never written to
+			if (!iffStream->parseChunks(const_cast<byte*>(data.getData()), data.getSize(), fileName)) {
 				delete iffStream;
 				iffStream = nullptr;
 			}
@@ -120,8 +126,6 @@ IffStream* DataArchiveStore::openIffFile(const String& fileName) const {
 		}
 	}
 
-	delete [] data;
-
 	return iffStream;
 }
 
@@ -14,6 +14,7 @@
 #include "system/thread/ReadLocker.h"
 #include "system/thread/Locker.h"
 #include "engine/util/iffstream/IffStream.h"
+#include "tre3/TreeRecordCache.h"
 
 class TreeArchive;
 
@@ -27,6 +28,12 @@ public:
 
 	byte* getData(const String& path, int& size) const;
 
+	/**
+	 * Reads path from the local dir or the tres, without copying it when the tres are memory mapped.
+	 * @return false if the file wasn't found
+	 */
+	bool getData(const String& path, TreeRecordData& data) const;
+
 	int loadTres(const String& path, const Vector<String>& treFilesToLoad);
 
 	IffStream* openIffFile(const String& fileName) const;
@@ -13,32 +13,184 @@
 #include "templates/appearance/AppearanceTemplate.h"
 #include "templates/building/InteriorLayoutTemplate.h"
 
-class PortalLayoutMap : public HashTable<String, Reference<PortalLayout*> > {
+/**
+ * Wait graph shared by every TemplateLoadMap. A thread only waits for a file
+ * another thread is parsing if that thread doesn't end up waiting, through
+ * the files it parses, for one this thread is parsing.
+ */
+class TemplateLoadGraph {
 public:
-	PortalLayoutMap() {
-		setNullValue(nullptr);
+	struct LoaderThread;
+
+	class PendingLoad : public Object {
+	public:
+		Mutex mutex;
+
+		// Thread parsing the entry, nullptr once loaded, guarded by the graph mutex
+		LoaderThread* loader;
+
+		PendingLoad() : loader(nullptr) {
+		}
+	};
+
+	struct LoaderThread {
+		// Entry this thread waits for, guarded by the graph mutex
+		PendingLoad* waitingFor;
+	};
+
+	static LoaderThread* getCurrentThread() {
+		static thread_local LoaderThread thread = { nullptr };
+
+		return &thread;
 	}
-};
 
-class FloorMeshMap : public HashTable<String, Reference<FloorMesh*> > {
-public:
-	FloorMeshMap() {
-		setNullValue(nullptr);
+	static void setLoader(PendingLoad* entry, LoaderThread* loader) {
+		Locker locker(getMutex());
+
+		entry->loader = loader;
 	}
-};
 
-class AppearanceMap : public HashTable<String, Reference<AppearanceTemplate*> > {
-public:
-	AppearanceMap() {
-		setNullValue(nullptr);
+	/**
+	 * Records that the current thread waits for entry.
+	 * @return false if waiting would close a cycle, entry is then being parsed by the
+	 * current thread or by one waiting for it
+	 */
+	static bool beginWait(PendingLoad* entry) {
+		LoaderThread* current = getCurrentThread();
+
+		Locker locker(getMutex());
+
+		for (PendingLoad* next = entry; next != nullptr && next->loader != nullptr; next = next->loader->waitingFor) {
+			if (next->loader == current)
+				return false;
+		}
+
+		current->waitingFor = entry;
+
+		return true;
+	}
+
+	static void endWait() {
+		Locker locker(getMutex());
+
+		getCurrentThread()->waitingFor = nullptr;
+	}
+
+private:
+	static Mutex* getMutex() {
+		static Mutex mutex;
+
+		return &mutex;
 	}
 };
 
-class InteriorMap : public HashTable<String, Reference<InteriorLayoutTemplate*> > {
+/**
+ * Map of client files that are parsed once per file name. The map lock is only
+ * held to find or publish an entry, the parsing runs under the lock of the entry
+ * itself, so different files load in parallel and a reader of a file that is being
+ * parsed only waits for that file.
+ *
+ * Files referencing each other from different threads would wait on each other, so
+ * a request that closes such a cycle gets nullptr, as it would on a single thread.
+ */
+template<class T>
+class TemplateLoadMap {
+	class Entry : public TemplateLoadGraph::PendingLoad {
+	public:
+		Reference<T*> value;
+	};
+
+	HashTable<String, Reference<Entry*> > entries;
+
+	ReadWriteLock lock;
+
+	void dropEntry(const String& fileName, Entry* entry) {
+		Locker locker(&lock);
+
+		if (entries.get(fileName) == entry)
+			entries.remove(fileName);
+	}
+
 public:
-	InteriorMap() {
-		setNullValue(nullptr);
+	TemplateLoadMap() {
+		entries.setNullValue(nullptr);
+	}
+
+	/**
+	 * Returns the value of fileName, running loader if no thread did it yet.
+	 * A file that ends up requesting itself while being parsed gets nullptr.
+	 * Failed loads are not cached, the next request runs loader again.
+	 */
+	template<typename Loader>
+	T* get(const String& fileName, Loader loader) {
+		Reference<Entry*> entry;
+
+		{
+			ReadLocker locker(&lock);
+			entry = entries.get(fileName);
+		}
+
+		if (entry == nullptr) {
+			Reference<Entry*> newEntry = new Entry();
+			TemplateLoadGraph::setLoader(newEntry, TemplateLoadGraph::getCurrentThread());
+
+			Locker entryLocker(&newEntry->mutex);
+
+			{
+				Locker locker(&lock);
+				entry = entries.get(fileName);
+
+				if (entry == nullptr) {
+					entries.put(fileName, newEntry);
+					entry = newEntry;
+				}
+			}
+
+			if (entry == newEntry) {
+				try {
+					newEntry->value = loader();
+				} catch (...) {
+					dropEntry(fileName, newEntry);
+					TemplateLoadGraph::setLoader(newEntry, nullptr);
+					throw;
+				}
+
+				if (newEntry->value == nullptr)
+					dropEntry(fileName, newEntry);
+
+				TemplateLoadGraph::setLoader(newEntry, nullptr);
+
+				return newEntry->value;
+			}
+		}
+
+		if (!TemplateLoadGraph::beginWait(entry))
+			return nullptr;
+
+		Locker entryLocker(&entry->mutex);
+
+		TemplateLoadGraph::endWait();
+
+		return entry->value;
 	}
+
+	int size() {
+		ReadLocker locker(&lock);
+
+		return entries.size();
+	}
+};
+
+class PortalLayoutMap : public TemplateLoadMap<PortalLayout> {
+};
+
+class FloorMeshMap : public TemplateLoadMap<FloorMesh> {
+};
+
+class AppearanceMap : public TemplateLoadMap<AppearanceTemplate> {
+};
+
+class InteriorMap : public TemplateLoadMap<InteriorLayoutTemplate> {
 };
 
 #endif /* PORTALLAYOUTMAP_H_ */
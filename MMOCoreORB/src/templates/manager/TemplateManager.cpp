@@ -5,6 +5,9 @@
  *      Author: victor
  */
 
+#include <condition_variable>
+#include <mutex>
+
 #include "TemplateManager.h"
 #include "TemplateCRCMap.h"
 
@@ -424,6 +427,106 @@ void TemplateManager::loadLuaTemplates() {
 	luaTemplatesInstance = nullptr;
 }
 
+namespace {
+	class TemplatePreloadState : public Object {
+	public:
+		Vector<SharedObjectTemplate*> templates;
+
+		AtomicInteger nextBatch;
+
+		int totalBatches;
+		int finishedBatches;
+
+		// Signalled when the last batch finishes
+		std::mutex finishedMutex;
+		std::condition_variable finishedCondition;
+
+		TemplatePreloadState() : totalBatches(0), finishedBatches(0) {
+		}
+
+		void finishBatch() {
+			std::lock_guard<std::mutex> guard(finishedMutex);
+
+			if (++finishedBatches == totalBatches)
+				finishedCondition.notify_all();
+		}
+
+		void waitForBatches() {
+			std::unique_lock<std::mutex> guard(finishedMutex);
+
+			finishedCondition.wait(guard, [this] { return finishedBatches >= totalBatches; });
+		}
+	};
+
+	const int PRELOAD_BATCH_SIZE = 64;
+}
+
+void TemplateManager::preloadAppearances() {
+	const static int preloadThreads = ConfigManager::instance()->getInt("Core3.TemplateManager.PreloadThreads", 4);
+
+	if (preloadThreads <= 0)
+		return;
+
+	Timer loadTimer;
+	loadTimer.start();
+
+	Reference<TemplatePreloadState*> state = new TemplatePreloadState();
+
+	auto iterator = templateCRCMap->iterator();
+
+	while (iterator.hasNext()) {
+		SharedObjectTemplate* templateObject = iterator.getNextValue();
+
+		if (templateObject == nullptr)
+			continue;
+
+		if (templateObject->getAppearanceFilename().length() > 1 || templateObject->getPortalLayoutFilename().length() > 1)
+			state->templates.add(templateObject);
+	}
+
+	state->totalBatches = (state->templates.size() + PRELOAD_BATCH_SIZE - 1) / PRELOAD_BATCH_SIZE;
+
+	// Threads pull batches until none are left, a template is only touched by one of them
+	auto loadBatches = [this, state] () {
+		int batch;
+
+		while ((batch = state->nextBatch.increment() - 1) < state->totalBatches) {
+			int end = Math::min((batch + 1) * PRELOAD_BATCH_SIZE, state->templates.size());
+
+			for (int i = batch * PRELOAD_BATCH_SIZE; i < end; ++i) {
+				SharedObjectTemplate* templateObject = state->templates.get(i);
+
+				try {
+					templateObject->getPortalLayout();
+
+					AppearanceTemplate* appearance = templateObject->getAppearanceTemplate();
+
+					if (appearance != nullptr && appearance->getFloorMesh().length() > 1)
+						getFloorMesh(appearance->getFloorMesh());
+				} catch (Exception& e) {
+					error() << "could not preload " << templateObject->getFullTemplateString() << ": " << e.getMessage();
+				}
+			}
+
+			state->finishBatch();
+		}
+	};
+
+	const auto static initialized = Core::getTaskManager()->initializeCustomQueue("TemplatePreload", preloadThreads, false);
+
+	for (int i = 0; i < preloadThreads; ++i)
+		Core::getTaskManager()->executeTask(loadBatches, "TemplatePreloadTask", "TemplatePreload");
+
+	// The caller works through the batches as well, so this also completes if the queue is not running yet
+	loadBatches();
+
+	state->waitForBatches();
+
+	info(true) << "Preloaded appearances of " << state->templates.size() << " templates in " << loadTimer.stopMs() << " ms, "
+		<< appearanceMap->size() << " appearances, " << portalLayoutMap->size() << " portal layouts, "
+		<< floorMeshMap->size() << " floor meshes";
+}
+
 void TemplateManager::loadTreArchive() {
 	const auto& path = ConfigManager::instance()->getTrePath();
 
@@ -820,21 +923,12 @@ ObjectInputStream* TemplateManager::openTreFile(const String& fileName) {
 	if (fileName.isEmpty())
 		return nullptr;
 
-	IffStream* iffStream = nullptr;
-
-	int size = 0;
-	//byte* data = treeDirectory->getBytes(fileName, size);
+	TreeRecordData data;
 
-	byte* data = DataArchiveStore::instance()->getData(fileName, size);
-
-	if (size == 0)
+	if (!DataArchiveStore::instance()->getData(fileName, data))
 		return nullptr;
 
-	ObjectInputStream* stream = new ObjectInputStream((char*)data, size);
-
-	delete [] data;
-
-	return stream;
+	return new ObjectInputStream((char*)data.getData(), data.getSize());
 }
 
 IffStream* TemplateManager::openIffFile(const String& fileName) {
@@ -842,63 +936,46 @@ IffStream* TemplateManager::openIffFile(const String& fileName) {
 }
 
 FloorMesh* TemplateManager::getFloorMesh(const String& fileName) {
-	FloorMesh* floorMesh = floorMeshMap->get(fileName);
-
-	if (floorMesh == nullptr) {
-		// read file
-
+	return floorMeshMap->get(fileName, [this, &fileName] () -> FloorMesh* {
 		IffStream* iffStream = openIffFile(fileName);
 
-		if (iffStream != nullptr) {
-			try {
-				floorMesh = new FloorMesh();
+		if (iffStream == nullptr)
+			return nullptr;
 
-				floorMesh->readObject(iffStream);
+		FloorMesh* floorMesh = nullptr;
 
-				debug() << "parsed " << fileName;
-			} catch (Exception& e) {
-				warning() << "could not parse " << fileName;
+		try {
+			floorMesh = new FloorMesh();
 
-				delete floorMesh;
-				floorMesh = nullptr;
-			}
+			floorMesh->readObject(iffStream);
 
-			delete iffStream;
-			iffStream = nullptr;
+			debug() << "parsed " << fileName;
+		} catch (Exception& e) {
+			warning() << "could not parse " << fileName;
 
-			floorMeshMap->put(fileName, floorMesh);
+			delete floorMesh;
+			floorMesh = nullptr;
 		}
-	}
 
-	return floorMesh;
-	//return nullptr;
+		delete iffStream;
+
+		return floorMesh;
+	});
 }
 
 AppearanceTemplate* TemplateManager::getAppearanceTemplate(const String& fileName) {
-	AppearanceTemplate* meshAppearance = nullptr;
-
-	Locker locker(&appearanceMapLock);
-
-	try {
-		meshAppearance = appearanceMap->get(fileName);
-	} catch (...) {
-		error("unreported exception caught in AppearanceTemplate* TemplateManager::getAppearanceTemplate(const String& fileName)");
-	}
-
-	if (meshAppearance == nullptr) {
+	return appearanceMap->get(fileName, [this, &fileName] () -> AppearanceTemplate* {
 		IffStream* iffStream = openIffFile(fileName);
 
-		if (iffStream != nullptr) {
-			meshAppearance = instantiateAppearanceTemplate(iffStream);
+		if (iffStream == nullptr)
+			return nullptr;
 
-			delete iffStream;
-			iffStream = nullptr;
+		AppearanceTemplate* meshAppearance = instantiateAppearanceTemplate(iffStream);
 
-			appearanceMap->put(fileName, meshAppearance);
-		}
-	}
+		delete iffStream;
 
-	return meshAppearance;
+		return meshAppearance;
+	});
 }
 
 AppearanceTemplate* TemplateManager::instantiateAppearanceTemplate(IffStream* iffStream) {
@@ -946,62 +1023,54 @@ AppearanceTemplate* TemplateManager::instantiateAppearanceTemplate(IffStream* if
 }
 
 PortalLayout* TemplateManager::getPortalLayout(const String& fileName) {
-	Locker _locker(&appearanceMapLock);
-
-	PortalLayout* portalLayout = portalLayoutMap->get(fileName);
-
-	if (portalLayout == nullptr) {
+	return portalLayoutMap->get(fileName, [this, &fileName] () -> PortalLayout* {
 		IffStream* iffStream = openIffFile(fileName);
 
-		if (iffStream != nullptr) {
-			try {
-				portalLayout = new PortalLayout();
+		if (iffStream == nullptr)
+			return nullptr;
 
-				portalLayout->readObject(iffStream);
+		PortalLayout* portalLayout = nullptr;
 
-				debug() << "parsed " << fileName;
-			} catch (Exception& e) {
-				warning() << "could not parse " << fileName;
+		try {
+			portalLayout = new PortalLayout();
 
-				delete portalLayout;
-				portalLayout = nullptr;
-			}
+			portalLayout->readObject(iffStream);
 
-			delete iffStream;
-			iffStream = nullptr;
+			debug() << "parsed " << fileName;
+		} catch (Exception& e) {
+			warning() << "could not parse " << fileName;
 
-			portalLayoutMap->put(fileName, portalLayout);
+			delete portalLayout;
+			portalLayout = nullptr;
 		}
-	}
 
-	return portalLayout;
+		delete iffStream;
+
+		return portalLayout;
+	});
 }
 
 InteriorLayoutTemplate* TemplateManager::getInteriorLayout(const String& fileName) {
-	Locker _locker(&appearanceMapLock);
-
-	InteriorLayoutTemplate* interior = interiorMap->get(fileName);
-
-	if (interior == nullptr) {
+	return interiorMap->get(fileName, [this, &fileName] () -> InteriorLayoutTemplate* {
 		IffStream* iffStream = openIffFile(fileName);
 
-		if (iffStream != nullptr) {
-			try {
-				interior = new InteriorLayoutTemplate();
-				interior->readObject(iffStream);
-			} catch (Exception& e) {
-				delete interior;
-				interior = nullptr;
-			}
+		if (iffStream == nullptr)
+			return nullptr;
 
-			delete iffStream;
-			iffStream = nullptr;
+		InteriorLayoutTemplate* interior = nullptr;
 
-			interiorMap->put(fileName, interior);
+		try {
+			interior = new InteriorLayoutTemplate();
+			interior->readObject(iffStream);
+		} catch (Exception& e) {
+			delete interior;
+			interior = nullptr;
 		}
-	}
 
-	return interior;
+		delete iffStream;
+
+		return interior;
+	});
 }
 
 SharedObjectTemplate* TemplateManager::getTemplate(uint32 key) const {
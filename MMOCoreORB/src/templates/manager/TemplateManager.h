@@ -47,8 +47,6 @@ class TemplateManager : public Singleton<TemplateManager>, public Logger, public
 	SynchronizedVectorMap<String, Reference<SlotDescriptor*> > slotDescriptors;
 	SynchronizedVectorMap<String, Reference<ArrangementDescriptor*> > arrangementDescriptors;
 
-	ReadWriteLock appearanceMapLock;
-
 	void loadTreArchive();
 	void loadSlotDefinitions();
 	void loadPlanetMapCategories();
@@ -86,6 +84,13 @@ public:
 
 	virtual void loadLuaTemplates();
 
+	/**
+	 * Parses the appearance, portal layout and floor mesh files referenced by the loaded
+	 * templates on the TemplatePreload queue, so they are not loaded on first use.
+	 * Blocks until every file is parsed.
+	 */
+	void preloadAppearances();
+
 	/**
 	 * Attempts to get the slot descriptor. If the slot descriptor isn't loaded, attempt to load it.
 	 */
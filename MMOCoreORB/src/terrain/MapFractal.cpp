@@ -9,6 +9,8 @@
 
 double MapFractal::log05 = log(0.5);
 
+const int MapFractal::NOISE_BATCH;
+
 using namespace trn::ptat;
 
 MapFractal::MapFractal() {
@@ -60,6 +62,20 @@ float MapFractal::getNoise(float x, float y, int i, int j) {
 			break;
 	}
 
+	return applyBiasAndGain(result);
+}
+
+float MapFractal::getNoise(float x, int i, int j) {
+	float v39 = x * xFrequency;
+
+	double result = 0;
+
+	result = calculateCombination1(v39);
+
+	return applyBiasAndGain(result);
+}
+
+double MapFractal::applyBiasAndGain(double result) const {
 	if (bias) {
 		result = pow(result, log(biasValue) / log05);
 	}
@@ -91,42 +107,122 @@ float MapFractal::getNoise(float x, float y, int i, int j) {
 	return result;
 }
 
-float MapFractal::getNoise(float x, int i, int j) {
-	float v39 = x * xFrequency;
-
-	double result = 0;
+void MapFractal::getNoiseRow(const float* x, float y, int count, float* results) const {
+	float v41 = y * yFrequency;
 
-	result = calculateCombination1(v39);
+	float v39[NOISE_BATCH];
+	double combined[NOISE_BATCH];
+
+	for (int offset = 0; offset < count; offset += NOISE_BATCH) {
+		int batchCount = Math::min(NOISE_BATCH, count - offset);
+
+		for (int i = 0; i < batchCount; ++i)
+			v39[i] = x[offset + i] * xFrequency;
+
+		switch (combination) {
+			case 0:
+			case 1:
+				calculateCombinationRow<1>(v39, v41, batchCount, combined);
+				break;
+			case 2:
+				calculateCombinationRow<2>(v39, v41, batchCount, combined);
+				break;
+			case 3:
+				calculateCombinationRow<3>(v39, v41, batchCount, combined);
+				break;
+			case 4:
+				calculateCombinationRow<4>(v39, v41, batchCount, combined);
+				break;
+			case 5:
+				calculateCombinationRow<5>(v39, v41, batchCount, combined);
+				break;
+			default:
+				for (int i = 0; i < batchCount; ++i)
+					combined[i] = 0;
+				break;
+		}
 
-	if (bias) {
-		result = pow(result, log(biasValue) / log05);
+		for (int i = 0; i < batchCount; ++i)
+			results[offset + i] = applyBiasAndGain(combined[i]);
 	}
+}
 
-	if (gainType) {
-		if (result < 0.001) {
-			result = 0;
+/**
+ * Row version of calculateCombination1..5, the octaves of every point are
+ * accumulated with the same expressions as the single point functions.
+ */
+template<int combinationType>
+void MapFractal::calculateCombinationRow(const float* v39, float v41, int count, double* results) const {
+	float v48 = 1.0;
+	float v47 = 1.0;
+	float v42 = v41 + zOffset; // + 16 = z.offset
 
-			return result;
-		}
+	float sums[NOISE_BATCH];
+	double coords[NOISE_BATCH];
+	float octaveNoise[NOISE_BATCH];
 
-		if (result > 0.999) {
-			result = 1.0;
+	for (int i = 0; i < count; ++i)
+		sums[i] = 0;
 
-			return result;
+	for (int octave = 0; octave < octaves; ++octave) {
+		for (int i = 0; i < count; ++i) {
+			float v36 = v39[i] + xOffset; // + 12 = x.offset
+			coords[i] = v36 * v48;
 		}
 
-		double v40 = log(1.0 - gainValue) / log05;
-
-		if (result < 0.5) {
-			result = pow(result * 2, v40) * 0.5;
-
-			return result;
+		noise->noise2Row(coords, v42 * v48, count, octaveNoise);
+
+		for (int i = 0; i < count; ++i) {
+			float value = octaveNoise[i];
+
+			switch (combinationType) {
+			case 1:
+				sums[i] = value * v47 + sums[i];
+				break;
+			case 2:
+				sums[i] = (1.0 - fabs(value)) * v47 + sums[i];
+				break;
+			case 3:
+				sums[i] = fabs(value) * v47 + sums[i];
+				break;
+			case 4:
+				if (value >= 0.0) {
+					if (value > 1.0)
+						value = 1.0;
+				} else {
+					value = 0.0;
+				}
+
+				sums[i] = (1.0 - value) * v47 + sums[i];
+				break;
+			case 5:
+				if (value >= 0.0) {
+					if (value > 1.0)
+						value = 1.0;
+				} else {
+					value = 0.0;
+				}
+
+				sums[i] = value * v47 + sums[i];
+				break;
+			}
 		}
 
-		result = 1.0 - pow((1.0 - result) * 2, v40) * 0.5;
+		v48 = v48 * octavesParam; // + 24 octaves param
+		v47 = v47 * amplitude; // + 28 amplitude
 	}
 
-	return result;
+	for (int i = 0; i < count; ++i) {
+		float sum = sums[i];
+
+		if (unkown) // v6 + 52 initialized to 0
+			sum = sin(sum + v39[i]);
+
+		if (combinationType == 1)
+			results[i] = (sum * offset32 + 1.0) * 0.5; //  v6 + 32 initialized to 1.0
+		else
+			results[i] = sum * offset32;
+	}
 }
 
 void MapFractal::parseFromIffStream(engine::util::IffStream* iffStream) {
@@ -35,7 +35,15 @@ class MapFractal : public TemplateVariable<'MFRC'> {
 
 	float offset32;
 
+	double applyBiasAndGain(double result) const;
+
+	template<int combinationType>
+	void calculateCombinationRow(const float* v39, float v41, int count, double* results) const;
+
 public:
+	// Points a row evaluation works on at once
+	static const int NOISE_BATCH = 64;
+
 	MapFractal();
 
 	~MapFractal() {
@@ -52,6 +60,11 @@ public:
 	float getNoise(float x, float y, int i = 0, int  j = 0);
 	float getNoise(float x, int i = 0, int j = 0);
 
+	/**
+	 * Noise of count points sharing the same y, results match getNoise on every point.
+	 */
+	void getNoiseRow(const float* x, float y, int count, float* results) const;
+
 	double calculateCombination1(float v39);
 	double calculateCombination1(float xfreq, float yfreq);
 	double calculateCombination2(float xfreq, float yfreq);
@@ -23,6 +23,10 @@
 #include "Random.h"
 #include <cmath>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 class PerlinNoise {
 	int p[B + B + 2];
 	//float g3[B + B + 2][3];
@@ -133,6 +137,117 @@ public:
 		return lerp(sy, a, b);
 	}
 
+	/**
+	 * noise2 of count points sharing the same y, the lattice setup of y is only done
+	 * once for the row. Results are the same as calling noise2 for every point.
+	 */
+	void noise2Row(const double* xs, double y, int count, float* results) const {
+		int bx0, bx1, by0, by1, b00, b10, b01, b11, negx, negy;
+		double rx0, rx1, ry0, ry1;
+		double t, sx, sy, a, b, u, v;
+		double vec[1];
+		const float *q;
+		int i, j;
+
+		E3_ASSERT(!start);
+
+		vec[0] = y;
+
+		setup(0, by0,by1, ry0,ry1,negy);
+
+		sy = s_curve(ry0);
+
+		int k = 0;
+
+#ifdef __SSE2__
+		const __m128d ry0Lanes = _mm_set1_pd(ry0);
+		const __m128d ry1Lanes = _mm_set1_pd(ry1);
+		const __m128d syLanes = _mm_set1_pd(sy);
+		const __m128d ones = _mm_set1_pd(1.);
+		const __m128d twos = _mm_set1_pd(2.);
+		const __m128d threes = _mm_set1_pd(3.);
+
+		for (; k + 2 <= count; k += 2) {
+			double rx0Values[2];
+			double gradients[8][2];
+
+			for (int lane = 0; lane < 2; ++lane) {
+				vec[0] = xs[k + lane];
+
+				setup(0, bx0,bx1, rx0,rx1,negx);
+
+				i = p[ bx0 ];
+				j = p[ bx1 ];
+
+				rx0Values[lane] = rx0;
+
+				gradients[0][lane] = g2[ p[ i + by0 ] ][0];
+				gradients[1][lane] = g2[ p[ i + by0 ] ][1];
+				gradients[2][lane] = g2[ p[ j + by0 ] ][0];
+				gradients[3][lane] = g2[ p[ j + by0 ] ][1];
+				gradients[4][lane] = g2[ p[ i + by1 ] ][0];
+				gradients[5][lane] = g2[ p[ i + by1 ] ][1];
+				gradients[6][lane] = g2[ p[ j + by1 ] ][0];
+				gradients[7][lane] = g2[ p[ j + by1 ] ][1];
+			}
+
+			__m128d rx0Lanes = _mm_loadu_pd(rx0Values);
+			__m128d rx1Lanes = _mm_sub_pd(rx0Lanes, ones);
+
+			// Same operations in the same order as the scalar path
+			__m128d sxLanes = _mm_mul_pd(_mm_mul_pd(rx0Lanes, rx0Lanes), _mm_sub_pd(threes, _mm_mul_pd(twos, rx0Lanes)));
+
+			__m128d u0 = _mm_add_pd(_mm_mul_pd(rx0Lanes, _mm_loadu_pd(gradients[0])), _mm_mul_pd(ry0Lanes, _mm_loadu_pd(gradients[1])));
+			__m128d v0 = _mm_add_pd(_mm_mul_pd(rx1Lanes, _mm_loadu_pd(gradients[2])), _mm_mul_pd(ry0Lanes, _mm_loadu_pd(gradients[3])));
+			__m128d aLanes = _mm_add_pd(u0, _mm_mul_pd(sxLanes, _mm_sub_pd(v0, u0)));
+
+			__m128d u1 = _mm_add_pd(_mm_mul_pd(rx0Lanes, _mm_loadu_pd(gradients[4])), _mm_mul_pd(ry1Lanes, _mm_loadu_pd(gradients[5])));
+			__m128d v1 = _mm_add_pd(_mm_mul_pd(rx1Lanes, _mm_loadu_pd(gradients[6])), _mm_mul_pd(ry1Lanes, _mm_loadu_pd(gradients[7])));
+			__m128d bLanes = _mm_add_pd(u1, _mm_mul_pd(sxLanes, _mm_sub_pd(v1, u1)));
+
+			double values[2];
+			_mm_storeu_pd(values, _mm_add_pd(aLanes, _mm_mul_pd(syLanes, _mm_sub_pd(bLanes, aLanes))));
+
+			results[k] = values[0];
+			results[k + 1] = values[1];
+		}
+#endif
+
+		for (; k < count; ++k) {
+			vec[0] = xs[k];
+
+			setup(0, bx0,bx1, rx0,rx1,negx);
+
+			i = p[ bx0 ];
+			j = p[ bx1 ];
+
+			b00 = p[ i + by0 ];
+			b10 = p[ j + by0 ];
+			b01 = p[ i + by1 ];
+			b11 = p[ j + by1 ];
+
+			sx = s_curve(rx0);
+
+			q = g2[ b00 ] ;
+			u = at2(rx0,ry0);
+
+			q = g2[ b10 ] ;
+			v = at2(rx1,ry0);
+
+			a = lerp(sx, u, v);
+
+			q = g2[ b01 ] ;
+			u = at2(rx0,ry1);
+
+			q = g2[ b11 ] ;
+			v = at2(rx1,ry1);
+
+			b = lerp(sx, u, v);
+
+			results[k] = lerp(sy, a, b);
+		}
+	}
+
 	static void normalize2(float v[2]) {
 		double s;
 
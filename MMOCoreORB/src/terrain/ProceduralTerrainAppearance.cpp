@@ -11,6 +11,8 @@
 #include "layer/boundaries/Boundary.h"
 #include "layer/affectors/AffectorHeightConstant.h"
 
+const int ProceduralTerrainAppearance::MAX_ROW_SAMPLES;
+
 ProceduralTerrainAppearance::ProceduralTerrainAppearance() : Logger("ProceduralTerrainAppearance") {
 	terrainGenerator = new TerrainGenerator(this);
 	terrainMaps = new TerrainMaps();
@@ -398,6 +400,194 @@ float ProceduralTerrainAppearance::processTerrain(const Layer* layer, float x, f
 	return transformValue;
 }
 
+/**
+ * processTerrain for the points x of the row y. Every rule runs over all the points it
+ * applies to before the next one, each point still sees its rules in the same order
+ * and with the same early outs, so the results match processTerrain. Boundaries whose
+ * bounds miss the row are skipped without being evaluated.
+ */
+void ProceduralTerrainAppearance::processTerrainRow(const Layer* layer, const float* x, float y, int count, float* baseValues, const float* affectorTransformValues, int affectorType) const {
+	const Vector<Boundary*>* boundaries = layer->getBoundaries();
+	const Vector<AffectorProceduralRule*>* affectors = layer->getAffectors();
+	const Vector<FilterProceduralRule*>* filters = layer->getFilters();
+
+	float transformValues[MAX_ROW_SAMPLES];
+	FilterRectangle rects[MAX_ROW_SAMPLES];
+
+	float rowMinX = FLT_MAX, rowMaxX = -FLT_MAX;
+
+	for (int i = 0; i < count; ++i) {
+		transformValues[i] = 0;
+
+		rects[i].minX = FLT_MAX, rects[i].maxX = -FLT_MAX, rects[i].minY = FLT_MAX, rects[i].maxY = -FLT_MAX;
+
+		if (x[i] < rowMinX)
+			rowMinX = x[i];
+
+		if (x[i] > rowMaxX)
+			rowMaxX = x[i];
+	}
+
+	bool hasBoundaries = false;
+
+	for (int j = 0; j < boundaries->size(); ++j) {
+		const Boundary* boundary = boundaries->get(j);
+
+		if (!boundary->isEnabled())
+			continue;
+		else
+			hasBoundaries = true;
+
+		// A boundary is 0 outside of its bounds and feathering keeps 0 at 0
+		if (y < boundary->getMinY() || y > boundary->getMaxY() || rowMaxX < boundary->getMinX() || rowMinX > boundary->getMaxX())
+			continue;
+
+		int featheringType = boundary->getFeatheringType();
+
+		for (int i = 0; i < count; ++i) {
+			if (transformValues[i] >= 1)
+				continue;
+
+			float result = boundary->process(x[i], y);
+
+			if (result != 0.0) {
+				FilterRectangle& rect = rects[i];
+
+				if (boundary->getMinX() < rect.minX)
+					rect.minX = boundary->getMinX();
+
+				if (boundary->getMaxX() > rect.maxX)
+					rect.maxX = boundary->getMaxX();
+
+				if (boundary->getMinY() < rect.minY)
+					rect.minY = boundary->getMinY();
+
+				if (boundary->getMaxY() > rect.maxY)
+					rect.maxY = boundary->getMaxY();
+			}
+
+			result = calculateFeathering(result, featheringType);
+
+			if (result > transformValues[i])
+				transformValues[i] = result;
+		}
+	}
+
+	int active[MAX_ROW_SAMPLES];
+	int activeCount = 0;
+
+	for (int i = 0; i < count; ++i) {
+		if (!hasBoundaries)
+			transformValues[i] = 1.0;
+
+		if (layer->invertBoundaries())
+			transformValues[i] = 1.0 - transformValues[i];
+
+		if (transformValues[i] != 0)
+			active[activeCount++] = i;
+	}
+
+	if (activeCount == 0)
+		return;
+
+	float batchX[MAX_ROW_SAMPLES];
+	float batchTransforms[MAX_ROW_SAMPLES];
+	float batchValues[MAX_ROW_SAMPLES];
+	float results[MAX_ROW_SAMPLES];
+
+	// Points drop out of the filters once one of them gives 0
+	int filtered[MAX_ROW_SAMPLES];
+	int filteredCount = activeCount;
+
+	for (int k = 0; k < activeCount; ++k)
+		filtered[k] = active[k];
+
+	for (int j = 0; j < filters->size() && filteredCount > 0; ++j) {
+		FilterProceduralRule* filter = filters->get(j);
+
+		if (!filter->isEnabled())
+			continue;
+
+		FilterRectangle batchRects[MAX_ROW_SAMPLES];
+
+		for (int k = 0; k < filteredCount; ++k) {
+			int i = filtered[k];
+
+			batchX[k] = x[i];
+			batchTransforms[k] = transformValues[i];
+			batchValues[k] = baseValues[i];
+			batchRects[k] = rects[i];
+		}
+
+		filter->processRow(batchX, y, filteredCount, batchTransforms, batchValues, terrainGenerator, batchRects, results);
+
+		int featheringType = filter->getFeatheringType();
+		int remaining = 0;
+
+		for (int k = 0; k < filteredCount; ++k) {
+			int i = filtered[k];
+
+			baseValues[i] = batchValues[k];
+
+			float result = calculateFeathering(results[k], featheringType);
+
+			if (transformValues[i] > result)
+				transformValues[i] = result;
+
+			if (transformValues[i] != 0)
+				filtered[remaining++] = i;
+		}
+
+		filteredCount = remaining;
+	}
+
+	int affected = 0;
+
+	for (int k = 0; k < activeCount; ++k) {
+		int i = active[k];
+
+		if (layer->invertFilters())
+			transformValues[i] = 1.0 - transformValues[i];
+
+		if (transformValues[i] != 0)
+			active[affected++] = i;
+	}
+
+	if (affected == 0)
+		return;
+
+	// Affectors and children run on the compacted points
+	for (int k = 0; k < affected; ++k) {
+		int i = active[k];
+
+		batchX[k] = x[i];
+		batchTransforms[k] = transformValues[i] * affectorTransformValues[i];
+		batchValues[k] = baseValues[i];
+	}
+
+	for (int j = 0; j < affectors->size(); ++j) {
+		AffectorProceduralRule* affector = affectors->get(j);
+
+		if (!affector->isEnabled()) // filtered in height affectors vector
+			continue;
+
+		if (affector->getAffectorType() & affectorType)
+			affector->processRow(batchX, y, affected, batchTransforms, batchValues, terrainGenerator);
+	}
+
+	const Vector<Layer*>* children = layer->getChildren();
+
+	for (int j = 0; j < children->size(); ++j) {
+		const Layer* child = children->get(j);
+
+		if (child->isEnabled())
+			processTerrainRow(child, batchX, y, affected, batchValues, batchTransforms, affectorType);
+	}
+
+	for (int k = 0; k < affected; ++k)
+		baseValues[active[k]] = batchValues[k];
+}
+
 int ProceduralTerrainAppearance::getEnvironmentID(float x, float y) const {
 	ReadLocker locker(&guard);
 
@@ -430,6 +620,42 @@ int ProceduralTerrainAppearance::getEnvironmentID(float x, float y) const {
 float ProceduralTerrainAppearance::getHeight(float x, float y) const {
 	ReadLocker locker(&guard);
 
+	return calculateHeight(x, y);
+}
+
+void ProceduralTerrainAppearance::getHeights(float x, float y, float step, int count, float* heights) const {
+	ReadLocker locker(&guard);
+
+	float xs[MAX_ROW_SAMPLES];
+	float affectorTransforms[MAX_ROW_SAMPLES];
+
+	for (int offset = 0; offset < count; offset += MAX_ROW_SAMPLES) {
+		int rowCount = Math::min(MAX_ROW_SAMPLES, count - offset);
+		float* rowHeights = heights + offset;
+
+		for (int i = 0; i < rowCount; ++i) {
+			xs[i] = x + (offset + i) * step;
+			affectorTransforms[i] = 1.0;
+			rowHeights[i] = 0;
+		}
+
+		int customIndex = 0;
+		const TerrainGenerator* terrain = terrainGenerator;
+
+		do {
+			const Vector<Layer*>* layers = terrain->getLayersGroup()->getLayers();
+
+			for (int i = 0; i < layers->size(); ++i) {
+				const Layer* layer = layers->get(i);
+
+				if (layer->isEnabled())
+					processTerrainRow(layer, xs, y, rowCount, rowHeights, affectorTransforms, AffectorProceduralRule::HEIGHTTYPE);
+			}
+		} while (customIndex < customTerrain.size() && (terrain = customTerrain.get(customIndex++)));
+	}
+}
+
+float ProceduralTerrainAppearance::calculateHeight(float x, float y) const {
 	float affectorTransform = 1.0;
 
 	float transformValue = 0;
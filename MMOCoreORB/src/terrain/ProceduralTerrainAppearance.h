@@ -72,13 +72,18 @@ class ProceduralTerrainAppearance : public TemplateVariable<'PTAT'>, public Logg
 protected:
 	static float calculateFeathering(float value, int featheringType);
 	float processTerrain(const Layer* layer, float x, float y, float& baseValue, float affectorTransformValue, int affectorType) const;
+	void processTerrainRow(const Layer* layer, const float* x, float y, int count, float* baseValues, const float* affectorTransformValues, int affectorType) const;
 	Layer* getLayerRecursive(float x, float y, Layer* rootParent) const;
 	Layer* getLayer(float x, float y) const;
+	float calculateHeight(float x, float y) const;
 
 	void translateBoundaries(Layer* layer, float x, float y);
 	void setHeight(Layer* layer, float height);
 
 public:
+	// Points of a row processTerrainRow works on at once
+	static const int MAX_ROW_SAMPLES = 80;
+
 	ProceduralTerrainAppearance();
 	~ProceduralTerrainAppearance();
 
@@ -93,6 +98,10 @@ public:
 
 	void getWaterBoundariesInAABB(const AABB& bounds, Vector<const Boundary*>* boundariesOut) const;
 
+	const Vector<Boundary*>& getWaterBoundaries() const {
+		return waterBoundaries;
+	}
+
 	/**
 	 * Returns the size of the terrain.
 	 * @return float The size of the terrain.
@@ -103,6 +112,7 @@ public:
 
 	bool getWater(float x, float y, float& waterHeight) const override;
 	float getHeight(float x, float y) const override;
+	void getHeights(float x, float y, float step, int count, float* heights) const override;
 	int getEnvironmentID(float x, float y) const;
 
 	float getGlobalWaterTableHeight() const {
@@ -20,6 +20,14 @@ public:
 		return 0;
 	}
 
+	/**
+	 * Fills heights with count samples of the row starting at x, y spaced step apart.
+	 */
+	virtual void getHeights(float x, float y, float step, int count, float* heights) const {
+		for (int i = 0; i < count; ++i)
+			heights[i] = getHeight(x + i * step, y);
+	}
+
 	virtual bool getWater(float x, float y, float& waterHeight) const {
 		return false;
 	}
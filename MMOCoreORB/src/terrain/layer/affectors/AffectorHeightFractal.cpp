@@ -8,24 +8,19 @@
 #include "AffectorHeightFractal.h"
 #include "../../TerrainGenerator.h"
 
-void AffectorHeightFractal::process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator) {
-	if (transformValue == 0)
-		return;
-
+MapFractal* AffectorHeightFractal::getFractal(TerrainGenerator* terrainGenerator) {
 	if (mfrc == nullptr) {
 		mfrc = terrainGenerator->getMfrc(fractalId);
 
 		if (mfrc == nullptr) {
 			System::out << "error out of bounds fractal id for affector " << informationHeader.getDescription() << endl;
-
-			return;
 		}
 	}
 
-	float noiseResult = mfrc->getNoise(x, y, 0, 0) * height;
-
-	//System::out << "noiseResult " << noiseResult << " height:" << height << endl;
+	return mfrc;
+}
 
+float AffectorHeightFractal::applyNoise(float noiseResult, float transformValue, float baseValue) const {
 	float result;
 
 	switch (operationType) {
@@ -46,7 +41,43 @@ void AffectorHeightFractal::process(float x, float y, float transformValue, floa
 		break;
 	}
 
-	baseValue = result;
+	return result;
+}
+
+void AffectorHeightFractal::process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator) {
+	if (transformValue == 0)
+		return;
+
+	if (getFractal(terrainGenerator) == nullptr)
+		return;
+
+	float noiseResult = mfrc->getNoise(x, y, 0, 0) * height;
+
+	baseValue = applyNoise(noiseResult, transformValue, baseValue);
+}
+
+void AffectorHeightFractal::processRow(const float* x, float y, int count, const float* transformValues, float* baseValues, TerrainGenerator* terrainGenerator) {
+	if (getFractal(terrainGenerator) == nullptr)
+		return;
+
+	float noise[MapFractal::NOISE_BATCH];
+
+	for (int offset = 0; offset < count; offset += MapFractal::NOISE_BATCH) {
+		int batchCount = Math::min(MapFractal::NOISE_BATCH, count - offset);
+
+		mfrc->getNoiseRow(x + offset, y, batchCount, noise);
+
+		for (int i = 0; i < batchCount; ++i) {
+			float transformValue = transformValues[offset + i];
+
+			if (transformValue == 0)
+				continue;
+
+			float noiseResult = noise[i] * height;
+
+			baseValues[offset + i] = applyNoise(noiseResult, transformValue, baseValues[offset + i]);
+		}
+	}
 }
 
 void AffectorHeightFractal::parseFromIffStream(engine::util::IffStream* iffStream) {
@@ -19,12 +19,16 @@ class AffectorHeightFractal : public ProceduralRule<'AHFR'>, public AffectorProc
 	float height;
 	MapFractal* mfrc;
 
+	MapFractal* getFractal(TerrainGenerator* terrainGenerator);
+	float applyNoise(float noiseResult, float transformValue, float baseValue) const;
+
 public:
 	AffectorHeightFractal() : fractalId(0), operationType(0), height(0), mfrc(nullptr) {
 		affectorType = HEIGHTFRACTAL;
 	}
 
 	void process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator);
+	void processRow(const float* x, float y, int count, const float* transformValues, float* baseValues, TerrainGenerator* terrainGenerator);
 
 	void parseFromIffStream(engine::util::IffStream* iffStream);
 	void parseFromIffStream(engine::util::IffStream* iffStream, Version<'0003'>);
@@ -32,6 +32,14 @@ public:
 	virtual void process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator) {
 	}
 
+	/**
+	 * process for count points of the row y.
+	 */
+	virtual void processRow(const float* x, float y, int count, const float* transformValues, float* baseValues, TerrainGenerator* terrainGenerator) {
+		for (int i = 0; i < count; ++i)
+			process(x[i], y, transformValues[i], baseValues[i], terrainGenerator);
+	}
+
 	inline bool isHeightTypeAffector() const {
 		return affectorType & HEIGHTTYPE;
 	}
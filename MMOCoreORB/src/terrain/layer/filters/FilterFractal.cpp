@@ -10,18 +10,19 @@
 #include "../../TerrainGenerator.h"
 
 
-float FilterFractal::process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator, FilterRectangle* rect) {
+MapFractal* FilterFractal::getFractal(TerrainGenerator* terrainGenerator) {
 	if (mfrc == nullptr) {
 		mfrc = terrainGenerator->getMfrc(fractalId);
 
 		if (mfrc == nullptr) {
 			System::out << "error out of bounds fractal id for filter " << informationHeader.getDescription() << endl;
-
-			return 1;
 		}
 	}
 
-	float noiseResult = mfrc->getNoise(x, y, 0, 0) * var6;
+	return mfrc;
+}
+
+float FilterFractal::calculateFilterValue(float noiseResult) const {
 	float result = 0;
 
 	if (noiseResult > min && noiseResult < max) {
@@ -40,6 +41,32 @@ float FilterFractal::process(float x, float y, float transformValue, float& base
 	return result;
 }
 
+float FilterFractal::process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator, FilterRectangle* rect) {
+	if (getFractal(terrainGenerator) == nullptr)
+		return 1;
+
+	float noiseResult = mfrc->getNoise(x, y, 0, 0) * var6;
+
+	return calculateFilterValue(noiseResult);
+}
+
+void FilterFractal::processRow(const float* x, float y, int count, const float* transformValues, float* baseValues, TerrainGenerator* terrainGenerator, FilterRectangle* rects, float* results) {
+	if (getFractal(terrainGenerator) == nullptr) {
+		for (int i = 0; i < count; ++i)
+			results[i] = 1;
+
+		return;
+	}
+
+	mfrc->getNoiseRow(x, y, count, results);
+
+	for (int i = 0; i < count; ++i) {
+		float noiseResult = results[i] * var6;
+
+		results[i] = calculateFilterValue(noiseResult);
+	}
+}
+
 void FilterFractal::parseFromIffStream(engine::util::IffStream* iffStream) {
 	uint32 version = iffStream->getNextFormType();
 
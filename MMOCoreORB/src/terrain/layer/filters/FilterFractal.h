@@ -31,6 +31,11 @@ public:
 	void parseFromIffStream(engine::util::IffStream* iffStream, Version<'0005'>);
 
 	float process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator, FilterRectangle* rect);
+	void processRow(const float* x, float y, int count, const float* transformValues, float* baseValues, TerrainGenerator* terrainGenerator, FilterRectangle* rects, float* results);
+
+private:
+	MapFractal* getFractal(TerrainGenerator* terrainGenerator);
+	float calculateFilterValue(float noiseResult) const;
 };
 
 #endif /* FILTERFRACTAL_H_ */
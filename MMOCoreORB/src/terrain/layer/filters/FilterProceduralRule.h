@@ -51,6 +51,14 @@ public:
 		return 0;
 	}
 
+	/**
+	 * process for count points of the row y, results[i] is the filter value of x[i].
+	 */
+	virtual void processRow(const float* x, float y, int count, const float* transformValues, float* baseValues, TerrainGenerator* terrainGenerator, FilterRectangle* rects, float* results) {
+		for (int i = 0; i < count; ++i)
+			results[i] = process(x[i], y, transformValues[i], baseValues[i], terrainGenerator, &rects[i]);
+	}
+
 	void readObject(engine::util::IffStream* iffStream) {
 		if (iffStream->openForm(formType) == nullptr)
 			throw Exception("Incorrect form type " + String::valueOf(formType));
@@ -0,0 +1,393 @@
+/*
+ * TerrainBakeFile.cpp
+ */
+
+#include "TerrainBakeFile.h"
+
+#include "conf/ConfigManager.h"
+#include "templates/manager/DataArchiveStore.h"
+#include "terrain/ProceduralTerrainAppearance.h"
+#include "terrain/layer/boundaries/Boundary.h"
+
+#ifndef PLATFORM_WIN
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+TerrainBakeFile::TerrainBakeFile() : Logger("TerrainBakeFile") {
+	fd = -1;
+	base = nullptr;
+	length = 0;
+	header = nullptr;
+	heights = nullptr;
+	quantizedHeights = nullptr;
+	environments = nullptr;
+	water = nullptr;
+}
+
+TerrainBakeFile::~TerrainBakeFile() {
+	close();
+}
+
+String TerrainBakeFile::getBakePath(const String& terrainFile) {
+	// terrain/tatooine.trn -> terrain/tatooine.bake, next to the binary
+	int extension = terrainFile.lastIndexOf('.');
+
+	if (extension == -1)
+		return terrainFile + ".bake";
+
+	return terrainFile.subString(0, extension) + ".bake";
+}
+
+bool TerrainBakeFile::isEnabled() {
+#ifdef PLATFORM_WIN
+	return false;
+#else
+	static const bool enabled = ConfigManager::instance()->getBool("Core3.TerrainBake.Enabled", true);
+
+	return enabled;
+#endif
+}
+
+uint64 TerrainBakeFile::getSourceHash(const String& terrainFile) {
+	TreeRecordData data;
+
+	if (!DataArchiveStore::instance()->getData(terrainFile, data) || data.isEmpty())
+		return 0;
+
+	uint64 hash = 14695981039346656037ULL;
+	const byte* bytes = data.getData();
+
+	for (int i = 0; i < data.getSize(); ++i) {
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+bool TerrainBakeFile::bake(const String& path, const ProceduralTerrainAppearance* terrain, uint64 sourceHash,
+		float spacing, float cellSize, bool quantize) {
+	if (terrain == nullptr || spacing <= 0 || cellSize < spacing)
+		return false;
+
+	float size = terrain->getSize();
+	float origin = size / -2.f;
+
+	int samplesPerSide = (int) ceil(size / spacing) + 1;
+	int cellsPerSide = (int) ceil(size / cellSize);
+
+	uint64 sampleCount = (uint64) samplesPerSide * samplesPerSide;
+	uint64 cellCount = (uint64) cellsPerSide * cellsPerSide;
+
+	Logger::console.info(true) << "baking " << path << ": " << samplesPerSide << "x" << samplesPerSide
+			<< " poles every " << spacing << "m, " << cellsPerSide << "x" << cellsPerSide << " cells";
+
+	float* bakedHeights = new float[sampleCount];
+
+	float minHeight = FLT_MAX;
+	float maxHeight = -FLT_MAX;
+
+	int lastProgress = 0;
+
+	for (int row = 0; row < samplesPerSide; ++row) {
+		float* rowHeights = bakedHeights + (uint64) row * samplesPerSide;
+
+		terrain->getHeights(origin, origin + row * spacing, spacing, samplesPerSide, rowHeights);
+
+		for (int i = 0; i < samplesPerSide; ++i) {
+			minHeight = Math::min(minHeight, rowHeights[i]);
+			maxHeight = Math::max(maxHeight, rowHeights[i]);
+		}
+
+		int progress = (row + 1) * 10 / samplesPerSide;
+
+		if (progress != lastProgress) {
+			lastProgress = progress;
+
+			Logger::console.info(true) << path << " heights " << progress * 10 << "%";
+		}
+	}
+
+	uint16* cellEnvironments = new uint16[cellCount];
+	byte* cellWater = new byte[cellCount];
+
+	const Vector<Boundary*>& waterBoundaries = terrain->getWaterBoundaries();
+
+	for (int cellY = 0; cellY < cellsPerSide; ++cellY) {
+		float minY = origin + cellY * cellSize;
+		float maxY = minY + cellSize;
+
+		for (int cellX = 0; cellX < cellsPerSide; ++cellX) {
+			float minX = origin + cellX * cellSize;
+			float maxX = minX + cellSize;
+
+			uint64 index = (uint64) cellY * cellsPerSide + cellX;
+
+			int environmentID = terrain->getEnvironmentID(minX + cellSize / 2, minY + cellSize / 2);
+
+			cellEnvironments[index] = (environmentID >= 0 && environmentID < UNKNOWN_ENVIRONMENT) ? (uint16) environmentID : UNKNOWN_ENVIRONMENT;
+			cellWater[index] = WATER_NO_BOUNDARY;
+
+			for (int i = 0; i < waterBoundaries.size(); ++i) {
+				const Boundary* boundary = waterBoundaries.get(i);
+
+				if (boundary->getMaxX() >= minX && boundary->getMinX() <= maxX
+						&& boundary->getMaxY() >= minY && boundary->getMinY() <= maxY) {
+					cellWater[index] = WATER_BOUNDARY;
+					break;
+				}
+			}
+		}
+	}
+
+	TerrainBakeHeader bakeHeader;
+	memset(&bakeHeader, 0, sizeof(bakeHeader));
+
+	bakeHeader.magic = TERRAINBAKE_MAGIC;
+	bakeHeader.version = TERRAINBAKE_VERSION;
+	bakeHeader.sourceHash = sourceHash;
+	bakeHeader.origin = origin;
+	bakeHeader.spacing = spacing;
+	bakeHeader.samplesPerSide = samplesPerSide;
+	bakeHeader.quantized = quantize;
+	bakeHeader.heightOffset = minHeight;
+	bakeHeader.heightScale = maxHeight > minHeight ? (maxHeight - minHeight) / 65535.f : 1.f;
+	bakeHeader.cellSize = cellSize;
+	bakeHeader.cellsPerSide = cellsPerSide;
+
+	auto align = [] (uint64 offset) -> uint64 {
+		return (offset + 15) & ~((uint64) 15);
+	};
+
+	uint64 heightsSize = sampleCount * (quantize ? sizeof(uint16) : sizeof(float));
+
+	bakeHeader.heightsOffset = align(sizeof(TerrainBakeHeader));
+	bakeHeader.environmentOffset = align(bakeHeader.heightsOffset + heightsSize);
+	bakeHeader.waterOffset = align(bakeHeader.environmentOffset + cellCount * sizeof(uint16));
+
+	String tempPath = path + ".tmp";
+
+	FILE* fp = fopen(tempPath.toCharArray(), "wb");
+
+	if (!fp) {
+		Logger::console.error() << "could not open file to save the terrain bake: " << tempPath;
+
+		delete [] bakedHeights;
+		delete [] cellEnvironments;
+		delete [] cellWater;
+
+		return false;
+	}
+
+	static const byte padding[16] = {0};
+
+	auto pad = [fp] (uint64 offset) -> bool {
+		long position = ftell(fp);
+
+		return position >= (long) offset || fwrite(padding, offset - position, 1, fp) == 1;
+	};
+
+	bool success = fwrite(&bakeHeader, sizeof(bakeHeader), 1, fp) == 1 && pad(bakeHeader.heightsOffset);
+
+	if (success && quantize) {
+		uint16* row = new uint16[samplesPerSide];
+
+		for (int y = 0; success && y < samplesPerSide; ++y) {
+			const float* rowHeights = bakedHeights + (uint64) y * samplesPerSide;
+
+			for (int x = 0; x < samplesPerSide; ++x)
+				row[x] = (uint16) Math::clamp(0.f, (rowHeights[x] - bakeHeader.heightOffset) / bakeHeader.heightScale + 0.5f, 65535.f);
+
+			success = fwrite(row, sizeof(uint16) * samplesPerSide, 1, fp) == 1;
+		}
+
+		delete [] row;
+	} else if (success) {
+		success = fwrite(bakedHeights, heightsSize, 1, fp) == 1;
+	}
+
+	if (success)
+		success = pad(bakeHeader.environmentOffset) && fwrite(cellEnvironments, cellCount * sizeof(uint16), 1, fp) == 1;
+
+	if (success)
+		success = pad(bakeHeader.waterOffset) && fwrite(cellWater, cellCount, 1, fp) == 1;
+
+	if (fclose(fp) != 0)
+		success = false;
+
+	delete [] bakedHeights;
+	delete [] cellEnvironments;
+	delete [] cellWater;
+
+	if (!success || rename(tempPath.toCharArray(), path.toCharArray()) != 0) {
+		Logger::console.error() << "could not write the terrain bake to " << path;
+		remove(tempPath.toCharArray());
+
+		return false;
+	}
+
+	return true;
+}
+
+bool TerrainBakeFile::open(const String& bakePath, uint64 sourceHash) {
+	close();
+
+#ifdef PLATFORM_WIN
+	return false;
+#else
+	path = bakePath;
+	setLoggingName("TerrainBakeFile " + path);
+
+	fd = ::open(path.toCharArray(), O_RDONLY);
+
+	if (fd == -1)
+		return false;
+
+	struct stat st;
+
+	if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(TerrainBakeHeader)) {
+		close();
+		return false;
+	}
+
+	length = st.st_size;
+
+	void* mapping = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+
+	if (mapping == MAP_FAILED) {
+		error() << "could not map " << path;
+
+		base = nullptr;
+		close();
+
+		return false;
+	}
+
+	base = static_cast<byte*>(mapping);
+
+	const TerrainBakeHeader* bakeHeader = reinterpret_cast<const TerrainBakeHeader*>(base);
+
+	if (bakeHeader->magic != TERRAINBAKE_MAGIC || bakeHeader->version != TERRAINBAKE_VERSION || bakeHeader->sourceHash != sourceHash) {
+		info(true) << "ignoring outdated terrain bake " << path;
+
+		close();
+		return false;
+	}
+
+	uint64 sampleCount = (uint64) bakeHeader->samplesPerSide * bakeHeader->samplesPerSide;
+	uint64 cellCount = (uint64) bakeHeader->cellsPerSide * bakeHeader->cellsPerSide;
+	uint64 heightsSize = sampleCount * (bakeHeader->quantized ? sizeof(uint16) : sizeof(float));
+
+	if (bakeHeader->samplesPerSide < 2 || bakeHeader->cellsPerSide < 1 || bakeHeader->spacing <= 0 || bakeHeader->cellSize <= 0
+			|| bakeHeader->heightsOffset + heightsSize > length
+			|| bakeHeader->environmentOffset + cellCount * sizeof(uint16) > length
+			|| bakeHeader->waterOffset + cellCount > length) {
+		error() << "truncated terrain bake " << path;
+
+		close();
+		return false;
+	}
+
+	header = bakeHeader;
+
+	if (header->quantized)
+		quantizedHeights = reinterpret_cast<const uint16*>(base + header->heightsOffset);
+	else
+		heights = reinterpret_cast<const float*>(base + header->heightsOffset);
+
+	environments = reinterpret_cast<const uint16*>(base + header->environmentOffset);
+	water = base + header->waterOffset;
+
+	// Lookups follow the players around, only the pages they touch get read
+	madvise(base, length, MADV_RANDOM);
+
+	return true;
+#endif
+}
+
+void TerrainBakeFile::close() {
+#ifndef PLATFORM_WIN
+	if (base != nullptr)
+		munmap(base, length);
+
+	if (fd != -1)
+		::close(fd);
+#endif
+
+	fd = -1;
+	base = nullptr;
+	length = 0;
+	header = nullptr;
+	heights = nullptr;
+	quantizedHeights = nullptr;
+	environments = nullptr;
+	water = nullptr;
+}
+
+bool TerrainBakeFile::getHeight(float x, float y, float& height) const {
+	if (header == nullptr)
+		return false;
+
+	float poleX = (x - header->origin) / header->spacing;
+	float poleY = (y - header->origin) / header->spacing;
+
+	if (poleX < 0 || poleY < 0)
+		return false;
+
+	int intX = (int) poleX;
+	int intY = (int) poleY;
+
+	if (intX >= header->samplesPerSide - 1 || intY >= header->samplesPerSide - 1)
+		return false;
+
+	float fractionX = poleX - intX;
+	float fractionY = poleY - intY;
+
+	int index0 = intY * header->samplesPerSide + intX;
+	int index1 = index0 + header->samplesPerSide;
+
+	float row00 = getPoleHeight(index0), row01 = getPoleHeight(index0 + 1);
+	float row10 = getPoleHeight(index1), row11 = getPoleHeight(index1 + 1);
+
+	float height0 = row00 + (row01 - row00) * fractionX;
+	float height1 = row10 + (row11 - row10) * fractionX;
+
+	height = height0 + (height1 - height0) * fractionY;
+
+	return true;
+}
+
+bool TerrainBakeFile::getCell(float x, float y, int& index) const {
+	if (header == nullptr)
+		return false;
+
+	float cellX = (x - header->origin) / header->cellSize;
+	float cellY = (y - header->origin) / header->cellSize;
+
+	if (cellX < 0 || cellY < 0 || cellX >= header->cellsPerSide || cellY >= header->cellsPerSide)
+		return false;
+
+	index = (int) cellY * header->cellsPerSide + (int) cellX;
+
+	return true;
+}
+
+bool TerrainBakeFile::getEnvironmentID(float x, float y, int& environmentID) const {
+	int index;
+
+	if (!getCell(x, y, index) || environments[index] == UNKNOWN_ENVIRONMENT)
+		return false;
+
+	environmentID = environments[index];
+
+	return true;
+}
+
+bool TerrainBakeFile::isOutsideWaterBoundaries(float x, float y) const {
+	int index;
+
+	return getCell(x, y, index) && water[index] == WATER_NO_BOUNDARY;
+}
@@ -0,0 +1,132 @@
+/*
+ * TerrainBakeFile.h
+ */
+
+#ifndef TERRAINBAKEFILE_H_
+#define TERRAINBAKEFILE_H_
+
+#include "engine/engine.h"
+
+class ProceduralTerrainAppearance;
+
+static const int TERRAINBAKE_MAGIC = 'T'<<24 | 'B'<<16 | 'A'<<8 | 'K'; //'TBAK';
+static const int TERRAINBAKE_VERSION = 3;
+
+struct TerrainBakeHeader {
+	int magic;
+	int version;
+	// Hash of the .trn the file was baked from
+	uint64 sourceHash;
+
+	// Height poles, samplesPerSide x samplesPerSide starting at (origin, origin)
+	float origin;
+	float spacing;
+	int samplesPerSide;
+	// Heights are stored as uint16 offset + value * scale when set, as floats otherwise
+	int quantized;
+	float heightOffset;
+	float heightScale;
+
+	// Environment and water cells, cellsPerSide x cellsPerSide of cellSize
+	float cellSize;
+	int cellsPerSide;
+
+	uint64 heightsOffset;
+	uint64 environmentOffset;
+	uint64 waterOffset;
+};
+
+/**
+ * Offline bake of the base terrain of a planet, loaded read only through a
+ * memory mapping. The file holds the heights of the poles of the terrain, the
+ * environment of each cell and whether a cell intersects any water boundary.
+ * Terrain modifications are not baked, callers have to skip the bake in the
+ * areas they cover.
+ */
+class TerrainBakeFile : public Object, public Logger {
+	String path;
+
+	int fd;
+	byte* base;
+	uint64 length;
+
+	const TerrainBakeHeader* header;
+
+	const float* heights;
+	const uint16* quantizedHeights;
+	const uint16* environments;
+	const byte* water;
+
+	inline float getPoleHeight(int index) const {
+		if (quantizedHeights != nullptr)
+			return header->heightOffset + quantizedHeights[index] * header->heightScale;
+
+		return heights[index];
+	}
+
+	bool getCell(float x, float y, int& index) const;
+
+public:
+	// Environment ids that don't fit the file are stored as this, callers fall back to the terrain
+	static const uint16 UNKNOWN_ENVIRONMENT = 0xFFFF;
+
+	enum WaterCell : byte { WATER_NO_BOUNDARY = 0, WATER_BOUNDARY = 1 };
+
+	TerrainBakeFile();
+	~TerrainBakeFile();
+
+	static String getBakePath(const String& terrainFile);
+
+	static bool isEnabled();
+
+	/**
+	 * Hashes the contents of the terrain file in the tres.
+	 * @return 0 if the file couldn't be read
+	 */
+	static uint64 getSourceHash(const String& terrainFile);
+
+	/**
+	 * Bakes the base terrain, without modifications, replacing the file at path atomically.
+	 * @param cellSize size of the environment and water cells, a multiple of spacing
+	 */
+	static bool bake(const String& path, const ProceduralTerrainAppearance* terrain, uint64 sourceHash,
+			float spacing, float cellSize, bool quantize);
+
+	/**
+	 * @return false if there is no file or it was baked from another terrain
+	 */
+	bool open(const String& path, uint64 sourceHash);
+
+	void close();
+
+	/**
+	 * Interpolates the four poles around the position, like the client does.
+	 * @return false outside of the baked area
+	 */
+	bool getHeight(float x, float y, float& height) const;
+
+	/**
+	 * @return false if the position is outside of the file or its environment isn't known
+	 */
+	bool getEnvironmentID(float x, float y, int& environmentID) const;
+
+	/**
+	 * @return true when the cell of the position doesn't overlap any water boundary, so
+	 * only the global water table applies
+	 */
+	bool isOutsideWaterBoundaries(float x, float y) const;
+
+	inline bool isOpen() const {
+		return header != nullptr;
+	}
+
+	inline float getSpacing() const {
+		return header != nullptr ? header->spacing : 0.f;
+	}
+
+	inline const String& getPath() const {
+		return path;
+	}
+};
+
+#endif /* TERRAINBAKEFILE_H_ */
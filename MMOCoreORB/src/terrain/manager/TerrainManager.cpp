@@ -10,17 +10,25 @@
 #include "terrain/ProceduralTerrainAppearance.h"
 #include "terrain/TerrainGenerator.h"
 #include "terrain/SpaceTerrainAppearance.h"
+#include "terrain/layer/boundaries/Boundary.h"
+#include "templates/manager/DataArchiveStore.h"
+#include "conf/ConfigManager.h"
 
 #define USE_CACHED_HEIGHT
 
 TerrainManager::TerrainManager() : Logger("TerrainManager") {
 	heightCache = nullptr;
+	bakedTerrain = nullptr;
+
+	modifiedCells = nullptr;
+	modifiedCellsPerSide = 0;
+	modifiedAreas.setNoDuplicateInsertPlan();
 
 	min = max = 0;
 }
 
 TerrainManager::~TerrainManager() {
-	delete heightCache;
+	delete [] modifiedCells;
 }
 
 bool TerrainManager::initialize(const String& terrainFile) {
@@ -39,18 +47,102 @@ bool TerrainManager::initialize(const String& terrainFile) {
 
 	delete iffStream;
 
-	if (heightCache != nullptr) {
-		delete heightCache;
-	}
-
-	heightCache = new TerrainCache(this);
-
 	min = getMin();
 	max = getMax();
 
+	ProceduralTerrainAppearance* ptat = getProceduralTerrainAppearance();
+
+	if (ptat != nullptr) {
+		// Poles are as far apart as the ones the client interpolates between
+		float spacing = ptat->getDistanceBetweenPoles();
+
+		if (spacing < 0.25f)
+			spacing = 1.f;
+
+		heightCache = new TerrainTileCache(ptat, min, max, spacing);
+
+		modifiedCellsPerSide = Math::max(1, (int) ceil((max - min) / MODIFIED_CELL_SIZE));
+		modifiedCells = new std::atomic<uint16>[modifiedCellsPerSide * modifiedCellsPerSide];
+
+		for (int i = 0; i < modifiedCellsPerSide * modifiedCellsPerSide; ++i)
+			modifiedCells[i].store(0, std::memory_order_relaxed);
+
+		if (TerrainBakeFile::isEnabled()) {
+			Reference<TerrainBakeFile*> bake = new TerrainBakeFile();
+
+			if (bake->open(TerrainBakeFile::getBakePath(terrainFile), TerrainBakeFile::getSourceHash(terrainFile))) {
+				bakedTerrain = bake;
+
+				info() << "using terrain bake " << bake->getPath();
+			}
+		}
+	} else {
+		heightCache = nullptr;
+	}
+
 	return val;
 }
 
+int TerrainManager::bakeTerrainFiles(bool quantize) {
+	auto configManager = ConfigManager::instance();
+
+	if (DataArchiveStore::instance()->loadTres(configManager->getTrePath(), configManager->getTreFiles()) != 0) {
+		Logger::console.error() << "could not load the tre files";
+		return 0;
+	}
+
+	File terrainDirectory("terrain");
+
+	if (!terrainDirectory.exists() && !terrainDirectory.mkdir()) {
+		Logger::console.error() << "could not create the terrain directory";
+		return 0;
+	}
+
+	float spacingOverride = configManager->getFloat("Core3.TerrainBake.Spacing", 0.f);
+	int cellPoles = Math::max(1, configManager->getInt("Core3.TerrainBake.CellPoles", 8));
+
+	const auto& zones = configManager->getEnabledZones();
+	int baked = 0;
+
+	for (int i = 0; i < zones.size(); ++i) {
+		String terrainFile = "terrain/" + zones.get(i) + ".trn";
+
+		IffStream* iffStream = DataArchiveStore::instance()->openIffFile(terrainFile);
+
+		if (iffStream == nullptr)
+			continue;
+
+		if (iffStream->getNextFormType() != 'PTAT') {
+			delete iffStream;
+			continue;
+		}
+
+		Reference<ProceduralTerrainAppearance*> terrain = new ProceduralTerrainAppearance();
+
+		bool loaded = terrain->load(iffStream);
+
+		delete iffStream;
+
+		if (!loaded) {
+			Logger::console.error() << "could not load " << terrainFile;
+			continue;
+		}
+
+		float spacing = spacingOverride > 0 ? spacingOverride : terrain->getDistanceBetweenPoles();
+
+		if (spacing < 0.25f)
+			spacing = 1.f;
+
+		if (TerrainBakeFile::bake(TerrainBakeFile::getBakePath(terrainFile), terrain, TerrainBakeFile::getSourceHash(terrainFile),
+				spacing, spacing * cellPoles, quantize))
+			++baked;
+	}
+
+	Logger::console.info(true) << baked << " terrains baked.";
+
+	return baked;
+}
+
 /**
  *	|----------------| x1,y1
  *	|----------------| <- stepping
@@ -123,16 +215,75 @@ void TerrainManager::addTerrainModification(float x, float y, const String& terr
 
 	clearCache(generator);
 
+	markModifiedArea(objectid, generator);
+
 	locker.release();
 
 	delete stream;
 }
 
+void TerrainManager::markModifiedArea(uint64 objectid, TerrainGenerator* generator) {
+	if (modifiedCells == nullptr)
+		return;
+
+	unmarkModifiedArea(objectid);
+
+	float centerX, centerY, radius;
+
+	if (!generator->getFullBoundaryCircle(centerX, centerY, radius))
+		return;
+
+	// Heights interpolate the poles around a position, so widen the area by a cell
+	ModifiedArea area;
+	area.firstX = Math::max(0, (int) floor((centerX - radius - min) / MODIFIED_CELL_SIZE) - 1);
+	area.firstY = Math::max(0, (int) floor((centerY - radius - min) / MODIFIED_CELL_SIZE) - 1);
+	area.lastX = Math::min(modifiedCellsPerSide - 1, (int) floor((centerX + radius - min) / MODIFIED_CELL_SIZE) + 1);
+	area.lastY = Math::min(modifiedCellsPerSide - 1, (int) floor((centerY + radius - min) / MODIFIED_CELL_SIZE) + 1);
+
+	Locker locker(&modifiedAreasMutex);
+
+	for (int y = area.firstY; y <= area.lastY; ++y) {
+		for (int x = area.firstX; x <= area.lastX; ++x)
+			modifiedCells[y * modifiedCellsPerSide + x].fetch_add(1, std::memory_order_release);
+	}
+
+	modifiedAreas.put(objectid, area);
+}
+
+void TerrainManager::unmarkModifiedArea(uint64 objectid) {
+	if (modifiedCells == nullptr)
+		return;
+
+	Locker locker(&modifiedAreasMutex);
+
+	int index = modifiedAreas.find(objectid);
+
+	if (index == -1)
+		return;
+
+	const ModifiedArea& area = modifiedAreas.elementAt(index).getValue();
+
+	for (int y = area.firstY; y <= area.lastY; ++y) {
+		for (int x = area.firstX; x <= area.lastX; ++x)
+			modifiedCells[y * modifiedCellsPerSide + x].fetch_sub(1, std::memory_order_release);
+	}
+
+	modifiedAreas.remove(index);
+}
+
 void TerrainManager::clearCache(TerrainGenerator* generator) {
 /*	totalHitCount.add(getCurrentCacheHitCount());
 	totalMissCount.add(getCurrentCacheMissCount());*/
 
-	heightCache->clear(generator);
+	if (heightCache == nullptr)
+		return;
+
+	float centerX, centerY, radius;
+
+	if (!generator->getFullBoundaryCircle(centerX, centerY, radius))
+		return;
+
+	heightCache->invalidate(centerX - radius, centerY - radius, centerX + radius, centerY + radius);
 }
 
 void TerrainManager::removeTerrainModification(uint64 objectid) {
@@ -146,6 +297,8 @@ void TerrainManager::removeTerrainModification(uint64 objectid) {
 	if (generator != nullptr) {
 		clearCache(generator);
 
+		unmarkModifiedArea(objectid);
+
 		delete generator;
 	}
 }
@@ -162,14 +315,6 @@ float TerrainManager::getUnCachedHeight(float x, float y) const {
 	return terrainData->getHeight(x, y);
 }
 
-float TerrainManager::getCachedHeight(float x, float y) {
-	if (heightCache == nullptr) {
-		return 0.f;
-	}
-
-	return heightCache->getHeight(x, y);
-}
-
 float TerrainManager::getHeight(float x, float y) {
 	if (x <= min || x >= max || y <= min || y >= max) {
 		warning() << "position  (" << x << ", " << y << ") out of planet/cache bounds: ["
@@ -181,11 +326,88 @@ float TerrainManager::getHeight(float x, float y) {
 	}
 
 #ifdef USE_CACHED_HEIGHT
-	x = floor(x * 10) / 10.f;
-	y = floor(y * 10) / 10.f;
+	float height;
 
-	return getCachedHeight(x, y);
-#else
-	return getUnCachedHeight(x, y);
+	// The bake and the tiles interpolate between poles, terrain modifications are evaluated exactly
+	if (heightCache != nullptr && !isModified(x, y)) {
+		if (bakedTerrain != nullptr && bakedTerrain->getHeight(x, y, height))
+			return height;
+
+		if (heightCache->getHeight(x, y, height))
+			return height;
+	}
 #endif
+
+	return getUnCachedHeight(x, y);
+}
+
+bool TerrainManager::getWaterHeight(float x, float y, float& waterHeight) const {
+	// Modifications can bring their own water boundaries, the bake only knows the base terrain
+	if (bakedTerrain != nullptr && !isModified(x, y) && bakedTerrain->isOutsideWaterBoundaries(x, y))
+		return getGlobalWaterHeight(waterHeight);
+
+	return terrainData->getWater(x, y, waterHeight);
+}
+
+bool TerrainManager::getGlobalWaterHeight(float& waterHeight) const {
+	const ProceduralTerrainAppearance* ptat = dynamic_cast<const ProceduralTerrainAppearance*>(terrainData.get());
+
+	if (ptat == nullptr || !ptat->getUseGlobalWaterTable())
+		return false;
+
+	waterHeight = ptat->getGlobalWaterTableHeight();
+
+	return true;
+}
+
+bool TerrainManager::hasWaterBoundaries(float minX, float minY, float maxX, float maxY) const {
+	const ProceduralTerrainAppearance* ptat = dynamic_cast<const ProceduralTerrainAppearance*>(terrainData.get());
+
+	if (ptat == nullptr)
+		return false;
+
+	const Vector<Boundary*>& waterBoundaries = ptat->getWaterBoundaries();
+
+	for (int i = 0; i < waterBoundaries.size(); ++i) {
+		const Boundary* boundary = waterBoundaries.get(i);
+
+		if (boundary->getMaxX() >= minX && boundary->getMinX() <= maxX
+				&& boundary->getMaxY() >= minY && boundary->getMinY() <= maxY)
+			return true;
+	}
+
+	return false;
+}
+
+bool TerrainManager::isModifiedArea(float minX, float minY, float maxX, float maxY) const {
+	if (modifiedCells == nullptr)
+		return false;
+
+	int firstX = Math::clamp(0, (int) ((minX - min) / MODIFIED_CELL_SIZE), modifiedCellsPerSide - 1);
+	int firstY = Math::clamp(0, (int) ((minY - min) / MODIFIED_CELL_SIZE), modifiedCellsPerSide - 1);
+	int lastX = Math::clamp(0, (int) ((maxX - min) / MODIFIED_CELL_SIZE), modifiedCellsPerSide - 1);
+	int lastY = Math::clamp(0, (int) ((maxY - min) / MODIFIED_CELL_SIZE), modifiedCellsPerSide - 1);
+
+	for (int y = firstY; y <= lastY; ++y) {
+		for (int x = firstX; x <= lastX; ++x) {
+			if (modifiedCells[y * modifiedCellsPerSide + x].load(std::memory_order_acquire) != 0)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+int TerrainManager::getEnvironmentID(float x, float y) const {
+	int environmentID;
+
+	if (bakedTerrain != nullptr && !isModified(x, y) && bakedTerrain->getEnvironmentID(x, y, environmentID))
+		return environmentID;
+
+	const ProceduralTerrainAppearance* ptat = dynamic_cast<const ProceduralTerrainAppearance*>(terrainData.get());
+
+	if (ptat == nullptr)
+		return -1;
+
+	return ptat->getEnvironmentID(x, y);
 }
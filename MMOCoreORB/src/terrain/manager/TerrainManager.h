@@ -8,21 +8,50 @@
 #ifndef TERRAINMANAGER_H_
 #define TERRAINMANAGER_H_
 
+#include <atomic>
+
 #include "terrain/TerrainAppearance.h"
 #ifdef COMPILE_CORE3_TESTS
 #include "gmock/gmock.h"
 #endif
-#include "TerrainCache.h"
+#include "TerrainTileCache.h"
+#include "TerrainBakeFile.h"
 
 class ProceduralTerrainAppearance;
+class TerrainGenerator;
 
 class TerrainManager : public Logger, public Object {
 	Reference<TerrainAppearance*> terrainData;
 
-	TerrainCache* heightCache;
+	Reference<TerrainTileCache*> heightCache;
+
+	Reference<TerrainBakeFile*> bakedTerrain;
+
+	struct ModifiedArea {
+		int firstX, firstY, lastX, lastY;
+	};
+
+	// Number of terrain modifications over each cell, the bake only holds in cells without any
+	std::atomic<uint16>* modifiedCells;
+	int modifiedCellsPerSide;
+
+	VectorMap<uint64, ModifiedArea> modifiedAreas;
+	Mutex modifiedAreasMutex;
 
 	float min, max;
 
+	static const int MODIFIED_CELL_SIZE = 64;
+
+	void markModifiedArea(uint64 objectid, TerrainGenerator* generator);
+	void unmarkModifiedArea(uint64 objectid);
+
+	inline bool isModified(float x, float y) const {
+		int cellX = Math::clamp(0, (int) ((x - min) / MODIFIED_CELL_SIZE), modifiedCellsPerSide - 1);
+		int cellY = Math::clamp(0, (int) ((y - min) / MODIFIED_CELL_SIZE), modifiedCellsPerSide - 1);
+
+		return modifiedCells[cellY * modifiedCellsPerSide + cellX].load(std::memory_order_acquire) != 0;
+	}
+
 protected:
 	void clearCache(TerrainGenerator* generator);
 
@@ -32,9 +61,33 @@ public:
 
 	bool initialize(const String& terrainFile);
 
-	inline bool getWaterHeight(float x, float y, float& waterHeight) const {
-		return terrainData->getWater(x, y, waterHeight);
-	}
+	/**
+	 * Bakes the base terrain of every enabled zone next to the binary, see TerrainBakeFile.
+	 * @param quantize store heights as 16 bit values instead of floats
+	 */
+	static int bakeTerrainFiles(bool quantize);
+
+	bool getWaterHeight(float x, float y, float& waterHeight) const;
+
+	/**
+	 * @return false if the terrain has no global water table
+	 */
+	bool getGlobalWaterHeight(float& waterHeight) const;
+
+	/**
+	 * @return true if any water boundary overlaps the area
+	 */
+	bool hasWaterBoundaries(float minX, float minY, float maxX, float maxY) const;
+
+	/**
+	 * @return true if a terrain modification may change the heights in the area
+	 */
+	bool isModifiedArea(float minX, float minY, float maxX, float maxY) const;
+
+	/**
+	 * @return the environment id of the position, -1 if the terrain isn't procedural
+	 */
+	int getEnvironmentID(float x, float y) const;
 
 	/**
 	 *  	|--------------- | x1,y1
@@ -52,7 +105,6 @@ public:
 
 	ProceduralTerrainAppearance* getProceduralTerrainAppearance();
 
-	float getCachedHeight(float x, float y);
 	float getUnCachedHeight(float x, float y) const;
 
 	virtual float getHeight(float x, float y);
@@ -78,27 +130,31 @@ public:
 	}
 
 	int getCacheHitCount() const {
-		return heightCache->getHitCount();
+		return heightCache != nullptr ? heightCache->getHitCount() : 0;
 	}
 
 	int getCacheMissCount() const {
-		return heightCache->getMissCount();
+		return heightCache != nullptr ? heightCache->getMissCount() : 0;
 	}
 
 	int getCacheClearCount() const {
-		return heightCache->getClearCount();
+		return heightCache != nullptr ? heightCache->getClearCount() : 0;
 	}
 
-	int getCacheClearHeightsCount() const {
-		return heightCache->getClearHeightsCount();
+	int getCacheClearTilesCount() const {
+		return heightCache != nullptr ? heightCache->getClearTilesCount() : 0;
 	}
 
-	int getCachedValuesCount() const {
-		return heightCache->getSize();
+	int getCachedTilesCount() const {
+		return heightCache != nullptr ? heightCache->getTilesCount() : 0;
 	}
 
 	int getCacheEvictCount() const {
-		return heightCache->getEvictCount();
+		return heightCache != nullptr ? heightCache->getEvictCount() : 0;
+	}
+
+	bool hasBakedTerrain() const {
+		return bakedTerrain != nullptr;
 	}
 };
 
@@ -0,0 +1,222 @@
+/*
+ * TerrainTileCache.cpp
+ */
+
+#include "TerrainTileCache.h"
+
+#include "terrain/TerrainAppearance.h"
+#include "conf/ConfigManager.h"
+
+#include <algorithm>
+
+namespace {
+	const String TileQueue = "TerrainTiles";
+}
+
+TerrainTileCache::TerrainTileCache(TerrainAppearance* terrain, float min, float max, float spacing)
+	: Logger("TerrainTileCache"), terrain(terrain), min(min), spacing(spacing), loadedTiles(0) {
+
+	tileSize = spacing * TerrainTile::TILE_INTERVALS;
+	tilesPerSide = Math::max(1, (int) ceil((max - min) / tileSize));
+
+	// About 17KB per tile, so the default budget is under 9MB per planet
+	maxTiles = Math::max(16, ConfigManager::instance()->getInt("Core3.TerrainTileCache.MaxTiles", 512));
+
+	tileThreads = ConfigManager::instance()->getInt("Core3.TerrainTileCache.Threads", 2);
+
+	int totalTiles = tilesPerSide * tilesPerSide;
+
+	tiles = new Reference<TerrainTile*>[totalTiles];
+	states = new byte[totalTiles];
+	tileEpochs = new uint32[totalTiles];
+
+	memset(states, TILE_NONE, totalTiles);
+	memset(tileEpochs, 0, totalTiles * sizeof(uint32));
+
+	if (tileThreads > 0) {
+		const auto static initialized = Core::getTaskManager()->initializeCustomQueue(TileQueue.toCharArray(), tileThreads, false);
+	}
+}
+
+TerrainTileCache::~TerrainTileCache() {
+	delete [] tiles;
+	delete [] states;
+	delete [] tileEpochs;
+}
+
+bool TerrainTileCache::getHeight(float x, float y, float& height) {
+	float poleX = (x - min) / spacing;
+	float poleY = (y - min) / spacing;
+
+	if (poleX < 0 || poleY < 0)
+		return false;
+
+	int intX = (int) poleX;
+	int intY = (int) poleY;
+
+	int tileX = intX / TerrainTile::TILE_INTERVALS;
+	int tileY = intY / TerrainTile::TILE_INTERVALS;
+
+	if (tileX >= tilesPerSide || tileY >= tilesPerSide)
+		return false;
+
+	int index = tileY * tilesPerSide + tileX;
+
+	ReadLocker locker(&lock);
+
+	const TerrainTile* tile = tiles[index];
+
+	if (tile == nullptr) {
+		locker.release();
+
+		missCount.increment();
+
+		requestTile(tileX, tileY);
+
+		return false;
+	}
+
+	const_cast<TerrainTile*>(tile)->lastUse.store(useClock.get(), std::memory_order_relaxed);
+
+	int localX = intX - tileX * TerrainTile::TILE_INTERVALS;
+	int localY = intY - tileY * TerrainTile::TILE_INTERVALS;
+
+	float fractionX = poleX - intX;
+	float fractionY = poleY - intY;
+
+	const float* row0 = tile->heights + localY * TerrainTile::TILE_SAMPLES + localX;
+	const float* row1 = row0 + TerrainTile::TILE_SAMPLES;
+
+	float height0 = row0[0] + (row0[1] - row0[0]) * fractionX;
+	float height1 = row1[0] + (row1[1] - row1[0]) * fractionX;
+
+	height = height0 + (height1 - height0) * fractionY;
+
+	locker.release();
+
+	hitCount.increment();
+
+	return true;
+}
+
+void TerrainTileCache::requestTile(int tileX, int tileY) {
+	int index = tileY * tilesPerSide + tileX;
+	uint32 startEpoch;
+
+	{
+		Locker locker(&lock);
+
+		if (states[index] != TILE_NONE)
+			return;
+
+		states[index] = TILE_PENDING;
+		startEpoch = tileEpochs[index];
+	}
+
+	if (tileThreads <= 0) {
+		generateTile(tileX, tileY, startEpoch);
+
+		return;
+	}
+
+	Reference<TerrainTileCache*> strongCache = this;
+
+	Core::getTaskManager()->executeTask([strongCache, tileX, tileY, startEpoch] () {
+		strongCache->generateTile(tileX, tileY, startEpoch);
+	}, "TerrainTileTask", TileQueue.toCharArray());
+}
+
+void TerrainTileCache::generateTile(int tileX, int tileY, uint32 startEpoch) {
+	int index = tileY * tilesPerSide + tileX;
+
+	Reference<TerrainTile*> tile = new TerrainTile();
+
+	float originX = min + tileX * tileSize;
+	float originY = min + tileY * tileSize;
+
+	for (int row = 0; row < TerrainTile::TILE_SAMPLES; ++row) {
+		terrain->getHeights(originX, originY + row * spacing, spacing, TerrainTile::TILE_SAMPLES, tile->heights + row * TerrainTile::TILE_SAMPLES);
+	}
+
+	tile->lastUse = useClock.increment();
+
+	Locker locker(&lock);
+
+	if (states[index] != TILE_PENDING)
+		return;
+
+	if (tileEpochs[index] != startEpoch) {
+		// The terrain under the tile changed while we computed it
+		states[index] = TILE_NONE;
+
+		return;
+	}
+
+	tiles[index] = tile;
+	states[index] = TILE_LOADED;
+
+	if (++loadedTiles > maxTiles)
+		evictTiles();
+}
+
+void TerrainTileCache::evictTiles() {
+	int totalTiles = tilesPerSide * tilesPerSide;
+
+	uint64* uses = new uint64[loadedTiles];
+	int count = 0;
+
+	for (int i = 0; i < totalTiles && count < loadedTiles; ++i) {
+		const TerrainTile* tile = tiles[i];
+
+		if (tile != nullptr)
+			uses[count++] = ((uint64) tile->lastUse.load(std::memory_order_relaxed) << 32) | (uint32) i;
+	}
+
+	std::sort(uses, uses + count);
+
+	// Evicts down to three quarters of the budget so the scan isn't done on every new tile
+	int toEvict = loadedTiles - maxTiles / 4 * 3;
+
+	for (int i = 0; i < toEvict && i < count; ++i) {
+		int index = (int) (uses[i] & 0xFFFFFFFF);
+
+		tiles[index] = nullptr;
+		states[index] = TILE_NONE;
+
+		--loadedTiles;
+		evictCount.increment();
+	}
+
+	delete [] uses;
+}
+
+void TerrainTileCache::invalidate(float minX, float minY, float maxX, float maxY) {
+	// Interpolation reads the poles around a position, so widen by one pole
+	int firstX = Math::max(0, (int) floor((minX - spacing - min) / tileSize));
+	int firstY = Math::max(0, (int) floor((minY - spacing - min) / tileSize));
+	int lastX = Math::min(tilesPerSide - 1, (int) floor((maxX + spacing - min) / tileSize));
+	int lastY = Math::min(tilesPerSide - 1, (int) floor((maxY + spacing - min) / tileSize));
+
+	Locker locker(&lock);
+
+	clearCount.increment();
+
+	for (int tileY = firstY; tileY <= lastY; ++tileY) {
+		for (int tileX = firstX; tileX <= lastX; ++tileX) {
+			int index = tileY * tilesPerSide + tileX;
+
+			++tileEpochs[index];
+
+			if (states[index] == TILE_LOADED) {
+				tiles[index] = nullptr;
+
+				--loadedTiles;
+				clearTilesCount.increment();
+			}
+
+			// Pending tiles are dropped when they finish, their epoch changed
+			if (states[index] != TILE_PENDING)
+				states[index] = TILE_NONE;
+		}
+	}
+}
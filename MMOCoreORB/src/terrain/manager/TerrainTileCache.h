@@ -0,0 +1,124 @@
+/*
+ * TerrainTileCache.h
+ */
+
+#ifndef TERRAINTILECACHE_H_
+#define TERRAINTILECACHE_H_
+
+#include <atomic>
+
+#include "engine/engine.h"
+
+class TerrainAppearance;
+
+/**
+ * Heights of a square of TILE_INTERVALS x TILE_INTERVALS poles. The last row and
+ * column repeat the first ones of the next tile, so a sample never reads across tiles.
+ */
+class TerrainTile : public Object {
+public:
+	static const int TILE_INTERVALS = 64;
+	static const int TILE_SAMPLES = TILE_INTERVALS + 1;
+
+	float heights[TILE_SAMPLES * TILE_SAMPLES];
+
+	std::atomic<uint32> lastUse;
+
+	TerrainTile() : lastUse(0) {
+	}
+};
+
+/**
+ * Heightfield of a terrain split into fixed resolution tiles. A tile is computed
+ * a row at a time on the TerrainTiles queue the first time a height of it is
+ * requested, until then the caller computes its height itself. Reads interpolate
+ * the four surrounding poles, like the client does, so TerrainManager only reads
+ * it outside of terrain modifications. Terrain modifications drop the tiles
+ * overlapping their bounds.
+ */
+class TerrainTileCache : public Object, public Logger {
+	Reference<TerrainAppearance*> terrain;
+
+	float min;
+	float spacing;
+	float tileSize;
+
+	int tilesPerSide;
+	int maxTiles;
+
+	// Threads of the TerrainTiles queue, 0 computes missing tiles inline
+	int tileThreads;
+
+	Reference<TerrainTile*>* tiles;
+	byte* states;
+
+	// Bumped when a tile is invalidated, a tile computed across a bump is thrown away
+	uint32* tileEpochs;
+
+	ReadWriteLock lock;
+
+	AtomicInteger useClock;
+
+	int loadedTiles;
+
+	AtomicInteger hitCount;
+	AtomicInteger missCount;
+	AtomicInteger clearCount;
+	AtomicInteger clearTilesCount;
+	AtomicInteger evictCount;
+
+	enum TileState : byte { TILE_NONE = 0, TILE_PENDING, TILE_LOADED };
+
+	void requestTile(int tileX, int tileY);
+
+	void generateTile(int tileX, int tileY, uint32 startEpoch);
+
+	void evictTiles();
+
+public:
+	/**
+	 * @param spacing distance between two poles
+	 */
+	TerrainTileCache(TerrainAppearance* terrain, float min, float max, float spacing);
+	~TerrainTileCache();
+
+	/**
+	 * @return false if the tile of the position is not computed yet
+	 */
+	bool getHeight(float x, float y, float& height);
+
+	/**
+	 * Drops the tiles overlapping the area, called when the terrain under it changes.
+	 */
+	void invalidate(float minX, float minY, float maxX, float maxY);
+
+	inline float getSpacing() const {
+		return spacing;
+	}
+
+	int getHitCount() const {
+		return hitCount.get();
+	}
+
+	int getMissCount() const {
+		return missCount.get();
+	}
+
+	int getClearCount() const {
+		return clearCount.get();
+	}
+
+	int getClearTilesCount() const {
+		return clearTilesCount.get();
+	}
+
+	int getEvictCount() const {
+		return evictCount.get();
+	}
+
+	int getTilesCount() const {
+		return loadedTiles;
+	}
+};
+
+#endif /* TERRAINTILECACHE_H_ */
@@ -0,0 +1,212 @@
+/*
+ * AsyncLogWriterTest.cpp
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <dirent.h>
+#include <unistd.h>
+#include <fstream>
+#include <string>
+
+#include "server/zone/managers/logging/AsyncLogWriter.h"
+
+class AsyncLogProducerThread : public Thread {
+	AsyncLogWriter* writer;
+	int producer;
+	int count;
+
+public:
+	AsyncLogProducerThread(AsyncLogWriter* logWriter, int producerIndex, int lineCount) {
+		writer = logWriter;
+		producer = producerIndex;
+		count = lineCount;
+	}
+
+	void run() {
+		for (int i = 0; i < count; ++i) {
+			writer->write(String::valueOf(producer) + ":" + String::valueOf(i));
+		}
+	}
+};
+
+class AsyncLogWriterTest : public ::testing::Test {
+protected:
+	String directory;
+
+	Vector<String> readLines(const String& fileName) {
+		Vector<String> lines;
+
+		std::ifstream file(fileName.toCharArray());
+		std::string line;
+
+		while (std::getline(file, line)) {
+			lines.add(String(line.c_str()));
+		}
+
+		return lines;
+	}
+
+	int countFiles() {
+		int count = 0;
+
+		DIR* dir = opendir(directory.toCharArray());
+
+		if (dir == nullptr)
+			return 0;
+
+		while (struct dirent* entry = readdir(dir)) {
+			if (entry->d_name[0] != '.')
+				++count;
+		}
+
+		closedir(dir);
+
+		return count;
+	}
+
+public:
+	void SetUp() {
+		char path[] = "/tmp/asynclogwritertestXXXXXX";
+
+		ASSERT_NE(mkdtemp(path), nullptr);
+
+		directory = path;
+	}
+
+	void TearDown() {
+		DIR* dir = opendir(directory.toCharArray());
+
+		if (dir != nullptr) {
+			while (struct dirent* entry = readdir(dir)) {
+				if (entry->d_name[0] != '.')
+					unlink((directory + "/" + entry->d_name).toCharArray());
+			}
+
+			closedir(dir);
+		}
+
+		rmdir(directory.toCharArray());
+	}
+};
+
+TEST_F(AsyncLogWriterTest, ProducersStallOnFullQueueAndKeepOrder) {
+	const int producers = 4;
+	const int linesPerProducer = 5000;
+
+	String fileName = directory + "/producers.log";
+
+	// Nothing drains but the producers finding the tiny queue full
+	Reference<AsyncLogWriter*> writer = new AsyncLogWriter(fileName, 4, 4096);
+
+	Vector<AsyncLogProducerThread*> threads;
+
+	for (int i = 0; i < producers; ++i) {
+		threads.add(new AsyncLogProducerThread(writer, i, linesPerProducer));
+	}
+
+	for (int i = 0; i < producers; ++i) {
+		threads.get(i)->start();
+	}
+
+	for (int i = 0; i < producers; ++i) {
+		threads.get(i)->join();
+		delete threads.get(i);
+	}
+
+	writer->close();
+
+	auto stats = writer->getStats();
+
+	EXPECT_GT(stats.stalls, (uint64) 0);
+	EXPECT_EQ(stats.lines, (uint64) producers * linesPerProducer);
+	EXPECT_EQ(stats.depth, (uint64) 0);
+
+	Vector<String> lines = readLines(fileName);
+
+	ASSERT_EQ(lines.size(), producers * linesPerProducer);
+
+	int next[producers] = {0};
+
+	for (int i = 0; i < lines.size(); ++i) {
+		const String& line = lines.get(i);
+		int separator = line.indexOf(":");
+
+		ASSERT_NE(separator, -1) << line.toCharArray();
+
+		int producer = Integer::valueOf(line.subString(0, separator));
+		int index = Integer::valueOf(line.subString(separator + 1));
+
+		ASSERT_TRUE(producer >= 0 && producer < producers) << line.toCharArray();
+
+		// Lines of one producer are written in the order it queued them
+		ASSERT_EQ(index, next[producer]) << line.toCharArray();
+
+		++next[producer];
+	}
+}
+
+TEST_F(AsyncLogWriterTest, RotatesBySize) {
+	String fileName = directory + "/size.log";
+
+	Reference<AsyncLogWriter*> writer = new AsyncLogWriter(fileName, 8192, 64 * 1024);
+	writer->setRotateSizeMB(1);
+
+	// 1001 bytes per line, the file is rotated after the 1048th line
+	String line;
+
+	for (int i = 0; i < 1000; ++i) {
+		line += "x";
+	}
+
+	const int count = 3000;
+
+	for (int i = 0; i < count; ++i) {
+		writer->write(line);
+
+		if (i % 1000 == 999)
+			writer->flush(System::getMiliTime(), 1000000);
+	}
+
+	writer->close();
+
+	auto stats = writer->getStats();
+
+	EXPECT_EQ(stats.lines, (uint64) count);
+	EXPECT_EQ(stats.bytes, (uint64) count * 1001);
+	EXPECT_EQ(stats.rotations, (uint64) 2);
+
+	EXPECT_EQ(readLines(fileName).size(), count - 2 * 1048);
+	EXPECT_GE(countFiles(), 2);
+}
+
+TEST_F(AsyncLogWriterTest, CloseDrainsTheQueue) {
+	String fileName = directory + "/close.log";
+
+	Reference<AsyncLogWriter*> writer = new AsyncLogWriter(fileName, 1024, 4096);
+
+	for (int i = 0; i < 100; ++i) {
+		writer->write("queued " + String::valueOf(i));
+	}
+
+	// Nothing was flushed yet
+	EXPECT_EQ(writer->getStats().depth, (uint64) 100);
+	EXPECT_EQ(readLines(fileName).size(), 0);
+
+	writer->close();
+
+	Vector<String> lines = readLines(fileName);
+
+	ASSERT_EQ(lines.size(), 100);
+	EXPECT_EQ(lines.get(0), "queued 0");
+	EXPECT_EQ(lines.get(99), "queued 99");
+
+	// Written from the calling thread once closed
+	writer->write("after close");
+
+	lines = readLines(fileName);
+
+	ASSERT_EQ(lines.size(), 101);
+	EXPECT_EQ(lines.get(100), "after close");
+}
@@ -0,0 +1,87 @@
+/*
+ * ConfigHandleTest.cpp
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "conf/ConfigManager.h"
+
+class ConfigHandleTest : public ::testing::Test {
+protected:
+	ConfigManager* configManager = nullptr;
+public:
+	ConfigHandleTest() {
+		configManager = ConfigManager::instance();
+		configManager->loadConfigData();
+	}
+
+	~ConfigHandleTest() {
+		configManager = nullptr;
+	}
+};
+
+TEST_F(ConfigHandleTest, HandleFollowsChanges) {
+	ConfigHandle<int> handle("Core3.TestHandleInt", 11);
+
+	ASSERT_EQ(handle.get(), 11);
+
+	configManager->setInt("Core3.TestHandleInt", 22);
+	ASSERT_EQ(handle.get(), 22);
+
+	configManager->setInt("Core3.TestHandleInt", 33);
+	ASSERT_EQ(handle.get(), 33);
+
+	// Not in config.lua, a reload brings back the default
+	configManager->loadConfigData();
+	ASSERT_EQ(handle.get(), 11);
+
+	ConfigHandle<int> dbPort("Core3.DBPort", 0);
+	auto loadedPort = configManager->getInt("Core3.DBPort", 0);
+
+	ASSERT_EQ(dbPort.get(), loadedPort);
+
+	configManager->setInt("Core3.DBPort", loadedPort + 1);
+	ASSERT_EQ(dbPort.get(), loadedPort + 1);
+
+	configManager->loadConfigData();
+	ASSERT_EQ(dbPort.get(), loadedPort);
+}
+
+TEST_F(ConfigHandleTest, HandleRegisteredAfterSnapshot) {
+	ConfigHandle<bool> first("Core3.TestHandleFirst", true);
+
+	// Builds a snapshot without the second handle
+	ASSERT_TRUE(first.get());
+
+	configManager->setString("Core3.TestHandleSecond", "second");
+
+	ConfigHandle<String> second("Core3.TestHandleSecond", "default");
+
+	ASSERT_EQ(second.get(), "second");
+	ASSERT_TRUE(first.get());
+}
+
+TEST_F(ConfigHandleTest, RetiredSnapshotFreedOnceUnread) {
+	std::atomic<ConfigSnapshot*> published(new ConfigSnapshot(1, 1));
+	RetireList<ConfigSnapshot> retired;
+
+	{
+		HazardGuard<ConfigSnapshot> reader(published);
+
+		retired.retire(published.exchange(new ConfigSnapshot(2, 1)));
+
+		// Still read by the guard
+		ASSERT_EQ(retired.size(), 1);
+		ASSERT_EQ(reader->getVersion(), 1);
+
+		reader.reload();
+		ASSERT_EQ(reader->getVersion(), 2);
+
+		retired.reclaim();
+		ASSERT_EQ(retired.size(), 0);
+	}
+
+	retired.retire(published.exchange(nullptr));
+	ASSERT_EQ(retired.size(), 0);
+}
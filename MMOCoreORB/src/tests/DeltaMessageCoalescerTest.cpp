@@ -0,0 +1,67 @@
+/*
+ * DeltaMessageCoalescerTest.cpp
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "server/zone/DeltaMessageCoalescer.h"
+
+TEST(DeltaMessageCoalescerTest, OpcodeIsReadPastThePrefix) {
+	DeltaMessage delta(0x1234, 0x4352454F, 3);
+	delta.addIntUpdate(3, 5);
+	delta.close();
+
+	EXPECT_EQ(delta.parseInt(DeltaMessage::OPCODE_OFFSET), (uint32) 0x12862153);
+	EXPECT_TRUE(DeltaMessage::hasDeltaOpcode(&delta));
+
+	BaseMessage other;
+	other.insertShort(0x05);
+	other.insertInt(0x12345678);
+
+	for (int i = 0; i < 8; ++i)
+		other.insertInt(0);
+
+	EXPECT_FALSE(DeltaMessage::hasDeltaOpcode(&other));
+}
+
+TEST(DeltaMessageCoalescerTest, SameObjectAndPackageMergeIntoOne) {
+	DeltaMessage first(0x1234, 0x4352454F, 3);
+	first.addIntUpdate(3, 5);
+	first.addShortUpdate(1, 9);
+	first.close();
+
+	DeltaMessage second(0x1234, 0x4352454F, 3);
+	second.addIntUpdate(3, 7);
+	second.close();
+
+	ASSERT_TRUE(first.isMergeable());
+	ASSERT_TRUE(second.isMergeable());
+
+	Vector<DeltaMessage*> deltas;
+	deltas.add(&first);
+	deltas.add(&second);
+
+	DeltaMessage* merged = DeltaMessageCoalescer::mergeDeltas(deltas);
+
+	// The first int update is superseded by the second one
+	EXPECT_EQ(merged->getObjectID(), (uint64) 0x1234);
+	EXPECT_EQ(merged->getObjectName(), (uint32) 0x4352454F);
+	EXPECT_EQ(merged->getPackageType(), (uint8) 3);
+	EXPECT_EQ(merged->getUpdateCount(), 2);
+	EXPECT_EQ(merged->getUpdateType(0), 1);
+	EXPECT_EQ(merged->getUpdateType(1), 3);
+
+	int offset = DeltaMessage::HEADER_SIZE;
+
+	EXPECT_EQ(merged->parseShort(DeltaMessage::UPDATE_COUNT_OFFSET), 2);
+	EXPECT_EQ((int) merged->parseInt(DeltaMessage::UPDATE_SIZE_OFFSET), merged->size() - DeltaMessage::UPDATE_COUNT_OFFSET);
+
+	EXPECT_EQ(merged->parseShort(offset), 1);
+	EXPECT_EQ(merged->parseShort(offset + 2), 9);
+	EXPECT_EQ(merged->parseShort(offset + 4), 3);
+	EXPECT_EQ(merged->parseInt(offset + 6), (uint32) 7);
+	EXPECT_EQ(merged->size(), offset + 10);
+
+	delete merged;
+}
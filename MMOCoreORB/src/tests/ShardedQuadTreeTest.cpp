@@ -0,0 +1,213 @@
+/*
+ * ShardedQuadTreeTest.cpp
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "server/db/ServerDatabase.h"
+#include "server/zone/GroundZone.h"
+#include "server/zone/ShardedQuadTree.h"
+#include "server/zone/ZoneProcessServer.h"
+#include "server/zone/objects/scene/SceneObject.h"
+#include "conf/ConfigManager.h"
+
+class ShardMigrateThread : public Thread {
+	ShardedQuadTree* tree;
+	TreeEntry* entry;
+
+public:
+	ShardMigrateThread(ShardedQuadTree* quadTree, TreeEntry* treeEntry) {
+		tree = quadTree;
+		entry = treeEntry;
+	}
+
+	void run() {
+		tree->update(entry);
+	}
+};
+
+class ShardedQuadTreeTest : public ::testing::Test {
+protected:
+#ifndef WITH_SWGREALMS_API
+	ServerDatabase* database = nullptr;
+#endif // !WITH_SWGREALMS_API
+	Reference<ZoneServer*> zoneServer;
+	Reference<GroundZone*> groundZone;
+	Reference<ZoneProcessServer*> processServer;
+	AtomicLong nextObjectId;
+
+public:
+	ShardedQuadTreeTest() {
+		nextObjectId = 1;
+	}
+
+	Reference<SceneObject*> createSceneObject() {
+		Reference<SceneObject*> object = new SceneObject();
+		object->setContainerComponent("ContainerComponent");
+		object->setGroundZoneComponent("GroundZoneComponent");
+		object->_setObjectID(nextObjectId.increment());
+		object->initializeContainerObjectsMap();
+
+		return object;
+	}
+
+	void SetUp() {
+		ConfigManager::instance()->loadConfigData();
+		ConfigManager::instance()->setProgressMonitors(false);
+		auto configManager = ConfigManager::instance();
+
+#ifndef WITH_SWGREALMS_API
+		database = new ServerDatabase(configManager);
+#endif // !WITH_SWGREALMS_API
+		zoneServer = new ZoneServer(configManager);
+		processServer = new ZoneProcessServer(zoneServer);
+		groundZone = new GroundZone(processServer, "test_zone");
+		groundZone->createContainerComponent();
+		groundZone->_setObjectID(1);
+	}
+
+	void TearDown() {
+#ifndef WITH_SWGREALMS_API
+		delete database;
+		database = nullptr;
+#endif // !WITH_SWGREALMS_API
+
+		groundZone = nullptr;
+		processServer = nullptr;
+		zoneServer = nullptr;
+	}
+};
+
+TEST_F(ShardedQuadTreeTest, ShardBorderInRange) {
+	Reference<SceneObject*> scene = createSceneObject();
+
+	Locker slocker(scene);
+
+	// Shards are 2048m wide by default, start right next to a shard border
+	scene->initializePosition(2040, 0, 0);
+
+	groundZone->transferObject(scene, -1);
+
+	SortedVector<ManagedReference<TreeEntry*> > objects;
+
+	groundZone->getInRangeObjects(2060, 0, 0, 64, &objects, true);
+
+	ASSERT_EQ(objects.size(), 1);
+
+	// Migrate the object to the neighbour shard
+	scene->teleport(2100, 0, 0);
+
+	objects.removeAll();
+
+	groundZone->getInRangeObjects(2000, 0, 0, 64, &objects, true);
+
+	ASSERT_EQ(objects.size(), 0);
+
+	objects.removeAll();
+
+	groundZone->getInRangeObjects(2040, 0, 0, 64, &objects, true);
+
+	ASSERT_EQ(objects.size(), 1);
+
+	scene->destroyObjectFromWorld(false);
+
+	objects.removeAll();
+
+	groundZone->getInRangeObjects(2040, 0, 0, 64, &objects, true);
+
+	ASSERT_EQ(objects.size(), 0);
+}
+
+TEST_F(ShardedQuadTreeTest, InsertUpdateRemove) {
+	Reference<ShardedQuadTree*> tree = new ShardedQuadTree(-8192, -8192, 8192, 8192);
+
+	ASSERT_EQ(tree->getShardCount(), 64);
+
+	Reference<SceneObject*> scene = createSceneObject();
+
+	// x = 0 is a shard border
+	scene->initializePosition(-100, 0, -100);
+
+	tree->insert(scene);
+
+	ASSERT_TRUE(scene->getNode() != nullptr);
+
+	SortedVector<TreeEntry*> objects;
+
+	ASSERT_EQ(tree->inRange(-100, -100, 16, objects), 1);
+
+	// Update inside the shard
+	scene->setPosition(-50, 0, -100);
+
+	ASSERT_TRUE(tree->update(scene));
+
+	objects.removeAll();
+
+	ASSERT_EQ(tree->inRange(-50, -100, 16, objects), 1);
+
+	// Update across the shard border
+	scene->setPosition(100, 0, -100);
+
+	ASSERT_TRUE(tree->update(scene));
+
+	objects.removeAll();
+
+	ASSERT_EQ(tree->inRange(-50, -100, 16, objects), 0);
+
+	objects.removeAll();
+
+	ASSERT_EQ(tree->inRange(100, -100, 16, objects), 1);
+
+	// Inserting an entry already in the tree moves it
+	scene->setPosition(3000, 0, 3000);
+
+	tree->insert(scene);
+
+	objects.removeAll();
+
+	ASSERT_EQ(tree->inRange(100, -100, 16, objects), 0);
+
+	objects.removeAll();
+
+	ASSERT_EQ(tree->inRange(3000, 3000, 16, objects), 1);
+
+	tree->remove(scene);
+
+	ASSERT_TRUE(scene->getNode() == nullptr);
+	ASSERT_FALSE(tree->update(scene));
+
+	objects.removeAll();
+
+	ASSERT_EQ(tree->inRange(3000, 3000, 16, objects), 0);
+}
+
+TEST_F(ShardedQuadTreeTest, RemoveDuringMigration) {
+	Reference<ShardedQuadTree*> tree = new ShardedQuadTree(-8192, -8192, 8192, 8192);
+
+	Reference<SceneObject*> scene = createSceneObject();
+
+	SortedVector<TreeEntry*> objects;
+
+	for (int i = 0; i < 500; ++i) {
+		scene->initializePosition(-10, 0, 0);
+
+		tree->insert(scene);
+
+		scene->setPosition(10, 0, 0);
+
+		ShardMigrateThread thread(tree, scene);
+		thread.start();
+
+		tree->remove(scene);
+
+		thread.join();
+
+		// A migration never puts back an entry removed meanwhile
+		ASSERT_TRUE(scene->getNode() == nullptr);
+
+		objects.removeAll();
+
+		ASSERT_EQ(tree->inRange(0, 0, 64, objects), 0);
+	}
+}
@@ -0,0 +1,87 @@
+/*
+ * SpaceCollisionBroadphaseTest.cpp
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <random>
+
+#include "server/zone/managers/spacecollision/SpaceCollisionManager.h"
+
+class SpaceCollisionBroadphaseTest : public ::testing::Test {
+protected:
+	std::mt19937 generator;
+
+	float random(float min, float max) {
+		return std::uniform_real_distribution<float>(min, max)(generator);
+	}
+
+	Vector3 randomPosition(float extent) {
+		return Vector3(random(-extent, extent), random(-extent, extent), random(-extent, extent));
+	}
+};
+
+TEST_F(SpaceCollisionBroadphaseTest, MasksMatchPointIntersection) {
+	SpaceCollisionManager* manager = SpaceCollisionManager::instance();
+
+	Vector<ManagedReference<SceneObject*>> noTargets;
+	SpaceCollisionBroadphase broadphase(noTargets);
+
+	Vector<Vector3> centers;
+	Vector<float> radii;
+
+	for (int i = 0; i < SpaceCollisionBroadphase::TARGETSMAX; ++i) {
+		Vector3 center = randomPosition(200.f);
+		float radius = random(1.f, 40.f);
+
+		ASSERT_TRUE(broadphase.addTarget(nullptr, center, radius));
+
+		centers.add(center);
+		radii.add(radius);
+	}
+
+	ASSERT_FALSE(broadphase.addTarget(nullptr, Vector3::ZERO, 1.f));
+
+	Vector<Vector3> starts;
+	Vector<Vector3> ends;
+	Vector<float> segmentRadii;
+
+	// More segments than the initial capacity, some of them of zero length
+	for (int i = 0; i < 500; ++i) {
+		Vector3 start = randomPosition(250.f);
+		Vector3 end = i % 50 == 0 ? start : start + randomPosition(120.f);
+		float segmentRadius = random(0.f, 5.f);
+
+		ASSERT_EQ(broadphase.addSegment(start, end, start.distanceTo(end), segmentRadius), i);
+
+		starts.add(start);
+		ends.add(end);
+		segmentRadii.add(segmentRadius);
+	}
+
+	broadphase.run();
+
+	int hits = 0;
+
+	for (int i = 0; i < starts.size(); ++i) {
+		Vector3 direction = ends.get(i) - starts.get(i);
+		float distance = starts.get(i).distanceTo(ends.get(i));
+
+		for (int t = 0; t < centers.size(); ++t) {
+			Vector3 difference = centers.get(t) - starts.get(i);
+
+			bool expected = manager->getPointIntersection(direction, difference, radii.get(t) + segmentRadii.get(i), distance) != SpaceCollisionManager::MISS;
+			bool actual = (broadphase.getHitMask(i) >> t) & 1;
+
+			EXPECT_EQ(actual, expected) << "segment " << i << " target " << t;
+
+			if (expected)
+				++hits;
+		}
+	}
+
+	// Both outcomes were exercised
+	EXPECT_GT(hits, 0);
+	EXPECT_LT(hits, starts.size() * centers.size());
+}
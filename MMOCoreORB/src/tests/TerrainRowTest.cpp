@@ -0,0 +1,79 @@
+/*
+ * TerrainRowTest.cpp
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "templates/manager/DataArchiveStore.h"
+#include "terrain/ProceduralTerrainAppearance.h"
+#include "conf/ConfigManager.h"
+#include "terrain/PerlinNoise.h"
+
+class TerrainRowTest : public ::testing::Test {
+public:
+
+	TerrainRowTest() {
+		ConfigManager::instance()->loadConfigData();
+		DataArchiveStore::instance()->loadTres(ConfigManager::instance()->getTrePath(), ConfigManager::instance()->getTreFiles());
+	}
+};
+
+TEST_F(TerrainRowTest, Noise2RowMatchesNoise2) {
+	const int count = 83;
+
+	double xs[count];
+	float results[count];
+
+	for (int seed = 1; seed <= 8; ++seed) {
+		trn::ptat::Random random;
+		random.setSeed(seed * 7919);
+
+		PerlinNoise noise(&random);
+		noise.init();
+
+		for (double y = -37.25; y < 40; y += 9.125) {
+			for (int k = 0; k < count; ++k)
+				xs[k] = -21.3 + k * 0.517 * seed;
+
+			noise.noise2Row(xs, y, count, results);
+
+			for (int k = 0; k < count; ++k) {
+				double coord[2] = { xs[k], y };
+
+				// Bit for bit, the row path runs the same operations
+				EXPECT_EQ(noise.noise2(coord), results[k]) << "seed " << seed << " at " << xs[k] << ", " << y;
+			}
+		}
+	}
+}
+
+TEST_F(TerrainRowTest, GetHeightsMatchesGetHeight) {
+	UniqueReference<IffStream*> stream(DataArchiveStore::instance()->openIffFile("terrain/test_terrain.trn"));
+
+	ASSERT_TRUE(stream != nullptr);
+
+	ProceduralTerrainAppearance terrain;
+
+	terrain.readObject(stream);
+
+	// Odd counts and steps so rows are split across the internal batches
+	const int counts[] = { 1, 65, 81, 203 };
+	const float steps[] = { 0.5f, 2.f, 3.75f };
+
+	float heights[203];
+
+	for (int count : counts) {
+		for (float step : steps) {
+			for (float y = -250; y <= 250; y += 61.5f) {
+				float x = -260.25f;
+
+				terrain.getHeights(x, y, step, count, heights);
+
+				for (int k = 0; k < count; ++k) {
+					EXPECT_FLOAT_EQ(terrain.getHeight(x + k * step, y), heights[k]) << "at " << x + k * step << ", " << y;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,104 @@
+/*
+ * TerrainTileCacheTest.cpp
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "templates/manager/DataArchiveStore.h"
+#include "terrain/ProceduralTerrainAppearance.h"
+#include "terrain/manager/TerrainTileCache.h"
+#include "conf/ConfigManager.h"
+
+class TerrainTileCacheTest : public ::testing::Test {
+public:
+	Reference<ProceduralTerrainAppearance*> terrain;
+
+	TerrainTileCacheTest() {
+		ConfigManager::instance()->loadConfigData();
+		DataArchiveStore::instance()->loadTres(ConfigManager::instance()->getTrePath(), ConfigManager::instance()->getTreFiles());
+
+		// Missing tiles are computed inline by the request that misses them
+		ConfigManager::instance()->setInt("Core3.TerrainTileCache.Threads", 0);
+	}
+
+	void SetUp() {
+		UniqueReference<IffStream*> stream(DataArchiveStore::instance()->openIffFile("terrain/test_terrain.trn"));
+
+		ASSERT_TRUE(stream != nullptr);
+
+		terrain = new ProceduralTerrainAppearance();
+		terrain->readObject(stream);
+	}
+
+	void TearDown() {
+		terrain = nullptr;
+	}
+
+	float getCachedHeight(TerrainTileCache* cache, float x, float y) {
+		float height = 0;
+
+		// The first read of a tile misses and computes it
+		if (!cache->getHeight(x, y, height))
+			EXPECT_TRUE(cache->getHeight(x, y, height));
+
+		return height;
+	}
+};
+
+TEST_F(TerrainTileCacheTest, PolesMatchTheUncachedHeight) {
+	float size = terrain->getSize();
+	float spacing = Math::max(1.f, terrain->getDistanceBetweenPoles());
+
+	Reference<TerrainTileCache*> cache = new TerrainTileCache(terrain, -size / 2, size / 2, spacing);
+
+	for (float y = -200; y <= 200; y += 8 * spacing) {
+		for (float x = -200; x <= 200; x += 8 * spacing) {
+			float poleX = -size / 2 + spacing * floor((x + size / 2) / spacing);
+			float poleY = -size / 2 + spacing * floor((y + size / 2) / spacing);
+
+			EXPECT_FLOAT_EQ(terrain->getHeight(poleX, poleY), getCachedHeight(cache, poleX, poleY)) << poleX << ", " << poleY;
+		}
+	}
+}
+
+TEST_F(TerrainTileCacheTest, InterpolatedHeightsStayCloseToTheUncachedHeight) {
+	float size = terrain->getSize();
+	float spacing = Math::max(1.f, terrain->getDistanceBetweenPoles());
+
+	Reference<TerrainTileCache*> cache = new TerrainTileCache(terrain, -size / 2, size / 2, spacing);
+
+	float maxError = 0;
+
+	for (float y = -250.3f; y <= 250; y += 3.7f) {
+		for (float x = -250.1f; x <= 250; x += 3.3f) {
+			float error = fabs(terrain->getHeight(x, y) - getCachedHeight(cache, x, y));
+
+			maxError = Math::max(maxError, error);
+		}
+	}
+
+	// The client interpolates between the same poles
+	EXPECT_LT(maxError, 0.5f);
+}
+
+TEST_F(TerrainTileCacheTest, InvalidateDropsOnlyTheTilesInTheArea) {
+	float size = terrain->getSize();
+	float spacing = Math::max(1.f, terrain->getDistanceBetweenPoles());
+	float tileSize = spacing * TerrainTile::TILE_INTERVALS;
+
+	Reference<TerrainTileCache*> cache = new TerrainTileCache(terrain, -size / 2, size / 2, spacing);
+
+	getCachedHeight(cache, 10, 10);
+	getCachedHeight(cache, 10 + 4 * tileSize, 10);
+
+	EXPECT_EQ(2, cache->getTilesCount());
+
+	cache->invalidate(5, 5, 15, 15);
+
+	float height = 0;
+
+	EXPECT_FALSE(cache->getHeight(10, 10, height));
+	EXPECT_TRUE(cache->getHeight(10 + 4 * tileSize, 10, height));
+	EXPECT_EQ(1, cache->getClearTilesCount());
+}
@@ -14,8 +14,12 @@
 class TreeArchive : public Logger {
 	HashTable<String, Reference<TreeDirectory*> > nodeMap;
 
+	bool memoryMapped;
+
+	mutable TreeRecordCache recordCache;
+
 public:
-	TreeArchive() {
+	TreeArchive(bool memoryMapped = false, uint64 recordCacheBytes = 0) : memoryMapped(memoryMapped), recordCache(recordCacheBytes) {
 		setLoggingName("TreeArchive");
 		setLogging(false);
 
@@ -63,33 +67,51 @@ public:
 	 * Don't forget to delete the pointer when finished.
 	 */
 	byte* getBytes(const String& recordPath, int& size) const {
+		TreeRecordData data;
+
+		getRecordData(recordPath, data);
+
+		size = data.getSize();
+
+		return data.copyBytes();
+	}
+
+	/**
+	 * Gets the bytes of the specified path without copying them when the archive is memory mapped.
+	 * @return false if the record doesn't exist
+	 */
+	bool getRecordData(const String& recordPath, TreeRecordData& data) const {
+		data.clear();
+
 		int pos = recordPath.lastIndexOf("/");
 
 		//Only folders are allowed at the root level of TRE directories.
 		if (pos == -1)
-			return nullptr;
+			return false;
 
 		String dir = recordPath.subString(0, pos);
 		String fileName = recordPath.subString(pos + 1, recordPath.length());
 
 		const TreeDirectory* treeDir = nodeMap.get(dir).get();
 
-		size = 0;
-
 		if (treeDir == nullptr)
-			return nullptr;
+			return false;
 
 		int idx = treeDir->find(fileName);
 
 		if (idx == -1) {
 			warning() << recordPath << " not found.";
-			return nullptr;
+			return false;
 		}
 
 		const Reference<TreeFileRecord*>& record = treeDir->get(idx);
-		size = record->getUncompressedSize();
+		record->getData(data, &recordCache);
+
+		return !data.isEmpty();
+	}
 
-		return record->getBytes();
+	inline bool isMemoryMapped() const {
+		return memoryMapped;
 	}
 
 	const TreeDirectory* getDirectory(const String& path) const {
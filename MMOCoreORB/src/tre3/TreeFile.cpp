@@ -33,6 +33,15 @@ void TreeFile::read(const String& path) {
 		return;
 	}
 
+	if (treeArchive != nullptr && treeArchive->isMemoryMapped()) {
+		mapping = new TreeFileMapping();
+
+		if (!mapping->open(path)) {
+			warning("Could not map the file, its records will be read from disk.");
+			mapping = nullptr;
+		}
+	}
+
 	readHeader(&fileStream);
 
 	fileStream.close();
@@ -99,6 +108,7 @@ void TreeFile::readFileBlock(FileInputStream* fileStream) {
 	for (int i = 0; i < totalRecords; ++i) {
 		Reference<TreeFileRecord*> tfr = new TreeFileRecord();
 		tfr->setTreeFilePath(filePath);
+		tfr->setMapping(mapping);
 		bufferOffset += tfr->readFromBuffer(uncompressedData + bufferOffset);
 
 		records.emplace(std::move(tfr));
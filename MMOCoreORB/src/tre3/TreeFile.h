@@ -26,6 +26,8 @@ class TreeFile : public Logger {
 
 	Vector<Reference<TreeFileRecord*> > records;
 
+	Reference<TreeFileMapping*> mapping;
+
 	void readHeader(FileInputStream* fileStream);
 	void readFileBlock(FileInputStream* fileStream);
 	void readNameBlock(FileInputStream* fileStream);
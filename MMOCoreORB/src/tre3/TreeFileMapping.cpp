@@ -0,0 +1,69 @@
+/*
+ * TreeFileMapping.cpp
+ */
+
+#include "TreeFileMapping.h"
+
+#ifndef PLATFORM_WIN
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+TreeFileMapping::TreeFileMapping() : Logger("TreeFileMapping") {
+	fd = -1;
+	data = nullptr;
+	length = 0;
+}
+
+TreeFileMapping::~TreeFileMapping() {
+#ifndef PLATFORM_WIN
+	if (data != nullptr)
+		munmap(const_cast<byte*>(data), length);
+
+	if (fd != -1)
+		close(fd);
+#endif
+}
+
+bool TreeFileMapping::open(const String& path) {
+#ifdef PLATFORM_WIN
+	return false;
+#else
+	setLoggingName("TreeFileMapping " + path);
+
+	fd = ::open(path.toCharArray(), O_RDONLY);
+
+	if (fd == -1)
+		return false;
+
+	struct stat st;
+
+	if (fstat(fd, &st) != 0 || st.st_size == 0) {
+		close(fd);
+		fd = -1;
+
+		return false;
+	}
+
+	void* mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	if (mapping == MAP_FAILED) {
+		error() << "could not map tree file";
+
+		close(fd);
+		fd = -1;
+
+		return false;
+	}
+
+	data = static_cast<const byte*>(mapping);
+	length = st.st_size;
+
+	// Records are read in no particular order
+	madvise(mapping, length, MADV_RANDOM);
+
+	return true;
+#endif
+}
@@ -0,0 +1,38 @@
+/*
+ * TreeFileMapping.h
+ */
+
+#ifndef TREEFILEMAPPING_H_
+#define TREEFILEMAPPING_H_
+
+#include "engine/engine.h"
+
+/**
+ * Read only mapping of a whole .tre file, kept for as long as any of its records
+ * reference it.
+ */
+class TreeFileMapping : public Object, public Logger {
+	int fd;
+	const byte* data;
+	uint64 length;
+
+public:
+	TreeFileMapping();
+	~TreeFileMapping();
+
+	bool open(const String& path);
+
+	inline bool contains(uint64 offset, uint64 size) const {
+		return data != nullptr && offset <= length && size <= length - offset;
+	}
+
+	inline const byte* getData() const {
+		return data;
+	}
+
+	inline uint64 getLength() const {
+		return length;
+	}
+};
+
+#endif /* TREEFILEMAPPING_H_ */
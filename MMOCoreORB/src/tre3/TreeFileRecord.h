@@ -9,6 +9,8 @@
 #define TREEFILERECORD_H_
 
 #include "TreeDataBlock.h"
+#include "TreeFileMapping.h"
+#include "TreeRecordCache.h"
 
 class TreeFileRecord : public Object, public Logger {
 	String recordName;
@@ -23,6 +25,9 @@ class TreeFileRecord : public Object, public Logger {
 
 	byte md5Sum[16];
 
+	// Set when the tree file is memory mapped
+	Reference<TreeFileMapping*> mapping;
+
 public:
 	TreeFileRecord() : Object(), Logger(), checksum(0), uncompressedSize(0), fileOffset(0), compressionType(0), compressedSize(0), nameOffset(0) {
 		setLoggingName("TreeFileRecord");
@@ -41,6 +46,7 @@ public:
 		compressedSize = tfr.compressedSize;
 		nameOffset = tfr.nameOffset;
 		memcpy(md5Sum, tfr.md5Sum, 16);
+		mapping = tfr.mapping;
 
 		setLoggingName("TreeFileRecord " + recordName);
 		setLogging(false);
@@ -59,6 +65,7 @@ public:
 		compressedSize = tfr.compressedSize;
 		nameOffset = tfr.nameOffset;
 		memcpy(md5Sum, tfr.md5Sum, 16);
+		mapping = tfr.mapping;
 
 		setLoggingName("TreeFileRecord " + recordName);
 
@@ -106,7 +113,80 @@ public:
 	    return bufferOffset;
 	}
 
+	/**
+	 * Fills data with the uncompressed record. Uncompressed records of a mapped tree file
+	 * are returned as views into the mapping, compressed ones are inflated from it and
+	 * shared through cache.
+	 */
+	void getData(TreeRecordData& data, TreeRecordCache* cache) {
+		if (mapping == nullptr || !mapping->contains(fileOffset, compressionType == 2 ? compressedSize : uncompressedSize)) {
+			data.setOwned(getBytes(), uncompressedSize);
+			return;
+		}
+
+		const byte* recordData = mapping->getData() + fileOffset;
+
+		if (compressionType != 2) {
+			data.setView(recordData, uncompressedSize, mapping);
+			return;
+		}
+
+		uint64 cacheKey = (uint64) this;
+
+		if (cache != nullptr && cache->isEnabled()) {
+			Reference<TreeInflatedRecord*> cached = cache->get(cacheKey);
+
+			if (cached != nullptr) {
+				data.setView(cached->getData(), cached->getSize(), cached);
+				return;
+			}
+		}
+
+		byte* buffer = inflate(recordData);
+
+		if (buffer == nullptr) {
+			data.clear();
+			return;
+		}
+
+		if (cache == nullptr || !cache->isEnabled()) {
+			data.setOwned(buffer, uncompressedSize);
+			return;
+		}
+
+		Reference<TreeInflatedRecord*> inflated = new TreeInflatedRecord(buffer, uncompressedSize);
+		cache->put(cacheKey, inflated);
+
+		data.setView(inflated->getData(), inflated->getSize(), inflated);
+	}
+
+	byte* inflate(const byte* compressedData) {
+		byte* buffer = new byte[uncompressedSize];
+		zlib::uLongf size = uncompressedSize;
+
+		if (zlib::uncompress(buffer, &size, compressedData, compressedSize) != Z_OK) {
+			error() << "could not inflate record " << recordName << " from " << treeFilePath;
+
+			delete [] buffer;
+			return nullptr;
+		}
+
+		return buffer;
+	}
+
 	byte* getBytes() {
+		if (mapping != nullptr && mapping->contains(fileOffset, compressionType == 2 ? compressedSize : uncompressedSize)) {
+			const byte* recordData = mapping->getData() + fileOffset;
+
+			if (compressionType == 2)
+				return inflate(recordData);
+
+			byte* buffer = new byte[uncompressedSize];
+			memcpy(buffer, recordData, uncompressedSize);
+
+			return buffer;
+		}
+
 		File file(treeFilePath);
 		FileInputStream fileStream(&file);
 
@@ -168,6 +248,10 @@ public:
 	inline void setTreeFilePath(const String& path) {
 		treeFilePath = path;
 	}
+
+	inline void setMapping(TreeFileMapping* treeFileMapping) {
+		mapping = treeFileMapping;
+	}
 };
 
 #endif /* TREEFILERECORD_H_ */
@@ -0,0 +1,83 @@
+/*
+ * TreeRecordCache.cpp
+ */
+
+#include "TreeRecordCache.h"
+
+#include <algorithm>
+
+TreeRecordCache::TreeRecordCache(uint64 maxBytes) : maxBytes(maxBytes), usedBytes(0), useCounter(0) {
+	entries.setNoDuplicateInsertPlan();
+}
+
+Reference<TreeInflatedRecord*> TreeRecordCache::get(uint64 key) {
+	Locker locker(&mutex);
+
+	int index = entries.find(key);
+
+	if (index == -1)
+		return nullptr;
+
+	Entry& entry = entries.elementAt(index).getValue();
+	entry.lastUse = ++useCounter;
+
+	return entry.record;
+}
+
+void TreeRecordCache::put(uint64 key, TreeInflatedRecord* record) {
+	if (record == nullptr || record->getSize() > maxBytes / 4)
+		return;
+
+	Locker locker(&mutex);
+
+	if (entries.contains(key))
+		return;
+
+	evict(record->getSize());
+
+	Entry entry;
+	entry.record = record;
+	entry.lastUse = ++useCounter;
+
+	entries.put(key, entry);
+	usedBytes += record->getSize();
+}
+
+void TreeRecordCache::evict(uint64 neededBytes) {
+	if (entries.isEmpty() || usedBytes + neededBytes <= maxBytes)
+		return;
+
+	// Evicts down to three quarters of the budget at once so the scan isn't done on every put
+	uint64 targetBytes = maxBytes / 4 * 3;
+	uint64 bytesToFree = usedBytes + neededBytes > targetBytes ? usedBytes + neededBytes - targetBytes : 0;
+
+	int count = entries.size();
+	std::pair<uint64, uint32>* uses = new std::pair<uint64, uint32>[count];
+
+	for (int i = 0; i < count; ++i) {
+		const Entry& entry = entries.elementAt(i).getValue();
+		uses[i] = std::make_pair(entry.lastUse, entry.record->getSize());
+	}
+
+	std::sort(uses, uses + count);
+
+	uint64 cutoff = 0;
+	uint64 freed = 0;
+
+	for (int i = 0; i < count && freed < bytesToFree; ++i) {
+		cutoff = uses[i].first;
+		freed += uses[i].second;
+	}
+
+	delete [] uses;
+
+	// Readers still holding a record keep it alive
+	for (int i = entries.size() - 1; i >= 0; --i) {
+		const Entry& entry = entries.elementAt(i).getValue();
+
+		if (entry.lastUse <= cutoff) {
+			usedBytes -= entry.record->getSize();
+			entries.remove(i);
+		}
+	}
+}
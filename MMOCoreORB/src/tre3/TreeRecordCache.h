@@ -0,0 +1,148 @@
+/*
+ * TreeRecordCache.h
+ */
+
+#ifndef TREERECORDCACHE_H_
+#define TREERECORDCACHE_H_
+
+#include "engine/engine.h"
+
+/**
+ * Uncompressed contents of a compressed tree record.
+ */
+class TreeInflatedRecord : public Object {
+	byte* data;
+	uint32 size;
+
+public:
+	TreeInflatedRecord(byte* data, uint32 size) : data(data), size(size) {
+	}
+
+	~TreeInflatedRecord() {
+		delete [] data;
+	}
+
+	inline const byte* getData() const {
+		return data;
+	}
+
+	inline uint32 getSize() const {
+		return size;
+	}
+};
+
+/**
+ * Bytes of a tree record. They either point into the mapped archive or into a
+ * cached inflated record, which are kept alive by holder, or are a buffer owned
+ * by this object.
+ */
+class TreeRecordData {
+	const byte* data;
+	int size;
+
+	byte* ownedData;
+	Reference<Object*> holder;
+
+public:
+	TreeRecordData() : data(nullptr), size(0), ownedData(nullptr) {
+	}
+
+	TreeRecordData(const TreeRecordData&) = delete;
+	TreeRecordData& operator=(const TreeRecordData&) = delete;
+
+	~TreeRecordData() {
+		delete [] ownedData;
+	}
+
+	void setView(const byte* view, int viewSize, Object* viewHolder) {
+		clear();
+
+		data = view;
+		size = viewSize;
+		holder = viewHolder;
+	}
+
+	void setOwned(byte* buffer, int bufferSize) {
+		clear();
+
+		ownedData = buffer;
+		data = buffer;
+		size = bufferSize;
+	}
+
+	void clear() {
+		delete [] ownedData;
+		ownedData = nullptr;
+
+		data = nullptr;
+		size = 0;
+		holder = nullptr;
+	}
+
+	/**
+	 * @return a copy of the bytes the caller has to delete
+	 */
+	byte* copyBytes() const {
+		if (data == nullptr)
+			return nullptr;
+
+		byte* copy = new byte[size];
+		memcpy(copy, data, size);
+
+		return copy;
+	}
+
+	inline const byte* getData() const {
+		return data;
+	}
+
+	inline int getSize() const {
+		return size;
+	}
+
+	inline bool isEmpty() const {
+		return data == nullptr || size == 0;
+	}
+};
+
+/**
+ * LRU of inflated compressed records bounded by their total size.
+ */
+class TreeRecordCache {
+	class Entry {
+	public:
+		Reference<TreeInflatedRecord*> record;
+		uint64 lastUse;
+
+		Entry() : lastUse(0) {
+		}
+	};
+
+	VectorMap<uint64, Entry> entries;
+
+	uint64 maxBytes;
+	uint64 usedBytes;
+	uint64 useCounter;
+
+	Mutex mutex;
+
+public:
+	TreeRecordCache(uint64 maxBytes);
+
+	Reference<TreeInflatedRecord*> get(uint64 key);
+
+	void put(uint64 key, TreeInflatedRecord* record);
+
+	inline void setMaxBytes(uint64 bytes) {
+		maxBytes = bytes;
+	}
+
+	inline bool isEnabled() const {
+		return maxBytes > 0;
+	}
+
+private:
+	void evict(uint64 neededBytes);
+};
+
+#endif /* TREERECORDCACHE_H_ */